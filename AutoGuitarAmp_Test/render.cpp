@@ -7,6 +7,10 @@
 
 #include "LDSP.h"
 #include "libraries/OrtModel/OrtModel.h"
+#include "../common/OrtModelRT.h"
+#include "../common/NativeAmpModels.h"
+#include <algorithm>
+#include <vector>
 
 OrtModel model;
 std::string modelType = "onnx";
@@ -15,12 +19,78 @@ std::string modelName = "AutoGuitarAmp";
 float input[1] = {0};
 float output[1];
 
+// if true, the whole period goes through a single run, with the LSTM stepping along the audioFrames samples
+// the model with a dynamic time axis is derived with tools/make_model_variants.py autoguitaramp-block,
+// it carries the LSTM state across periods, so the output is continuous and does not depend on the period size
+bool blockInference = false;
+std::string blockModelName = "AutoGuitarAmp_block";
+float conditioning = 0; // second input feature of the LSTM, the conditioning control of the original model
+OrtModelRT blockModel;
+OrtModelRT::Options modelOptions; // session options, the default is a single thread that does not spin
+std::vector<float> blockInput; // [frames, 2], sample and conditioning
+std::vector<float> blockOutput;
+
+// if true, each input channel goes through its own instance of the model, with all the channels in a single run per period as a batch
+// the model is derived with tools/make_model_variants.py autoguitaramp-multichannel,
+// it carries the LSTM state of each channel across periods
+bool multichannelInference = false;
+std::string multichannelModelName = "AutoGuitarAmp_multichannel";
+OrtModelRT multichannelModel;
+int numChannels = 1;
+std::vector<float> multichannelInput; // [channels, frames, 2], sample and conditioning
+std::vector<float> multichannelOutput; // [channels, frames]
+
+// if true, runs the LSTM and dense layers of common/NativeAmpModels.h instead of ONNX Runtime, with the weights of modelName,
+// so that there is no runtime call per sample; the LSTM state is carried from one sample to the next
+bool nativeInference = false;
+NativeAutoGuitarAmp nativeModel;
+
 
 bool setup(LDSPcontext *context, void *userData) {
 
-  std::string modelPath = "./"+modelName+"."+modelType;
-  if (!model.setup("session1", modelPath))
-    printf("unable to setup model");
+  if(multichannelInference) {
+    numChannels = std::min(context->audioInChannels, context->audioOutChannels);
+    int frames = context->audioFrames;
+    multichannelInput.assign(numChannels*frames*2, conditioning);
+    multichannelOutput.assign(numChannels*frames, 0);
+    std::string modelPath = "./"+multichannelModelName+"."+modelType;
+    if(!multichannelModel.setup("session1", modelPath, modelOptions)) {
+      printf("unable to setup multichannel model\n");
+      return false;
+    }
+    std::vector<int64_t> stateShape = multichannelModel.getInputShape(1); // [1, channels, hidden]
+    stateShape[1] = numChannels;
+    if(!multichannelModel.bindInput(0, multichannelInput.data(), {numChannels, frames, 2}) ||
+       !multichannelModel.bindOutput(0, multichannelOutput.data(), {numChannels, frames}) ||
+       !multichannelModel.bindState(1, 1, stateShape) || !multichannelModel.bindState(2, 2, stateShape) || !multichannelModel.prepare()) {
+      printf("unable to setup multichannel model\n");
+      return false;
+    }
+  }
+  else if(blockInference) {
+    blockInput.assign(context->audioFrames*2, conditioning);
+    blockOutput.assign(context->audioFrames, 0);
+    std::string modelPath = "./"+blockModelName+"."+modelType;
+    if(!blockModel.setup("session1", modelPath, modelOptions) || !blockModel.bindInput(0, blockInput.data(), {context->audioFrames, 2}) ||
+       !blockModel.bindOutput(0, blockOutput.data(), {context->audioFrames, 1}) ||
+       !blockModel.bindState(1, 1) || !blockModel.bindState(2, 2) || !blockModel.prepare()) {
+      printf("unable to setup block model\n");
+      return false;
+    }
+  }
+  else if(nativeInference) {
+    std::string modelPath = "./"+modelName+"."+modelType;
+    if(!nativeModel.setup(modelPath)) {
+      printf("unable to setup native model\n");
+      return false;
+    }
+    nativeModel.setConditioning(conditioning);
+  }
+  else {
+    std::string modelPath = "./"+modelName+"."+modelType;
+    if (!model.setup("session1", modelPath))
+      printf("unable to setup model");
+  }
 
   return true;
 }
@@ -29,19 +99,46 @@ void render(LDSPcontext *context, void *userData)
 {
    for(int n=0; n<context->audioFrames; n++) {
 
+    if(multichannelInference) {
+      for(int ch=0; ch<numChannels; ch++) {
+        float sample = audioRead(context, n, ch);
+        multichannelInput[2*(ch*context->audioFrames + n)] = sample;
+        // passthrough test, because the model may not be trained
+        audioWrite(context, n, ch, sample);
+      }
+      continue;
+    }
+
     input[0] = audioRead(context, n, 0);
 
     // Run the model
-    model.run(input, output);
+    if(blockInference)
+      blockInput[2*n] = input[0];
+    else if(nativeInference)
+      nativeModel.run(input, output);
+    else
+      model.run(input, output);
 
     // passthrough test, because the model may not be trained
     audioWrite(context, n, 0, input[0]);
     audioWrite(context, n, 1, input[0]);
   }
+
+  if(multichannelInference)
+    multichannelModel.run();
+  else if(blockInference)
+    blockModel.run();
 }
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-  model.cleanup();
+  if(multichannelInference)
+    multichannelModel.cleanup();
+  else if(blockInference)
+    blockModel.cleanup();
+  else if(nativeInference)
+    nativeModel.cleanup();
+  else
+    model.cleanup();
 }
 
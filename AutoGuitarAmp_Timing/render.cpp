@@ -8,11 +8,21 @@
 #include "LDSP.h"
 #include "libraries/OrtModel/OrtModel.h"
 #include <chrono>
-#include <fstream> // ofstream
+#include "../common/LatencyHistogram.h"
+#include "../common/DeadlineMonitor.h"
+#include "../common/TimingLogWriter.h"
+#include "../common/ModelWarmup.h"
+#include "../common/NativeAmpModels.h"
 
 OrtModel model;
 std::string modelType = "onnx";
 std::string modelName = "AutoGuitarAmp";
+int warmupRuns = 10; // model runs in setup(), so that the first callbacks are not slower than the following ones and do not skew the log
+
+// if true, times the LSTM and dense layers of common/NativeAmpModels.h instead of ONNX Runtime, with the weights of modelName;
+// the LSTM state is carried from one sample to the next
+bool nativeInference = false;
+NativeAutoGuitarAmp nativeModel;
 
 float input[1];
 float output[1] = {0};
@@ -21,66 +31,96 @@ float output[1] = {0};
 
 int outputSize = 1;
 
-unsigned long long * inferenceTimes;
-int logPtr = 0;
+std::string timingLogDir = ".";
+TimingLogWriter timingLog; // streams inference times to a binary file
+long long logCnt = 0;
 constexpr int testDuration_sec = 10;
-int numLogs;
+long long numLogs;
+LatencyHistogram inferenceHistogram; // nanoseconds
+
+float deadlineBudgetFraction = 0.75; // callbacks longer than this fraction of the period duration count as deadline misses
+DeadlineMonitor deadlineMonitor; // times the whole render() callback
+int maxStoredMisses = 4096; // further misses are counted, but their indices are not stored
 
 
 bool setup(LDSPcontext *context, void *userData)
 {
     std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
+    if(nativeInference)
+    {
+        if(!nativeModel.setup(modelPath))
+        {
+            printf("unable to setup native model\n");
+            return false;
+        }
+    }
+    else if (!model.setup("session1", modelPath))
         printf("unable to setup ortModel");
 
+    // warm-up with a zero input, then clear what the runs wrote
+    input[0] = 0;
+    warmUpModel(("model "+modelName).c_str(), warmupRuns, [](int) {
+        if(nativeInference)
+            nativeModel.run(input, output);
+        else
+            model.run(input, output);
+    });
+    output[0] = 0;
+    nativeModel.reset();
+
     //--------------------------------
-    inferenceTimes = new unsigned long long[context->audioSampleRate*testDuration_sec*1.01];
     numLogs = context->audioSampleRate*testDuration_sec / outputSize; // division to handle case of models outputting a block of samples
+    std::string timingLogFileName = "inferenceTiming_"+modelName+"_out"+std::to_string(outputSize)+(nativeInference ? "_native.tlog" : "_onnx.tlog");
+    if(!timingLog.setup(timingLogDir+"/"+timingLogFileName, modelName, context->audioSampleRate, context->audioFrames, outputSize))
+        return false;
+    deadlineMonitor.setup(context->audioFrames, context->audioSampleRate, deadlineBudgetFraction, maxStoredMisses);
 
     return true;
 }
 
 void render(LDSPcontext *context, void *userData)
 {
+    deadlineMonitor.beginPeriod();
+
     for(int n=0; n<context->audioFrames; n++)
 	{
         input[0] = audioRead(context, n, 0);
 
         // Start the Clock
-        auto start_time = std::chrono::high_resolution_clock::now();
+        auto start_time = std::chrono::steady_clock::now();
         
-        model.run(input, output);
+        if(nativeInference)
+            nativeModel.run(input, output);
+        else
+            model.run(input, output);
 
         // Stop the clock  
-        auto end_time = std::chrono::high_resolution_clock::now();
-        inferenceTimes[logPtr] = std::chrono::duration_cast
-                                <std::chrono::microseconds>(end_time - start_time).count();
-        logPtr++;
+        auto end_time = std::chrono::steady_clock::now();
+        unsigned long long inferenceTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+        inferenceHistogram.record(inferenceTime);
+        timingLog.push(inferenceTime);
+        logCnt++;
 
         // passthrough test, because the model may not be trained
         audioWrite(context, n, 0, input[0]);
         audioWrite(context, n, 1, input[0]);
 
-        if(logPtr>=numLogs)
+        if(logCnt>=numLogs)
             LDSP_requestStop();
 	}
+
+    deadlineMonitor.endPeriod();
 }
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-    std::string timingLogDir = ".";
-    std::string timingLogFileName = "inferenceTiming_"+modelName+"_out"+std::to_string(outputSize)+"_onnx.txt";
-    std::string timingLogFilePath = timingLogDir+"/"+timingLogFileName;
-
-    std::ofstream logFile(timingLogFilePath);
-    if(logFile.is_open())
-    {
-        for (int i=0;i<numLogs; i++)
-            logFile << std::to_string(inferenceTimes[i]) << "\n";
-    }
-    logFile.close();
+    inferenceHistogram.printReport(("inference "+modelName).c_str());
+    deadlineMonitor.printReport(("render "+modelName).c_str());
 
-    delete[] inferenceTimes;
+    timingLog.cleanup();
 
-    model.cleanup();
+    if(nativeInference)
+        nativeModel.cleanup();
+    else
+        model.cleanup();
 }
\ No newline at end of file
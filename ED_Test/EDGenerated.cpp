@@ -0,0 +1,577 @@
+// ED.onnx compiled ahead of time by tools/onnx_to_cpp.py, do not edit, regenerate it instead
+
+#include "EDGenerated.h"
+#include <algorithm>
+#include <cmath>
+
+alignas(16) static float t1[16]; // /cond_dense_h/Gemm_output_0 [1, 16]
+alignas(16) static const float c2[48] = {
+    -0.200707182f, -0.364068389f, 0.178849846f, 0.500783205f, -0.30319491f, 0.354287952f, -0.465210021f, 0.38677007f,
+    -0.00653807959f, -0.524997056f, 0.210325271f, -0.13085705f, 0.355370641f, -0.203056678f, -0.0212679785f, -0.344137967f,
+    0.27431488f, -0.456855029f, 0.192996651f, 0.180256709f, -0.05963552f, 0.254771143f, -0.434852809f, 0.143792599f,
+    0.255026549f, 0.0200176947f, -0.00845259894f, 0.370105982f, -0.524758816f, -0.326917261f, -0.388794571f, -0.299186379f,
+    -0.33431235f, -0.269456416f, -0.0802802145f, 0.50252229f, -0.397568315f, -0.115145981f, -0.30836308f, -0.355266631f,
+    -0.242580757f, 0.0900094584f, 0.304641068f, 0.446109295f, 0.303416371f, 0.1812343f, -0.317915499f, -0.445845276f
+}; // Gemm /cond_dense_h/Gemm weights [3, 16]
+alignas(16) static const float c3[16] = {
+    -0.111913867f, -0.442043632f, -0.447118342f, -0.266768724f, -0.142099559f, -0.445244014f, 0.551888943f, -0.119597822f,
+    0.48390463f, -0.159757778f, 0.301510066f, 0.361977607f, 0.38261506f, -0.522073805f, -0.138779148f, 0.474560857f
+}; // Gemm /cond_dense_h/Gemm bias
+alignas(16) static float t4[16]; // /state_h/Conv_output_0 [1, 1, 16]
+alignas(16) static float p5[31] = {0}; // Conv /state_h/Conv zero-padded input, the padding is never written
+alignas(16) static const float c6[16] = {
+    -0.0912482738f, 0.129980683f, 0.219333351f, 0.136716038f, -0.078707695f, 0.24931401f, 0.0435743928f, 0.22530067f,
+    -0.0596443117f, 0.0209917128f, 0.192359746f, 0.127472341f, -0.028406322f, 0.101487368f, -0.0250418484f, 0.034148097f
+}; // Conv /state_h/Conv weights [1, 1, 16]
+alignas(16) static const float c7[16] = {
+    0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f,
+    0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f, 0.033750236f
+}; // Conv /state_h/Conv bias
+alignas(16) static float t8[16]; // /cond_dense_c/Gemm_output_0 [1, 16]
+alignas(16) static const float c9[48] = {
+    0.333702028f, -0.446072876f, -0.08653301f, -0.0588794015f, -0.356065989f, -0.425027072f, -0.0926513895f, -0.264979959f,
+    0.47988832f, -0.567470849f, -0.529269278f, -0.329665333f, -0.543315232f, -0.575111628f, 0.161216751f, -0.150122628f,
+    0.452318192f, -0.156681418f, -0.50617522f, 0.340326279f, 0.451218486f, 0.373827428f, -0.0734483898f, -0.463846326f,
+    0.0751168579f, -0.315409571f, -0.0136354351f, -0.437986434f, 0.315896779f, 0.367254049f, 0.0972805247f, -0.0323478542f,
+    0.451284766f, 0.125189349f, 0.181732118f, 0.459988087f, 0.327638358f, -0.269388497f, -0.0032215158f, -0.273571432f,
+    0.225575686f, -0.0642274916f, 0.345865905f, 0.183031276f, -0.0211947486f, -0.198551759f, -0.482786268f, 0.219367489f
+}; // Gemm /cond_dense_c/Gemm weights [3, 16]
+alignas(16) static const float c10[16] = {
+    -0.3509413f, 0.0614729524f, -0.488795072f, 0.0470531806f, 0.420794994f, 0.415060937f, -0.251279205f, -0.08861202f,
+    0.025528485f, 0.565798461f, -0.218732163f, -0.0693164468f, 0.295290768f, -0.30511713f, 0.129488453f, -0.145805269f
+}; // Gemm /cond_dense_c/Gemm bias
+alignas(16) static float t11[16]; // /state_c/Conv_output_0 [1, 1, 16]
+alignas(16) static float p12[31] = {0}; // Conv /state_c/Conv zero-padded input, the padding is never written
+alignas(16) static const float c13[16] = {
+    0.235637635f, 0.0051163733f, 0.11488238f, -0.149472356f, -0.172625929f, 0.101504743f, -0.0673624575f, -0.0755472183f,
+    0.0474822223f, -0.151495188f, -0.23116836f, -0.240242392f, -0.0428823233f, 0.114967138f, -0.0360001624f, 0.117489368f
+}; // Conv /state_c/Conv weights [1, 1, 16]
+alignas(16) static const float c14[16] = {
+    -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f,
+    -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f, -0.0642811358f
+}; // Conv /state_c/Conv bias
+alignas(16) static float t15[16]; // /Add_output_0 [1, 16]
+alignas(16) static float t16[16]; // /Add_1_output_0 [1, 16]
+alignas(16) static float t17[16]; // /lstm/LSTM_output_0 [1, 1, 1, 16]
+alignas(16) static float t18[16]; // /lstm/LSTM_output_1 [1, 1, 16]
+alignas(16) static float t19[16]; // /lstm/LSTM_output_2 [1, 1, 16]
+alignas(16) static const float c20[1024] = {
+    -0.075291723f, -0.207359701f, -0.136612952f, -0.0381883681f, -0.174128413f, -0.122177809f, 0.0180447996f, 0.162898391f,
+    -0.0101385117f, -0.165960878f, -0.17396152f, -0.195721209f, -0.22293067f, -0.0351828039f, -0.229147017f, 0.235806376f,
+    -0.132660061f, 0.239392996f, -0.165324777f, 0.0251539052f, -0.133442432f, 0.046492666f, -0.242176026f, -0.115556985f,
+    0.229750037f, -0.17691645f, 0.166924477f, -0.219295561f, -0.0521864891f, 0.235910803f, 0.204633325f, 0.0492496789f,
+    -0.103003711f, -0.177557319f, -0.162667423f, 0.129768908f, -0.221275151f, 0.10699755f, 0.0417321026f, 0.226801097f,
+    0.226552129f, 0.16296041f, -0.240254521f, 0.0498647392f, -0.167279482f, -0.125180483f, -0.0942212045f, -0.109792352f,
+    -0.0773365796f, -0.163790256f, 0.0120777488f, -0.171506912f, -0.178104967f, -0.11174199f, 0.109154254f, -0.248748362f,
+    -0.187553823f, 0.0791357458f, -0.0348872542f, -0.0881626904f, -0.0382899046f, -0.0751801729f, 0.139020413f, -0.235209107f,
+    0.239821225f, -0.0982316732f, 0.133777529f, -0.23694557f, -0.0755020082f, -0.06723544f, 0.086543262f, -0.180954933f,
+    -0.169607222f, -0.0758197606f, 0.0198505819f, -0.158734828f, 0.229034871f, -0.144288838f, -0.028937012f, 0.158740103f,
+    -0.205715686f, 0.132539004f, -0.187111557f, 0.245505869f, -0.129779577f, 0.0856425166f, -0.0169179142f, 0.0209698379f,
+    -0.161459267f, -0.197062194f, -0.157226801f, 0.0633898377f, -0.0969621241f, 0.0512202978f, -0.0391540825f, 0.0950593352f,
+    0.196830392f, -0.0445525944f, -0.104539692f, -0.186436117f, -0.0683011711f, 0.208936274f, -0.116640627f, -0.144033521f,
+    -0.231187284f, -0.0959524214f, -0.179742813f, 0.137470335f, 0.220160991f, 0.212755919f, 0.231219172f, 0.240406305f,
+    -0.193695277f, -0.195754409f, -0.188876927f, 0.0546564162f, -0.219096273f, 0.174142361f, -0.0980667472f, 0.082557261f,
+    -0.0801166296f, 0.102789491f, 0.018594563f, -0.0978324115f, 0.0587846637f, -0.124143332f, -0.242908835f, -0.0872317255f,
+    -0.00912627578f, -0.127910078f, -0.0898553133f, -0.184431732f, 0.185165972f, -0.0325764418f, -0.168118179f, -0.165203094f,
+    -0.17238605f, 0.00887599587f, -0.0321015418f, -0.00328317285f, -0.0468837917f, -0.138762504f, -0.0641092062f, -0.215057969f,
+    -0.0463597476f, -0.159873515f, -0.0149606764f, -0.109757781f, 0.238140166f, -0.0438140631f, -0.154945672f, -0.211973697f,
+    -0.14564839f, -0.200825274f, -0.241542846f, 0.185856134f, -0.06947577f, -0.0303300619f, -0.223786831f, 0.188191891f,
+    -0.000553756952f, 0.225960404f, 0.184117824f, 0.105571091f, -0.0816375315f, 0.164163768f, 0.000497370958f, 0.184260339f,
+    0.206943065f, 0.132208645f, 0.0646062195f, 0.137349039f, 0.173296601f, 0.116985828f, -0.223276854f, -7.6174736e-05f,
+    -0.149246752f, -0.00698906183f, 0.206605405f, -0.155684173f, 0.227361768f, -0.168453783f, 0.0760080814f, -0.14127174f,
+    0.210737735f, -0.163164198f, 0.193775564f, 0.181473821f, 0.229088724f, 0.111383438f, -0.0065073669f, 0.156845421f,
+    -0.0119030774f, 0.0193588436f, 0.0728747845f, -0.155469686f, 0.11121121f, 0.197467417f, 0.0355541408f, 0.124465168f,
+    -0.19698596f, -0.176606894f, 0.0849456489f, -0.039419353f, -0.125714988f, 0.149845958f, 0.109392047f, 0.161757678f,
+    -0.24601385f, -0.130443335f, 0.0760825574f, 0.205655426f, -0.161025792f, -0.111486763f, 0.176889688f, 0.205054045f,
+    0.127256364f, -0.182301313f, -0.187767118f, 0.102067828f, 0.0575203896f, 0.145558447f, -0.21370253f, -0.124368429f,
+    -0.135244459f, 0.0903023183f, 0.146758318f, -0.0114931464f, -0.147914678f, 0.00851988792f, -0.10750711f, 0.115354985f,
+    0.0367849171f, 0.243467361f, -0.0541311204f, 0.190226495f, -0.00290253758f, 0.136248946f, -0.241839617f, -0.210123211f,
+    -0.218949497f, -0.0360282958f, -0.0189936757f, -0.0723022521f, 0.139043659f, -0.219922483f, 0.18789199f, -0.235026717f,
+    0.118478626f, -0.0614937544f, 0.0270877779f, -0.127196312f, 0.0814777017f, -0.0153357983f, 0.22693488f, 0.0268888474f,
+    -0.184501082f, 0.180304676f, 0.0415324271f, 0.0508723259f, 0.111332297f, -0.0682418346f, 0.167121023f, 0.208201289f,
+    0.0342801213f, -0.10367015f, -0.0687526762f, 0.135999143f, -0.0382496715f, 0.162239283f, -0.115138322f, 0.0395884514f,
+    0.163309038f, 0.00790816545f, 0.157452643f, -0.16901812f, -0.232992679f, 0.0598737001f, -0.17221719f, -0.169702321f,
+    0.163205773f, -0.216856152f, -0.100379318f, -0.206641018f, 0.182055146f, 0.247946233f, -0.159190625f, 0.207566023f,
+    -0.0584393144f, 0.148302466f, 0.0477485359f, -0.11731258f, -0.183702528f, 0.248378724f, 0.231947094f, 0.206683666f,
+    0.0875970423f, -0.208354592f, 0.0458159745f, -0.0836046934f, 0.102173597f, 0.128959984f, 0.00137540698f, -0.0965423286f,
+    0.153925747f, 0.169608772f, 0.234013081f, -0.111076504f, -0.0637901127f, 0.167591006f, -0.249974787f, 0.0767434537f,
+    0.233365417f, 0.188746721f, 0.144013911f, 0.133933187f, -0.105576575f, -0.118257582f, -0.0746203363f, 0.0592949092f,
+    0.096503526f, 0.223059535f, -0.00632444024f, -0.108222544f, -0.0883505344f, -0.0220387876f, -0.165215164f, 0.0895582139f,
+    0.0276437998f, 0.220319539f, 0.149392158f, 0.012303859f, -0.0147310197f, -0.207871944f, 0.163513243f, 0.204091281f,
+    0.211852312f, -0.166433662f, 0.0847609937f, -0.123169631f, 0.0644560754f, -0.0983026922f, 0.141709805f, 0.238728106f,
+    0.0631398559f, -0.00277882814f, -0.0354312062f, 0.00926190615f, 0.0318652987f, -0.0112850368f, 0.0727011263f, -0.171112657f,
+    -0.0964725316f, 0.18637535f, 0.150702775f, -0.211675346f, 0.10553053f, 0.217674941f, -0.177925825f, 0.0437762439f,
+    -0.248140574f, -0.0923362076f, -0.188744754f, -0.199767798f, -0.156776041f, 0.138787657f, -0.248010516f, -0.122434765f,
+    -0.14502421f, -0.137407213f, -0.155385792f, -0.0892974734f, -0.00210189819f, -0.179386735f, -0.234714746f, 0.158138931f,
+    -0.0334609747f, 0.16758582f, -0.0136290789f, 0.144106925f, -0.120960951f, 0.0120611787f, -0.170129329f, -0.23226288f,
+    0.0264043808f, -0.135136127f, -0.207297087f, 0.0774796605f, 0.0579427183f, 0.114109844f, 0.0221944749f, -0.235882849f,
+    0.184202164f, 0.239220619f, -0.0420133173f, -0.0538394749f, 0.180004448f, -0.207589626f, 0.0409957469f, 0.177243382f,
+    -0.00886571407f, 0.017521739f, 0.22815901f, -0.0996944308f, 0.0399413109f, 0.215687901f, 0.227192879f, -0.0371671319f,
+    0.0580926239f, 0.043336004f, -0.150046796f, -0.24056533f, -0.160479635f, 0.214456975f, -0.201296777f, -0.191992849f,
+    0.069593668f, 0.0772532225f, 0.204730064f, -0.0080832541f, -0.0700097382f, 0.127528459f, 0.21761775f, 0.0697871745f,
+    -0.104232132f, -0.245050281f, 0.0407007933f, 0.165226251f, 0.200934201f, 0.11651057f, 0.151210815f, -0.0274792612f,
+    0.0744767189f, 0.175246835f, -0.235928059f, 0.235341102f, -0.158925354f, 0.220014542f, -0.0418205559f, -0.242233872f,
+    -0.206134766f, -0.00752231479f, 0.218531817f, -0.139996529f, -0.241857797f, 0.0262337625f, -0.119801134f, 0.126740903f,
+    0.117586434f, -0.0783965886f, -0.127068073f, 0.112843663f, -0.0989516675f, 0.23708868f, -0.10920769f, 0.0899134278f,
+    -0.0394924283f, -0.0678423047f, 0.206562936f, 0.0772896707f, 0.0924595296f, -0.212649852f, 0.028403461f, -0.231280774f,
+    0.184589803f, -0.0173387825f, -0.098123163f, 0.173736453f, 0.0616822839f, -0.121977299f, -0.0193630159f, -0.121381402f,
+    0.0523048043f, -0.150041521f, 0.0704550147f, 0.113589227f, -0.221529901f, 0.0464157462f, -0.15856123f, 0.18473652f,
+    -0.0866959989f, 0.0735222995f, -0.0338928103f, 0.127925724f, 0.0341297686f, 0.0459093153f, -0.114656955f, 0.173025846f,
+    0.0816082954f, -0.19279018f, 0.0221438706f, -0.190404058f, 0.210481137f, 0.0413942933f, 0.0563388169f, -0.0495837629f,
+    0.233599156f, 0.244890094f, 0.0776191056f, 0.139884084f, -0.149519056f, -0.245029867f, -0.248157859f, 0.142058045f,
+    0.0460772514f, -0.116667271f, -0.117601067f, 0.187593251f, -0.178685874f, 0.207335949f, 0.219108641f, -0.0806009471f,
+    -0.246070445f, -0.0185275972f, 0.00195747614f, 0.169759542f, 0.0880054235f, 0.246932536f, 0.0443059802f, 0.0875765383f,
+    -0.106267005f, 0.228788584f, 0.0302610695f, 0.0866862833f, -0.132579505f, 0.096657604f, 0.180949301f, 0.136815608f,
+    -0.149450332f, 0.0730551481f, -0.0209096372f, 0.049800843f, 0.1918962f, 0.15800032f, 0.14409247f, 0.189575732f,
+    -0.0938152373f, -0.000438898802f, -0.0390945375f, -0.0636870861f, -0.0756629705f, -0.186912388f, 0.0814166665f, -0.0212270319f,
+    0.0195710957f, -0.155306727f, 0.230723143f, -0.215714872f, -0.0634386539f, -0.109452546f, -0.0649236739f, -0.127421021f,
+    0.138412714f, 0.0375494063f, 0.0891928971f, -0.239422023f, 0.19108659f, 0.12492007f, -0.0106711686f, 0.190842032f,
+    0.00785106421f, 0.0591933131f, 0.0890533328f, -0.187145829f, -0.140977442f, -0.0022034049f, 0.192508161f, 0.102920949f,
+    0.223445058f, 0.233538657f, 0.0580846965f, -0.22179085f, -0.156348765f, -0.0323353112f, -0.22610715f, 0.041900605f,
+    0.187797815f, 0.118441641f, -0.0424710512f, 0.011115998f, -0.119320303f, 0.245180041f, 0.13033244f, -0.215988129f,
+    0.0858727694f, 0.145904541f, -0.218342245f, 0.0966835618f, 0.00317984819f, 0.189047575f, 0.0249889195f, -0.229581773f,
+    -0.10212037f, 0.0894610882f, -0.235446811f, -0.132241577f, 0.167613447f, 0.161173999f, 0.109038025f, 0.215913773f,
+    0.00669696927f, -0.176660448f, -0.225333601f, -0.175012559f, -0.218217194f, -0.102490574f, 0.0710117817f, 0.0192533731f,
+    0.0520597696f, -0.031401664f, -0.221809924f, -0.0410321355f, -0.130719066f, 0.232161522f, 0.0264148712f, -0.121372014f,
+    0.15667215f, 0.210766286f, -0.178965598f, -0.230540574f, 0.129788458f, 0.160934329f, 0.103468478f, 0.237962633f,
+    -0.247731388f, -0.14145726f, 0.150927514f, 0.0729583204f, -0.210345179f, -0.02488783f, 0.0292052627f, -0.170868993f,
+    -0.0341284573f, 0.0255181491f, 0.0981891453f, 0.0798893869f, -0.146466434f, 0.0147141516f, 0.0459347367f, 0.12496835f,
+    0.168467104f, -0.154345304f, -0.234230042f, -0.224379301f, -0.02746737f, 0.202763557f, 0.0463356078f, -0.129332006f,
+    0.181644738f, 0.209026277f, -0.179431856f, 0.0487958193f, -0.146091521f, -0.185793251f, 0.235893339f, 0.0876598358f,
+    -0.0325892568f, 0.232966244f, 0.0803198516f, -0.00349465013f, 0.0417635143f, -0.150550067f, 0.168571323f, -0.127458364f,
+    -0.0555147529f, 0.108200729f, -0.180328995f, -0.230887622f, -0.174895376f, -0.249551803f, -0.136253446f, 0.169717997f,
+    -0.00261622667f, 0.184141606f, -0.195373088f, -0.141513795f, 0.213561773f, 0.212072074f, -0.178089976f, -0.117011815f,
+    0.205905676f, -0.203459948f, -0.102628857f, 0.243899226f, -0.246214718f, 0.145973325f, 0.00124794245f, -0.170391589f,
+    -0.0792456567f, -0.067753315f, 0.0278914869f, -0.178844631f, 0.032374084f, -0.113768965f, -0.0515993834f, -0.204775095f,
+    0.101665467f, 0.154699266f, -0.204192996f, 0.121629953f, 0.0871028304f, -0.140351176f, 0.149845779f, 0.206510961f,
+    0.0393821895f, 0.247749239f, -0.213508755f, -0.190437406f, 0.00239712f, 0.199447602f, -0.140450925f, 0.00847667456f,
+    0.115638733f, 0.224422604f, -0.150848746f, -0.249758452f, 0.202524304f, 0.0512645245f, -0.248629481f, -0.231409401f,
+    0.152194947f, 0.0769748688f, 0.229355305f, 0.0547960103f, 0.179773301f, 0.0375635326f, -0.200578719f, -0.0154729486f,
+    -0.209030062f, 0.140634805f, 0.198463649f, 0.0881625414f, 0.218978316f, -0.201277554f, 0.153446138f, -0.237345189f,
+    0.176105201f, 0.0634082258f, 0.0705021918f, -0.157746345f, -0.141619265f, 0.0984227955f, -0.101780295f, -0.0542784035f,
+    0.227873266f, 0.164993286f, 0.0471662581f, 0.16955325f, 0.14851439f, -0.0127018094f, -0.165816426f, -0.0597482026f,
+    0.196467757f, -0.105339497f, 0.0342985094f, -0.139023155f, -0.0564877093f, -0.151367903f, -0.0965003669f, -0.239195824f,
+    -0.0717765689f, -0.165192783f, 0.139646024f, -0.0697032809f, -0.124241233f, -0.0457676351f, -0.183489949f, 0.193465084f,
+    0.230527848f, 0.148289651f, -0.115157485f, 0.0133765638f, -0.154736787f, -0.14305529f, -0.219335347f, -0.08510077f,
+    0.0476532876f, -0.0308637917f, -0.247054815f, 0.0366140604f, -0.180248767f, -0.111286759f, 0.111102968f, -0.152112544f,
+    0.0638122261f, 0.21279943f, 0.153038055f, 0.202210039f, 0.238951266f, -0.079814285f, 0.0366463065f, -0.158520192f,
+    0.161424875f, 0.0378634632f, -0.23678109f, 0.133578986f, 0.217766732f, 0.240785688f, 0.149358124f, 0.233923435f,
+    0.220195472f, 0.139592588f, 0.122951567f, -0.0731210709f, -0.00994277f, -0.116331726f, 0.137390792f, 0.0101784766f,
+    0.0989639461f, -0.0786861181f, -0.0802105069f, -0.014764905f, -0.188728422f, -0.243871301f, -0.102145761f, 0.0648181736f,
+    0.197388083f, 0.0694794953f, -0.215469927f, -0.13198632f, 0.0878917873f, 0.0880526006f, -0.107634097f, 0.00192373991f,
+    0.194257557f, 0.0486813784f, 0.0986814797f, -0.0588895082f, 0.186146587f, -0.0288577974f, 0.00896900892f, 0.0302256942f,
+    -0.0533829033f, -0.1379188f, -0.116586804f, 0.0159287155f, -0.0397624075f, 0.231350183f, 0.220486015f, 0.139766067f,
+    -0.134617001f, 0.23062399f, 0.125047922f, -0.0486496985f, -0.134937316f, -0.160385847f, 0.0572665334f, 0.0831081271f,
+    -0.20656386f, 0.161770821f, -0.2036286f, 0.0753162801f, 0.170248449f, -0.216943055f, 0.0192299187f, -0.13068372f,
+    0.15207845f, -0.0252596438f, 0.161793232f, -0.0917713642f, -0.238701254f, -0.0524053574f, 0.0147114098f, 0.0441205204f,
+    0.152513385f, 0.23894307f, 0.184319019f, -0.11159572f, -0.221115947f, 0.031299144f, 0.0415474176f, -0.143390417f,
+    0.0909945369f, 0.238291979f, 0.175540954f, 0.0291793942f, 0.0932887793f, -0.18426168f, -0.127090365f, 0.138181537f,
+    -0.137574673f, 0.0336647332f, -0.222428799f, -0.248718858f, -0.234977394f, -0.0488084555f, 0.125766188f, -0.246126801f,
+    0.0621187389f, 0.12863034f, 0.0727309883f, 0.118628919f, 0.128897637f, 0.0264723003f, -0.245320171f, 0.125924349f,
+    0.0602457523f, -0.0913217664f, -0.168996245f, -0.0460171998f, -0.220827669f, -0.198825955f, -0.0357319713f, -0.245207965f,
+    -0.243151277f, 0.151840121f, 0.0486792028f, -0.121272564f, 0.0676939785f, 0.188403308f, 0.136764497f, 0.0535584986f,
+    -0.206924856f, 0.0105273426f, 0.169024587f, -0.183049887f, -0.0573745072f, 0.146439672f, 0.238892019f, -0.0721547604f,
+    0.0682718754f, 0.0427911878f, 0.0127909482f, 0.224862844f, -0.241138101f, 0.229308873f, 0.00107678771f, -0.225510985f,
+    0.188605815f, 0.0818555951f, 0.0839312971f, -0.13913402f, -0.0161342025f, -0.2185027f, 0.0976559818f, 0.238788337f,
+    0.226604611f, 0.174033642f, 0.0747595727f, 0.130946904f, 0.0693397522f, 0.185200959f, 0.146950305f, 0.206227362f,
+    0.17990163f, 0.1766164f, -0.0466713607f, 0.0424171686f, 0.152358949f, -0.171005845f, -0.0503834486f, -0.0942138731f,
+    -0.145367056f, 0.13146925f, -0.157335162f, -0.150790542f, 0.12524882f, -0.0311332643f, -0.0342456996f, -0.177936792f,
+    0.0155299306f, -0.0459603369f, 0.0983317494f, -0.0680173635f, -0.150054485f, -0.00755953789f, -0.11565122f, 0.0998650491f,
+    0.0304624736f, -0.189445287f, 0.201420873f, 0.215476424f, 0.133502781f, 0.0562261343f, 0.240573972f, 0.0885296166f,
+    -0.183727056f, -0.160023123f, 0.180493087f, -0.0380276442f, 0.24504438f, -0.200705767f, -0.236415684f, -0.220448524f,
+    0.0573304594f, -0.00558367372f, -0.0177051425f, 0.20022887f, 0.198022127f, 0.0808051229f, -0.0483931899f, 0.0644579828f,
+    0.208811939f, -0.119979918f, 0.00319114327f, -0.12056461f, -0.0991771519f, 0.164442837f, -0.106025279f, 0.194078088f,
+    0.0840137005f, -0.164367378f, 0.197835833f, 0.00590658188f, 0.173527807f, 0.233495563f, 0.0320065916f, 0.0490669012f,
+    0.0752592385f, -0.0106435716f, -0.0874046385f, 0.151936948f, 0.0713893771f, 0.180991054f, -0.0820056498f, 0.0310111046f,
+    0.230168521f, -0.0853866637f, -0.151144713f, -0.156931102f, 0.0573071241f, -0.239186317f, -0.157935143f, 0.17014119f
+}; // LSTM /lstm/LSTM input weights [16, 64]
+alignas(16) static const float c21[1024] = {
+    0.160518914f, 0.00866883993f, 0.0542844832f, -0.137330234f, -0.237152964f, 0.224491566f, -0.249285847f, 0.0248686373f,
+    -0.15436691f, 0.170140773f, -0.115264177f, -0.0411935449f, -0.0368802547f, -0.247823238f, 0.214669377f, -0.183359414f,
+    -0.192906022f, -0.155318975f, -0.0867256224f, -0.00559529662f, -0.0128545463f, -0.220921218f, 0.242349058f, 0.168065518f,
+    0.20767051f, 0.101830691f, 0.0509711802f, 0.225580722f, 0.00839942694f, 0.070995152f, -0.207109243f, 0.214235127f,
+    0.145361066f, 0.0351440609f, 0.0545051396f, 0.0534455478f, -0.110479206f, 0.0165974796f, -0.246141076f, 0.0203122199f,
+    0.243176073f, -0.154608697f, 0.0433269441f, 0.120066792f, 0.01111871f, 0.0814501047f, 0.177250654f, 0.154835582f,
+    -0.231966734f, -0.136476785f, 0.155501306f, -0.0906701684f, 0.116487235f, -0.0812864304f, 0.129750729f, -0.24333173f,
+    -0.134453237f, 0.230710208f, -0.021420151f, -0.207390547f, -0.162594765f, 0.222940981f, -0.014135778f, -0.0116004348f,
+    -0.14730984f, -0.167347699f, -0.0889519751f, 0.134052008f, -0.0149338543f, 0.0380203724f, -0.151128799f, -0.0605237186f,
+    0.0159696341f, -0.052485615f, 0.11389327f, 0.0545459986f, 0.0610006154f, -0.0818295777f, 0.223413199f, 0.151351571f,
+    0.100994796f, 0.197149932f, 0.235492319f, 0.0171943307f, -0.0776107907f, 0.174896568f, 0.189064413f, -0.0645548105f,
+    0.140224516f, 0.121557832f, 0.0382548869f, -0.161538303f, 0.213069081f, -0.186996967f, 0.110331059f, -0.0632432401f,
+    0.169412225f, -0.0882280171f, 0.0217285454f, 0.075202316f, 0.200419217f, -0.0171363056f, -0.206056446f, -0.122282296f,
+    -0.0281514525f, -0.146723151f, -0.174352497f, -0.185369074f, -0.137074053f, 0.0559282899f, -0.162165821f, -0.192657381f,
+    -0.188136011f, -0.156181008f, 0.106227964f, -0.181634575f, -0.0309393406f, 0.146234393f, -0.086830467f, 0.0278278887f,
+    0.23201701f, 0.0548803508f, 0.21770677f, 0.147981763f, -0.0831599236f, -0.0664435625f, -0.124928415f, 0.237000942f,
+    -0.126931906f, -0.0802648664f, -0.0212931335f, 0.148383886f, 0.169501454f, 0.0987207592f, -0.0158617795f, -0.184692353f,
+    0.191010952f, -0.202657789f, 0.173216671f, -0.100299627f, -0.235383034f, -0.138065547f, 0.0428620577f, -0.21808666f,
+    -0.207554311f, 0.203514636f, -0.0269761086f, -0.0751749575f, -0.231843323f, -0.2286686f, 0.101768523f, -0.240208417f,
+    0.0671055317f, -0.000797986984f, 0.185415864f, 0.158152938f, 0.188783914f, 0.227977276f, -0.0796340108f, 0.0590147376f,
+    0.109462917f, 0.179844469f, 0.152849376f, -0.215940595f, 0.243678838f, -0.0146476328f, 0.0143110752f, 0.0744603574f,
+    -0.161383718f, 0.142382503f, -0.138549984f, -0.135662824f, -0.131801873f, -0.217961133f, 0.159345984f, -0.133745819f,
+    0.173548937f, 0.0454804897f, 0.140575171f, 0.0410498679f, -0.171031237f, -0.00892215967f, -0.0635597408f, -0.176865041f,
+    0.0928437114f, -0.0522407591f, 0.228486419f, 0.229198188f, -0.243195742f, 0.0640297532f, 0.0762433112f, 0.0727613866f,
+    -0.128548473f, -0.109778166f, 0.108232617f, -0.00156182051f, 0.0964408219f, 0.172141373f, 0.119086951f, 0.144788563f,
+    0.147577733f, -0.107723713f, -0.216537923f, -0.0090650022f, -0.203261346f, -0.11397481f, 0.14934653f, 0.241789132f,
+    -0.00411534309f, 0.142055482f, 0.0689751804f, -0.00340330601f, 0.0919267237f, -0.182861984f, -0.0704208016f, -0.218673885f,
+    -0.233664304f, 0.139696151f, -0.136200279f, -0.0199472308f, -0.239232749f, 0.0696333349f, -0.0156659186f, -0.136820018f,
+    -0.0310309529f, -0.161326468f, 0.174817026f, -0.0370221734f, -0.0254025459f, 0.223453015f, 0.167358726f, 0.216681302f,
+    -0.084100455f, -0.063336134f, -0.216716737f, 0.121490747f, -0.07687971f, -0.0213090181f, 0.234185606f, -0.109021634f,
+    0.178232163f, 0.211627275f, 0.0860857368f, -0.178147882f, 0.126075864f, 0.225017011f, 0.24241671f, -0.0100524127f,
+    0.189882606f, -0.164002389f, -0.247514129f, -0.0414471626f, 0.0932691693f, 0.111396194f, -0.146894991f, -0.0465992689f,
+    -0.0435448885f, -0.134845585f, -0.12078619f, 0.201853931f, -0.183668554f, -0.24390462f, 0.233832985f, 0.139597982f,
+    0.0412328541f, 0.245502263f, 0.102138579f, -0.0477994382f, 0.135600537f, -0.172982961f, 0.00248512626f, -0.112466484f,
+    -0.201291591f, -0.121250033f, 0.199286073f, 0.198765576f, 0.2414518f, 0.0967621505f, 0.204539776f, 0.111731529f,
+    -0.164140314f, 0.248672694f, -0.171166331f, -0.133237332f, -0.0483429134f, 0.238030642f, -0.0849983394f, -0.222344637f,
+    -0.0066331327f, -0.233572811f, 0.123544902f, -0.222460181f, 0.0697687268f, -0.0123900175f, 0.0280222297f, -0.0524124503f,
+    -0.0469801128f, -0.101072758f, -0.212680638f, 0.240756273f, 0.0553659797f, 0.212416291f, 0.0641429424f, 0.213965982f,
+    0.0160144866f, -0.2280038f, 0.228834897f, -0.0100211501f, 0.203052133f, 0.0220304132f, 0.0373506546f, 0.0645537972f,
+    -0.111454099f, -0.0497357249f, -0.104298115f, -0.192742586f, -0.0433729291f, -0.103295177f, -0.150757253f, 0.102887988f,
+    0.214021593f, 0.00850203633f, -0.196735948f, -0.236037552f, 0.208666712f, -0.144200623f, -0.230433315f, -0.0859250724f,
+    0.110657245f, 0.186336279f, 0.220079452f, 0.136651933f, 0.0676933229f, 0.211482078f, -0.171408117f, -0.116087914f,
+    0.194381088f, -0.114958912f, 0.0869511664f, -0.246777415f, -0.0820962787f, -0.0984348059f, -0.0456097424f, 0.0994789302f,
+    -0.237731218f, -0.10671857f, 0.228799641f, 0.152182668f, -0.167642713f, 0.0687302053f, 0.179529309f, -0.0382055044f,
+    0.0697013736f, 0.0717984736f, 0.10157308f, 0.160199553f, -0.197107434f, 0.0301805735f, 0.131773889f, -0.0981427133f,
+    -0.112856567f, 0.206296474f, -0.173853725f, 0.190529227f, -0.214300066f, -0.107685f, -0.181261241f, 0.156696379f,
+    -0.117060453f, -0.245780975f, 0.00745514035f, 0.0371325612f, 0.165896595f, 0.127604514f, -0.046475172f, -0.0528604984f,
+    -0.0892128646f, -0.0185310543f, 0.222866356f, 0.0947204828f, -0.0164387226f, 0.171824127f, 0.0119506121f, -0.131913811f,
+    -0.145847291f, 0.135000229f, 0.225566506f, -0.179240972f, -0.0649995208f, -0.0863514841f, 0.209479421f, -0.142540127f,
+    0.0286946595f, -0.0818223655f, -0.239347756f, -0.068080008f, 0.136015683f, 0.22877118f, 0.049218148f, -0.232408971f,
+    0.00446075201f, 0.120586812f, 0.1517784f, 0.134926468f, -0.0231080949f, -0.0769499838f, 0.0796253383f, -0.0377426445f,
+    -0.00188907981f, -0.107646734f, 0.127639115f, -0.187651873f, 0.0603596568f, -0.213010728f, -0.061283201f, 0.229366273f,
+    0.01736027f, 0.0571705699f, -0.0752951205f, 0.191616178f, 0.0704564154f, 0.155055165f, 0.211330205f, -0.168364882f,
+    -0.00566285849f, -0.239925027f, -0.175082177f, 0.0518721342f, 0.240749896f, -0.0878238082f, -0.0822615325f, 0.142320752f,
+    -0.174557239f, -0.0814427435f, 0.106356144f, -0.0451226234f, -0.070604682f, 0.0039922297f, -0.0845921636f, -0.105229735f,
+    0.144083589f, 0.204562575f, 0.219960511f, -0.0883618593f, -0.0525168777f, 0.0911129713f, 0.235070914f, 0.130237013f,
+    0.00642448664f, -0.237689197f, 0.246202916f, 0.0552145541f, 0.140246481f, -0.171622783f, -0.128900886f, -0.174886465f,
+    0.109210581f, -0.121125549f, -0.0903259218f, -0.1302405f, -0.229998171f, -0.0229161978f, 0.128705233f, -0.0110516548f,
+    -0.0246966183f, 0.0324683487f, 0.226266533f, -0.0326460004f, 0.0146758556f, -0.189479381f, 0.12917465f, 0.0750490129f,
+    0.231528759f, 0.0138976276f, 0.153240502f, 0.245352268f, -0.0665643513f, 0.0819131136f, 0.152868897f, -0.235334098f,
+    -0.162294239f, -0.246181041f, -0.161043912f, 0.0314779282f, 0.189985335f, -0.0267832279f, 0.113226861f, 0.124435216f,
+    -0.113116354f, 0.245094031f, 0.0785861313f, 0.21032992f, -0.164631158f, -0.0386004746f, -0.0229396224f, -0.156581998f,
+    -0.0239808857f, 0.185330749f, -0.0253777206f, 0.103811443f, -0.248878419f, -0.249443591f, -0.179685771f, 0.031658709f,
+    -0.0397340059f, 0.165264904f, 0.0732496679f, 0.137720376f, 0.179668128f, 0.0210846663f, -0.183462232f, 0.241515785f,
+    -0.00856480002f, -0.214402229f, -0.21776852f, 0.182563812f, 0.0750104785f, -0.0212312341f, -0.196914911f, -0.136331737f,
+    -0.126188725f, -0.0291323364f, -0.170788974f, -0.168999732f, 0.232556969f, -0.0272296667f, -0.232353985f, 0.0475907326f,
+    -0.0651154816f, 0.0329251289f, 0.0138078928f, -0.223673791f, 0.100379258f, -0.0520330667f, 0.098708868f, -0.188475132f,
+    -0.0938921273f, -0.00199326873f, 0.0675238371f, -0.227871627f, 0.127174675f, -0.241581202f, 0.138308614f, 0.170948505f,
+    0.208597034f, -0.0912677944f, 0.0565315485f, -0.0698714852f, -0.0291372538f, -0.11829859f, -0.0472949445f, -0.212845951f,
+    0.167322874f, 0.135334849f, 0.176963806f, 0.19313094f, -0.208189368f, -0.224918157f, -0.235852391f, -0.0100522339f,
+    0.190196812f, -0.051546067f, -0.183557808f, 0.162297547f, -0.0529970229f, 0.0576451123f, -0.0981086791f, 0.0544288158f,
+    -0.227272242f, 0.171372503f, 0.109941185f, 0.217098624f, 0.23982805f, 0.0908225477f, 0.150251031f, -0.140654534f,
+    0.171770483f, -0.0720697939f, -0.230396092f, -0.098176986f, 0.175176412f, 0.166721821f, 0.123369277f, 0.0425569713f,
+    0.142830521f, -0.0969548225f, 0.183773547f, 0.128688693f, -0.0116274357f, 0.0150345564f, 0.102518737f, 0.138458252f,
+    0.246082515f, -0.093195796f, -0.040443033f, 0.129988343f, 0.249709219f, -0.141019523f, -0.0102328956f, 0.0301458836f,
+    0.128538281f, 0.106610268f, 0.229495525f, 0.177846044f, -0.132226616f, -0.246281892f, 0.242105156f, 0.136431873f,
+    -0.21830073f, 0.00415822864f, -0.0302430987f, -0.135485262f, 0.0322695076f, 0.139719844f, -0.032440573f, 0.177302957f,
+    -0.202546746f, -0.146242648f, 0.211345077f, 0.223140895f, 0.244256407f, 0.0877425075f, 0.124383777f, -0.006169945f,
+    0.209947199f, -0.175276369f, -0.00675374269f, -0.0687817633f, 0.0558286607f, -0.0925249159f, 0.230159283f, -0.148850709f,
+    0.00911217928f, 0.201446712f, 0.115558475f, -0.00210109353f, -0.121536881f, 0.181801975f, -0.0203334987f, 0.074775219f,
+    -0.12688154f, 0.162170947f, 0.110864341f, -0.100312203f, -0.106840402f, 0.106983751f, 0.182220221f, 0.227355748f,
+    -0.00280189514f, -0.141073048f, -0.0719155371f, 0.167841852f, 0.00228977203f, 0.109522343f, -0.133733392f, -0.138803869f,
+    -0.154592395f, -0.0463877916f, 0.244340658f, 0.158685535f, -0.165913433f, -0.0963582993f, -0.137770981f, 0.216005206f,
+    0.0588569641f, 0.0712898672f, -0.222429723f, -0.0211822987f, -0.0707556903f, -0.175001323f, 0.0144937336f, 0.0956808329f,
+    0.233596951f, -0.23539862f, 0.162078857f, 0.102768511f, 0.151054114f, 0.162174106f, -0.227334857f, -0.149331868f,
+    0.0979347527f, 0.0855656266f, -0.24756518f, -0.21826908f, 0.187848032f, -0.0296979547f, 0.00607964396f, 0.126065135f,
+    -0.234102428f, -0.223608255f, -0.0375517011f, 0.00694957376f, -0.182845116f, -0.086209178f, -0.0177249908f, -0.00730910897f,
+    0.234502077f, 0.0893400013f, -0.0858833492f, -0.0669176877f, -0.218393892f, -0.218446761f, 0.101780295f, 0.120546848f,
+    -0.0333956778f, 0.148298115f, 0.0858636498f, -0.228323936f, -0.0874195993f, 0.0593188703f, -0.14946115f, 0.0737503767f,
+    -0.14379102f, -0.0784445405f, 0.159686953f, -0.000693678856f, 0.127928734f, -0.112457961f, 0.145625412f, -0.137016654f,
+    0.249555141f, 0.042193532f, 0.0103471577f, -0.212284565f, 0.19720149f, -0.157601893f, 0.0740979016f, -0.0478100777f,
+    0.0129575133f, 0.248104393f, -0.0586515665f, 0.163136184f, -0.190516323f, -0.180479288f, -0.0835260153f, 0.00480145216f,
+    -0.162942082f, -0.216993421f, 0.0203663707f, 0.0192033947f, -0.238657266f, -0.198131561f, 0.233549505f, -0.0655064285f,
+    -0.133783162f, 0.0472482145f, -0.0340364575f, -0.149228245f, 0.104050636f, -0.169547766f, 0.0399670601f, 0.00535184145f,
+    0.0291385651f, 0.20183897f, 0.183032423f, 0.0424020588f, -0.15473488f, -0.115706116f, -0.170778513f, 0.151269823f,
+    0.218158841f, 0.230846792f, -0.112918466f, 0.0918370783f, 0.220052749f, -0.241484672f, -0.0900034904f, 0.229466707f,
+    0.036480993f, -0.145219445f, 0.0537102222f, 0.143853962f, 0.0197154284f, 0.239941686f, 0.0937547684f, -0.0238490105f,
+    0.146095067f, 0.248091638f, 0.0716420412f, 0.104795694f, 0.102552712f, -0.0284610689f, -0.185967088f, -0.153790236f,
+    -0.221798033f, -0.23537153f, -0.154666156f, -0.0885116458f, -0.0111194849f, 0.090741843f, 0.0998029411f, -0.23862499f,
+    0.109709769f, -0.142142653f, 0.212161541f, 0.110119492f, 0.0370880961f, 0.0844426155f, 0.00210380554f, -0.175807655f,
+    0.12164548f, 0.155424029f, 0.035708487f, 0.127397865f, -0.00143787265f, 0.0047967732f, 0.107505977f, -0.225665003f,
+    -0.172792077f, -0.184325695f, 0.248387337f, 0.0939906836f, -0.0196130872f, -0.0200847387f, 0.0752461553f, -0.0916290879f,
+    -0.133491695f, -0.0887697637f, 0.11615029f, -0.228433907f, 0.199224591f, -0.243782461f, 0.0482419431f, -0.0873540342f,
+    -0.223776698f, -0.0644139349f, -0.220566481f, 0.213623017f, 0.0797325969f, 0.197858751f, -0.0303350687f, 0.20983845f,
+    -0.221275181f, 0.161970735f, 0.131099671f, -0.103506565f, 0.24236387f, -0.0179344416f, 0.0959685445f, -0.129257739f,
+    -0.059689939f, -0.0786811411f, 0.161197901f, -0.0391384959f, -0.00132277608f, -0.119232297f, -0.166474611f, -0.244134426f,
+    -0.249466002f, -0.149055898f, -0.126957774f, 0.0594587028f, -0.24202019f, -0.0998548865f, 0.172596782f, -0.192911506f,
+    0.225987196f, 0.163628608f, -0.045397222f, 0.0804165006f, 0.135898709f, 0.0883651376f, -0.193001747f, 0.0350006819f,
+    0.236945331f, -0.202223212f, 0.14922601f, -0.0736468136f, -0.118989259f, 0.0247101486f, 0.235408574f, 0.159183621f,
+    -0.075996846f, 0.0723620355f, -0.219638526f, 0.163476229f, -0.148013681f, -0.0711607039f, 0.0419269204f, -0.0346279442f,
+    -0.0173814893f, 0.145041019f, -0.203576952f, -0.114228547f, 0.136629939f, -0.148498327f, -0.183529466f, 0.136916429f,
+    -0.0660434365f, 0.115028322f, 0.00790748f, 0.0378314853f, -0.141132563f, 0.00505796075f, 0.0483788252f, -0.112337112f,
+    -0.0767277479f, 0.187929541f, -0.128720105f, 0.203352541f, -0.210045159f, 0.225446075f, -0.202278465f, 0.0405288637f,
+    -0.189783096f, 0.140626162f, 0.0907925665f, 0.0232802927f, 0.233136535f, -0.0850209594f, -0.0880218744f, -0.0673965514f,
+    -0.246132851f, -0.215591967f, 0.192227751f, 0.2288436f, -0.0476078093f, 0.1516864f, -0.0898891985f, -0.234595656f,
+    -0.184711933f, -0.102748841f, -0.120475858f, -0.0698398054f, 0.0607119501f, 0.153625935f, -0.0128771067f, 0.101695031f,
+    0.228811234f, -0.212327361f, -0.0325879157f, 0.0446525812f, 0.181414604f, 0.140597105f, 0.0460294187f, -0.206880301f,
+    0.213203639f, 0.0589253008f, 0.0937510431f, 0.135115772f, -0.228212684f, 0.210228056f, 0.0556190312f, -0.0956455469f,
+    0.0743106008f, -0.0967389345f, 0.0075071156f, 0.132198066f, 0.017746985f, -0.242318779f, -0.189600855f, -0.170911402f,
+    0.0613899529f, -0.240092009f, -0.121933222f, -0.235904813f, 0.0510002375f, -0.109681934f, 0.152971536f, 0.0246550143f,
+    -0.00277298689f, -0.193125218f, -0.209788054f, -0.192317605f, -0.112410188f, -0.129702985f, 0.134169966f, 0.121937215f,
+    -0.138267994f, 0.161222488f, 0.174970895f, 0.241540015f, 0.0835689306f, -0.153366596f, -0.156832725f, -0.0152845979f,
+    0.0597088635f, -0.232116342f, -0.181314796f, 0.0306918919f, -0.200741649f, -0.232865661f, 0.123704523f, 0.203183353f,
+    0.0204505324f, -0.133907944f, 0.0747527778f, 0.0396025181f, -0.121976674f, -0.0872544348f, 0.13847971f, -0.168074906f,
+    -0.204083979f, 0.114289492f, 0.131169111f, -0.18372032f, -0.133961558f, -0.0652445555f, -0.0399853289f, 0.138111889f,
+    0.167364657f, 0.120856494f, 0.118176967f, 0.237490058f, 0.0838312507f, 0.160323232f, -0.0799075961f, 0.223513961f,
+    0.176106066f, -0.065694958f, 0.172085196f, 0.0356961489f, 0.159043163f, -0.221750468f, 0.179345518f, 0.0721482635f,
+    0.208267212f, -0.21023351f, 0.0220785439f, -0.0451599956f, -0.0610259175f, -0.0827022493f, -0.0802207589f, -0.172698408f
+}; // LSTM /lstm/LSTM recurrent weights [16, 64]
+alignas(16) static const float c22[64] = {
+    -0.356190264f, -0.342056453f, -0.261742175f, -0.0421338081f, 0.329950511f, 0.0839400589f, 0.187677801f, 0.00141185522f,
+    0.299974114f, -0.303693414f, -0.321533442f, 0.0782354176f, 0.152525663f, 0.209400356f, -0.327196866f, -0.172261119f,
+    -0.0444611311f, -0.223867238f, 0.163473338f, 0.0554797053f, 0.0307430029f, -0.300737292f, -0.311554462f, 0.0567185283f,
+    -0.00819560885f, 0.302031785f, -0.279247224f, -0.343637377f, 0.196381778f, -0.0704931319f, 0.153226733f, -0.0786719918f,
+    -0.0803013742f, 0.0225766003f, 0.0513580739f, 0.16082269f, -0.280621111f, -0.0165871978f, 0.0993163288f, 0.0495233834f,
+    0.0206391811f, -0.0632725656f, 0.129808247f, -0.182677239f, 0.0117845535f, 0.0501295626f, -0.176933408f, -0.302270949f,
+    -0.0208168924f, -0.231476992f, -0.124895006f, -0.00165012479f, -0.00926145911f, 0.12696144f, -0.0280189216f, 0.0608151257f,
+    -0.244641125f, -0.00954294205f, 0.162178099f, 0.00297793746f, 0.310232937f, 0.0194884837f, 0.324304342f, -0.051042527f
+}; // LSTM /lstm/LSTM input and recurrent biases, summed
+alignas(16) static float h23[16]; // LSTM /lstm/LSTM hidden state
+alignas(16) static float s24[16]; // LSTM /lstm/LSTM cell state
+alignas(16) static float t25[16]; // /dense/dense.1/Sigmoid_output_0 [1, 16]
+alignas(16) static const float c26[256] = {
+    -0.18251425f, 0.172992975f, 0.208126396f, 0.174564123f, -0.158441663f, -0.21657294f, 0.0382868946f, -0.00961515307f,
+    0.0744424164f, -0.172936916f, -0.146733344f, -0.0964880288f, -0.174191564f, 0.0949105322f, 0.109799683f, 0.230046421f,
+    0.0515142083f, -0.230967194f, -0.130495787f, -0.036524117f, -0.0362344086f, 0.0315625668f, -0.0207892954f, 0.11149013f,
+    0.224032938f, -0.145501494f, 0.246245027f, -0.163426042f, -0.197770476f, -0.224341929f, 0.067279309f, 0.238951862f,
+    0.038053751f, -0.0759219527f, -0.166829705f, 0.0134548247f, 0.147459179f, -0.16788125f, -0.117987901f, -0.2144517f,
+    0.0941815972f, 0.154064149f, 0.135323942f, -0.0872149169f, -0.238556743f, -0.200385928f, -0.00513157248f, -0.0156171024f,
+    0.0883687437f, -0.176865608f, -0.211859345f, -0.203514487f, 0.175647885f, 0.0457803607f, 0.102615684f, 0.0910868645f,
+    -0.135302663f, 0.125156134f, -0.0359793305f, 0.14866212f, -0.0475742221f, 0.0442182124f, -0.112011462f, 0.232054889f,
+    0.172359496f, 0.227568865f, 0.129218608f, 0.116557389f, 0.165551275f, 0.110148311f, -0.158713162f, 0.163840562f,
+    0.213908315f, 0.195251137f, 0.231138617f, -0.207768321f, 0.23594597f, 0.207790822f, -0.248171836f, -0.143837541f,
+    -0.126416266f, 0.0251113474f, -0.149516076f, -0.240404487f, 0.123195589f, -0.0187047422f, -0.234460264f, -0.0704045296f,
+    0.0831682682f, -0.0222317576f, -0.189880461f, 0.0187926888f, -0.168372005f, 0.0121914148f, 0.228585213f, 0.165613621f,
+    -0.243468583f, 0.181995571f, -0.217696667f, -0.0662285089f, -0.194234431f, -0.00482219458f, 0.123888344f, 0.233888745f,
+    -0.0261822045f, 0.20659706f, -0.175477505f, 0.219119757f, -0.184996307f, 0.0884879827f, 0.0142597258f, -0.0493480563f,
+    -0.185284495f, 0.125855237f, -0.0237030089f, 0.0976004601f, -0.0242131054f, 0.10418269f, -0.0180470347f, 0.134669393f,
+    -0.243514985f, 0.179170728f, -0.0577335954f, -0.0192470849f, -0.245937794f, 0.241510034f, -0.0263157785f, 0.160850167f,
+    -0.0574082136f, 0.230365783f, 0.116107047f, -0.0476495922f, -0.161791235f, 0.0270379186f, 0.101364195f, 0.225294143f,
+    0.0380365849f, 0.0402777195f, 0.197259784f, -0.0977343619f, -0.118036181f, 0.00331065059f, -0.0161120594f, -0.0745752752f,
+    0.0224620402f, 0.107094646f, -0.0539996028f, -0.211626351f, 0.150409162f, 0.193893075f, -0.0994066298f, 0.154625118f,
+    -0.200626791f, 0.03884691f, 0.241575867f, 0.161548376f, 0.0407688022f, -0.0353279412f, 0.0450345576f, -0.0887944698f,
+    -0.129846036f, -0.0454134643f, -0.249970496f, -0.0306475759f, -0.19846639f, -0.0583447516f, 0.0942771137f, 0.198141992f,
+    -0.235457212f, -0.142728299f, -0.0340572298f, -0.175710768f, -0.0787523687f, -0.0595490336f, -0.0997184217f, -0.0916627944f,
+    -0.141079396f, 0.0561284125f, -0.121216297f, 0.249144107f, -0.137833446f, 0.119437367f, -0.0153241158f, -0.0324971974f,
+    -0.120176554f, 0.0990998447f, -0.0972051024f, -0.147234589f, 0.0127272904f, -0.236217231f, -0.217410415f, 0.09328866f,
+    -0.0926902294f, -0.183748305f, 0.141150355f, 0.218891054f, 0.0776609778f, -0.089505434f, -0.0762743354f, 0.111622751f,
+    0.0122470558f, -0.0355571508f, 0.192970395f, 0.232135653f, 0.234567404f, -0.0298631191f, 0.021713376f, -0.00350117683f,
+    0.24555549f, 0.0145044625f, 0.221648216f, -0.0413882434f, -0.0653082728f, -0.131462902f, -0.0505286455f, 0.215702593f,
+    0.246360302f, -0.000769466162f, 0.0267108381f, 0.172077149f, 0.139579624f, -0.14666754f, -0.190214127f, -0.113428026f,
+    0.167698592f, 0.195280284f, -0.0951471031f, -0.22986111f, 0.0546251237f, -0.191075653f, -0.236575991f, 0.0810323656f,
+    -0.241174817f, -0.23827672f, 0.0579816699f, -0.0197745562f, -0.222201377f, -0.134697109f, -0.047183007f, -0.192611128f,
+    -0.207232922f, 0.158487171f, 0.13164562f, -0.201211482f, -0.10911411f, -0.0956729949f, 0.190363526f, 0.156727552f,
+    -0.0564491749f, -0.215811849f, -0.19151479f, 0.00561115146f, -0.0567214191f, 0.134102136f, 0.0699474812f, -0.130530775f
+}; // Gemm /dense/dense.0/Gemm weights [16, 16]
+alignas(16) static const float c27[16] = {
+    0.116286755f, -0.171924531f, -0.225860298f, 0.161814868f, 0.223000258f, -0.0438488424f, 0.13123402f, -0.166041613f,
+    0.0257660747f, 0.202516019f, 0.0966607034f, -0.0486370027f, 0.123899758f, 0.20498994f, -0.144360244f, -0.223771363f
+}; // Gemm /dense/dense.0/Gemm bias
+alignas(16) static const float c28[256] = {
+    -0.147836f, -0.14612487f, 0.196987987f, -0.0144709647f, -0.158363432f, 0.0609394014f, 0.196118534f, 0.174469709f,
+    -0.116317958f, 0.201478511f, -0.0290169716f, -0.10866943f, -0.155606389f, -0.151950866f, 0.138922691f, 0.0812273026f,
+    -0.0879385173f, -0.237679929f, 0.157128632f, 0.119484097f, 0.20243302f, 0.173723102f, 0.136087775f, 0.13439998f,
+    -0.129959404f, 0.121586174f, 0.234884083f, -0.0629392564f, 0.101218581f, 0.223246932f, 0.0489673615f, -0.180081755f,
+    -0.027334094f, 0.24631232f, -0.118208468f, 0.0662674904f, -0.0837632418f, -0.135056853f, 0.168318003f, 0.241611212f,
+    -0.111924738f, -0.0177102089f, 0.182662338f, 0.232409626f, 0.126940906f, -0.149985254f, 0.247453213f, -0.139518291f,
+    0.229620427f, 0.0814992487f, 0.203387111f, 0.0441421866f, -0.0521842539f, 0.116492778f, 0.175136924f, -0.0676672459f,
+    0.157681823f, 0.22585243f, 0.0564641654f, -0.0879365206f, 0.174470931f, -0.0171354115f, 0.149809957f, 0.19625631f,
+    -0.0817793906f, 0.173906118f, 0.226844758f, -0.201601416f, 0.117617458f, 0.1801745f, -0.188635975f, 0.198826194f,
+    0.0147620738f, -0.0351960659f, 0.216901213f, -0.230018944f, 0.242848128f, -0.0171043873f, -0.159028232f, 0.178120196f,
+    -0.00983759761f, 0.0107358992f, 0.0228824914f, 0.20451805f, 0.220080018f, -0.177113384f, 0.0254016519f, -0.00328511f,
+    -0.120616406f, 0.235690981f, 0.234411836f, 0.107480645f, 0.131345421f, 0.111465901f, -0.0367386639f, 0.203124374f,
+    -0.0861172974f, 0.150219172f, -0.0174614489f, 0.00692659616f, 0.0171572566f, 0.0629076362f, -0.230240732f, -0.115831196f,
+    -0.192710131f, -0.109618783f, -0.132468015f, -0.100127608f, -0.0523998737f, 0.107180208f, -0.157658756f, 0.159376234f,
+    -0.033013165f, -0.161035389f, -0.114708662f, 0.0494942963f, -0.192207813f, -0.135437876f, 0.192383587f, -0.209359735f,
+    0.137070268f, 0.123608977f, -0.0564500988f, -0.165548325f, 0.0847083032f, 0.104144007f, -0.0703641772f, -0.00268894434f,
+    0.163376898f, -0.0838225484f, 0.0251084864f, -0.0994624496f, -0.137551099f, -0.150480688f, -0.137778193f, -0.168672293f,
+    0.218925774f, 0.150117844f, -0.149531513f, -0.170304209f, -0.0848101676f, -0.0350566208f, 0.143181592f, -0.128946036f,
+    -0.0117967725f, 0.0457271039f, 0.115869164f, 0.184323609f, 0.0455231965f, 0.227978617f, 0.176706344f, -0.125000775f,
+    -0.231704235f, 0.045214057f, -0.0359877646f, -0.00443640351f, 0.0960551202f, -0.157715917f, -0.126118839f, 0.0955049098f,
+    -0.0834091604f, 0.201341867f, 0.20189032f, -0.00034609437f, 0.101105422f, 0.098942548f, -0.0474103689f, -0.157491744f,
+    0.222452283f, -0.23107332f, 0.0871624947f, 0.228601575f, -0.0606386662f, -0.241082907f, -0.176433891f, -0.0157181025f,
+    -0.0767270327f, -0.0103690624f, 0.165657669f, 0.132085323f, -0.0221912563f, -0.0774552226f, 0.0385813117f, -0.111549824f,
+    -0.0275962055f, 0.159258664f, 0.0533001721f, -0.105680883f, 0.00885424018f, -0.089544028f, 0.0414226949f, -0.190162867f,
+    0.216474414f, 0.0969544649f, 0.0584789813f, -0.118908405f, 0.0828039944f, 0.144020051f, 0.181066215f, 0.107690215f,
+    0.240370244f, -0.0187700391f, -0.249771178f, 0.198921829f, 0.0791190863f, -0.131448358f, -0.125646591f, -0.00263020396f,
+    0.00797465444f, -0.0167022049f, -0.175277293f, 0.188269377f, 0.0794201493f, 0.0505107045f, 0.0163984895f, 0.0302523375f,
+    0.0655480325f, 0.100800902f, 0.0992456973f, 0.0246418417f, -0.195097446f, -0.208391577f, 0.148443013f, 0.233297229f,
+    0.236632764f, 0.0794485807f, 0.22261259f, 0.0802635849f, 0.00453457236f, 0.0878430605f, 0.173260778f, -0.0411188304f,
+    0.00143375993f, 0.155352265f, -0.108017415f, -0.0863669217f, -0.0532624125f, -0.112104088f, 0.141471326f, 0.0921268761f,
+    -0.127552539f, -0.0120864213f, 0.173520297f, 0.154453009f, 0.0556276441f, -0.0642246902f, -0.0931504071f, 0.24574858f,
+    0.0811964273f, -0.103160292f, -0.0801627636f, -0.038749069f, 0.0458863676f, -0.0478686094f, 0.0623113513f, -0.143880606f
+}; // Gemm /dense/dense.2/Gemm weights [16, 16]
+alignas(16) static const float c29[16] = {
+    -0.047160387f, 0.0980077684f, -0.0563043654f, 0.0698121786f, 0.13159126f, 0.0551410615f, 0.224543273f, 0.111812353f,
+    0.126473457f, -0.156772017f, 0.165356964f, 0.0907627344f, 0.20551163f, 0.087588191f, -0.200520366f, 0.0764860213f
+}; // Gemm /dense/dense.2/Gemm bias
+
+void EDGenerated::run(const float *samples, const float *cond, float *output)
+{
+    // Gemm /cond_dense_h/Gemm [1, 3] x [3, 16]
+    {
+        const float *a = cond;
+        float *y = t1;
+        float acc[16];
+        for(int n=0; n<16; n++)
+            acc[n] = c3[n];
+        for(int k=0; k<3; k++)
+        {
+            const float ak = a[k];
+            for(int n=0; n<16; n++)
+                acc[n] += ak*c2[k*16 + n];
+        }
+        for(int n=0; n<16; n++)
+            y[n] = acc[n];
+    }
+    // Conv /state_h/Conv, 1 -> 1 channels, kernel 16, 16 -> 16 steps
+    {
+        for(int c=0; c<1; c++)
+            std::copy(samples + c*16, samples + (c+1)*16, p5 + c*31 + 7);
+        float acc[16];
+        for(int i=0; i<16; i++)
+            acc[i] = c7[i];
+        for(int b=0; b<1; b++)
+        {
+            for(int o=0; o<1; o++)
+            {
+                for(int c=0; c<1; c++)
+                {
+                    for(int k=0; k<16; k++)
+                    {
+                        const float w = c6[(o*1 + c)*16 + k];
+                        const float *x = p5 + (b*1 + c)*31 + k*1;
+                        float *yo = acc + (b*1 + o)*16;
+                        for(int t=0; t<16; t++)
+                            yo[t] += w*x[t*1];
+                    }
+                }
+            }
+        }
+        for(int i=0; i<16; i++)
+            t4[i] = acc[i];
+    }
+    // Gemm /cond_dense_c/Gemm [1, 3] x [3, 16]
+    {
+        const float *a = cond;
+        float *y = t8;
+        float acc[16];
+        for(int n=0; n<16; n++)
+            acc[n] = c10[n];
+        for(int k=0; k<3; k++)
+        {
+            const float ak = a[k];
+            for(int n=0; n<16; n++)
+                acc[n] += ak*c9[k*16 + n];
+        }
+        for(int n=0; n<16; n++)
+            y[n] = acc[n];
+    }
+    // Conv /state_c/Conv, 1 -> 1 channels, kernel 16, 16 -> 16 steps
+    {
+        for(int c=0; c<1; c++)
+            std::copy(samples + c*16, samples + (c+1)*16, p12 + c*31 + 7);
+        float acc[16];
+        for(int i=0; i<16; i++)
+            acc[i] = c14[i];
+        for(int b=0; b<1; b++)
+        {
+            for(int o=0; o<1; o++)
+            {
+                for(int c=0; c<1; c++)
+                {
+                    for(int k=0; k<16; k++)
+                    {
+                        const float w = c13[(o*1 + c)*16 + k];
+                        const float *x = p12 + (b*1 + c)*31 + k*1;
+                        float *yo = acc + (b*1 + o)*16;
+                        for(int t=0; t<16; t++)
+                            yo[t] += w*x[t*1];
+                    }
+                }
+            }
+        }
+        for(int i=0; i<16; i++)
+            t11[i] = acc[i];
+    }
+    // Add /Add
+    for(int i=0; i<16; i++)
+        t15[i] = t1[i] + t4[i];
+    // Add /Add_1
+    for(int i=0; i<16; i++)
+        t16[i] = t8[i] + t11[i];
+    // LSTM /lstm/LSTM, 1 steps of 1x16 -> 16
+    {
+        for(int i=0; i<16; i++)
+        {
+            h23[i] = t15[i];
+            s24[i] = t16[i];
+        }
+        for(int t=0; t<1; t++)
+        {
+            for(int b=0; b<1; b++)
+            {
+                const float *x = (samples + 16) + (t*1 + b)*16;
+                float *h = h23 + b*16;
+                float *c = s24 + b*16;
+                float gates[64];
+                for(int g=0; g<64; g++)
+                    gates[g] = c22[g];
+                for(int k=0; k<16; k++)
+                {
+                    const float xk = x[k];
+                    for(int g=0; g<64; g++)
+                        gates[g] += xk*c20[k*64 + g];
+                }
+                for(int k=0; k<16; k++)
+                {
+                    const float hk = h[k];
+                    for(int g=0; g<64; g++)
+                        gates[g] += hk*c21[k*64 + g];
+                }
+                for(int j=0; j<16; j++)
+                {
+                    float i = 1.0f/(1.0f + std::exp(-gates[j]));
+                    float o = 1.0f/(1.0f + std::exp(-gates[16 + j]));
+                    float f = 1.0f/(1.0f + std::exp(-gates[32 + j]));
+                    c[j] = f*c[j] + i*std::tanh(gates[48 + j]);
+                    h[j] = o*std::tanh(c[j]);
+                }
+                std::copy(h, h + 16, t17 + (t*1 + b)*16);
+            }
+        }
+        std::copy(h23, h23 + 16, t18);
+        std::copy(s24, s24 + 16, t19);
+    }
+    // Gemm /dense/dense.0/Gemm [1, 16] x [16, 16], fused Sigmoid
+    {
+        const float *a = t17;
+        float *y = t25;
+        float acc[16];
+        for(int n=0; n<16; n++)
+            acc[n] = c27[n];
+        for(int k=0; k<16; k++)
+        {
+            const float ak = a[k];
+            for(int n=0; n<16; n++)
+                acc[n] += ak*c26[k*16 + n];
+        }
+        for(int n=0; n<16; n++)
+            y[n] = 1.0f/(1.0f + std::exp(-acc[n]));
+    }
+    // Gemm /dense/dense.2/Gemm [1, 16] x [16, 16]
+    {
+        const float *a = t25;
+        float *y = output;
+        float acc[16];
+        for(int n=0; n<16; n++)
+            acc[n] = c29[n];
+        for(int k=0; k<16; k++)
+        {
+            const float ak = a[k];
+            for(int n=0; n<16; n++)
+                acc[n] += ak*c28[k*16 + n];
+        }
+        for(int n=0; n<16; n++)
+            y[n] = acc[n];
+    }
+}
@@ -0,0 +1,18 @@
+#ifndef ED_GENERATED_H_
+#define ED_GENERATED_H_
+
+// ED.onnx compiled ahead of time by tools/onnx_to_cpp.py, do not edit, regenerate it instead
+// inputs:  samples [1, 32], cond [1, 3]
+// outputs: output [1, 16]
+class EDGenerated
+{
+public:
+    static const int samplesSize = 32;
+    static const int condSize = 3;
+    static const int outputSize = 16;
+
+    // not reentrant, the intermediate tensors are static buffers of the translation unit
+    static void run(const float *samples, const float *cond, float *output);
+};
+
+#endif /* ED_GENERATED_H_ */
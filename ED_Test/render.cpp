@@ -5,9 +5,15 @@
 */
 
 #include "LDSP.h"
-#include "libraries/OrtModel/OrtModel.h"
-
-OrtModel model;
+#include "../common/OrtModelRT.h"
+#include "../common/RingBuffer.h"
+#include "../common/SmoothedParameter.h"
+#include "EDGenerated.h"
+#include <algorithm>
+#include <vector>
+
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+OrtModelRT::Options modelOptions; // session options, the default is a single thread that does not spin
 std::string modelType = "onnx";
 std::string modelName = "ED";
 
@@ -18,25 +24,74 @@ const int d = 4;
 float input[2*w] = {0};
 float params[d] = {0};
 float output[w] = {0};
+static_assert(EDGenerated::samplesSize == 2*w && EDGenerated::outputSize == w && EDGenerated::condSize <= d, "EDGenerated.cpp was generated for other shapes");
 
 int inputSize = 2*w;
 int outputSize = w;
 int inputCounter = 0;
 
-const int circBuffLength = 48000; // a reasonably large buffer, to limit end-of-buffer overhead
-int writePointer; 
-int readPointer;
-float circBuff[circBuffLength];
+// conditioning of the model, any control thread can change it with conditioning.set() or publish(),
+// it is ramped once per inference and written into the bound params, so the cost of inference does not change
+SmoothedParameterSet<d> conditioning;
+float conditioningRamp_ms = 50;
+
+// if true, each input channel goes through its own instance of the model, with all the channels in a single run as a batch
+// the model is derived with tools/make_model_variants.py ed-multichannel
+bool multichannelInference = false;
+std::string multichannelModelName = "ED_multichannel";
+OrtModelRT multichannelModel;
+const int maxChannels = 8;
+int numChannels = 1;
+std::vector<float> multichannelInput; // [channels, 2*w]
+std::vector<float> multichannelParams; // [channels, conditioning size], each channel can have its own
+int condSize = d;
+std::vector<float> multichannelOutput; // [channels, w]
+
+// if true, runs EDGenerated.cpp instead of ONNX Runtime, the model compiled ahead of time for these shapes by tools/onnx_to_cpp.py,
+// regenerate it if ED.onnx changes; ignored if multichannelInference is true
+bool generatedInference = false;
+
+RingBuffer<float> circBuff[maxChannels]; // input samples of each channel, only a few windows long
 
 
 bool setup(LDSPcontext *context, void *userData)
 {
-    std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
-        printf("unable to setup model");
+    if(multichannelInference)
+    {
+        numChannels = std::min({(int)context->audioInChannels, (int)context->audioOutChannels, maxChannels});
+        std::string modelPath = "./"+multichannelModelName+"."+modelType;
+        if(!multichannelModel.setup("session1", modelPath, modelOptions))
+        {
+            printf("unable to setup multichannel model\n");
+            return false;
+        }
+        condSize = multichannelModel.getInputShape(1).back();
+        multichannelInput.assign(numChannels*inputSize, 0);
+        multichannelParams.resize(numChannels*condSize);
+        for(int ch=0; ch<numChannels; ch++)
+            std::copy(params, params + std::min(condSize, d), multichannelParams.begin() + ch*condSize);
+        multichannelOutput.assign(numChannels*outputSize, 0);
+        if(!multichannelModel.bindInput(0, multichannelInput.data(), {numChannels, inputSize}) ||
+           !multichannelModel.bindInput(1, multichannelParams.data(), {numChannels, condSize}) ||
+           !multichannelModel.bindOutput(0, multichannelOutput.data(), {numChannels, outputSize}) || !multichannelModel.prepare())
+        {
+            printf("unable to setup multichannel model\n");
+            return false;
+        }
+    }
+    else if(!generatedInference)
+    {
+        std::string modelPath = "./"+modelName+"."+modelType;
+        if (!model.setup("session1", modelPath, modelOptions) || !model.bindInput(0, input) || !model.bindInput(1, params) || !model.bindOutput(0, output) || !model.prepare())
+            printf("unable to setup model");
+    }
+
+    std::array<float, d> initialParams;
+    std::copy(params, params + d, initialParams.begin());
+    conditioning.setup(initialParams, context->audioSampleRate, conditioningRamp_ms);
 
-    writePointer = w; // the first w samples must be zeros
-    readPointer = 0;
+    for(int ch=0; ch<numChannels; ch++)
+        circBuff[ch].setup(2*inputSize, w); // the first w samples must be zeros
 
     if(context->audioFrames % w)
         printf("Warning! Period size (%d) is supposed to be an integer multiple of the output size w (%d)!\n", context->audioFrames, outputSize);
@@ -48,42 +103,61 @@ void render(LDSPcontext *context, void *userData)
 {
     for(int n=0; n<context->audioFrames; n++)
 	{
-        circBuff[writePointer] = audioRead(context,n,0);
+        for(int ch=0; ch<numChannels; ch++)
+            circBuff[ch].push(audioRead(context,n,ch));
 
         // run inference every w inputs
         if( ++inputCounter == outputSize )
         {
             inputCounter = 0;
 
-            if(readPointer<=circBuffLength-inputSize)
-                std::copy(circBuff + readPointer, circBuff + readPointer + inputSize, input);
-            else 
+            const float *cond = conditioning.process(outputSize);
+            if(multichannelInference)
             {
-                int firstPartSize = circBuffLength - readPointer;
-                std::copy(circBuff + readPointer, circBuff + circBuffLength, input);
-                std::copy(circBuff, circBuff + (inputSize - firstPartSize), input + firstPartSize);
+                // the same conditioning for all the channels
+                for(int ch=0; ch<numChannels; ch++)
+                    std::copy(cond, cond + std::min(condSize, d), multichannelParams.data() + ch*condSize);
+                for(int ch=0; ch<numChannels; ch++)
+                    std::copy(circBuff[ch].window(), circBuff[ch].window() + inputSize, multichannelInput.data() + ch*inputSize);
+
+                multichannelModel.run(); // outputs a block of w samples per channel
+
+                for(int ch=0; ch<numChannels; ch++)
+                {
+                    const float *channelInput = multichannelInput.data() + ch*inputSize;
+                    // passthrough test, because the model may not be trained
+                    for(int out=0; out<outputSize; out++)
+                        audioWrite(context, n-outputSize+1+out, ch, channelInput[outputSize+out]);
+                    circBuff[ch].advance(outputSize);
+                }
             }
-
-            model.run(input, params, output); // outputs a block of w samples
-            
-            for(int out=0; out<outputSize; out++)
+            else
             {
-                // passthrough test, because the model may not be trained
-                audioWrite(context, n-outputSize+1+out, 0, input[outputSize+out]);
-                audioWrite(context, n-outputSize+1+out, 1, input[outputSize+out]);
+                std::copy(circBuff[0].window(), circBuff[0].window() + inputSize, input);
+                std::copy(cond, cond + d, params);
+
+                if(generatedInference)
+                    EDGenerated::run(input, params, output); // outputs a block of w samples
+                else
+                    model.run(); // outputs a block of w samples
+                
+                for(int out=0; out<outputSize; out++)
+                {
+                    // passthrough test, because the model may not be trained
+                    audioWrite(context, n-outputSize+1+out, 0, input[outputSize+out]);
+                    audioWrite(context, n-outputSize+1+out, 1, input[outputSize+out]);
+                }
+
+                circBuff[0].advance(outputSize);
             }
-
-            readPointer += outputSize;
-            if( readPointer >= circBuffLength)
-                readPointer -= circBuffLength;
         }
-        
-        if(++writePointer >= circBuffLength)
-            writePointer = 0;
 	}
 }
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-    model.cleanup();
+    if(multichannelInference)
+        multichannelModel.cleanup();
+    else if(!generatedInference)
+        model.cleanup();
 }
\ No newline at end of file
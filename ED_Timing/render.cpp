@@ -5,12 +5,24 @@
 */
 
 #include "LDSP.h"
-#include "libraries/OrtModel/OrtModel.h"
-#include <fstream>
-
-OrtModel model;
+#include "../common/OrtModelRT.h"
+#include "../common/RingBuffer.h"
+#include "../common/SmoothedParameter.h"
+#include <chrono>
+#include "../common/LatencyHistogram.h"
+#include "../common/DeadlineMonitor.h"
+#include "../common/TimingLogWriter.h"
+#include "EDGenerated.h"
+
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+OrtModelRT::Options modelOptions; // session options, the default is a single thread that does not spin
 std::string modelType = "onnx";
 std::string modelName = "ED";
+// if true, loads the int8 variant <modelName>_int8.onnx, produced and qualified by tools/quantize_models.py
+bool quantizedModel = false;
+// if true, times EDGenerated.cpp instead of ONNX Runtime, the model compiled ahead of time for these shapes by tools/onnx_to_cpp.py,
+// regenerate it if ED.onnx changes; it is always the float model, so quantizedModel only changes the name of the log
+bool generatedInference = false;
 
 const int w = 16;
 const int u = 64;
@@ -19,73 +31,92 @@ const int d = 4;
 float input[2*w] = {0};
 float params[d] = {0};
 float output[w] = {0};
+static_assert(EDGenerated::samplesSize == 2*w && EDGenerated::outputSize == w && EDGenerated::condSize <= d, "EDGenerated.cpp was generated for other shapes");
 
 int inputSize = 2*w;
 int outputSize = w;
 int inputCounter = 0;
 
-const int circBuffLength = 48000; // a reasonably large buffer, to limit end-of-buffer overhead
-int writePointer; 
-int readPointer;
-float circBuff[circBuffLength];
+// conditioning of the model, any control thread can change it with conditioning.set() or publish(),
+// it is ramped once per inference and written into the bound params, so the cost of inference does not change
+SmoothedParameterSet<d> conditioning;
+float conditioningRamp_ms = 50;
+
+RingBuffer<float> circBuff; // input samples, only a few windows long
 
 //--------------------------------
 
-unsigned long long * inferenceTimes;
-int logPtr = 0;
+std::string timingLogDir = ".";
+TimingLogWriter timingLog; // streams inference times to a binary file
+long long logCnt = 0;
 constexpr int testDuration_sec = 10;
-int numLogs;
+long long numLogs;
+LatencyHistogram inferenceHistogram; // nanoseconds
+
+float deadlineBudgetFraction = 0.75; // callbacks longer than this fraction of the period duration count as deadline misses
+DeadlineMonitor deadlineMonitor; // times the whole render() callback
+int maxStoredMisses = 4096; // further misses are counted, but their indices are not stored
 
 
 bool setup(LDSPcontext *context, void *userData)
 {
+    if(quantizedModel)
+        modelName += "_int8";
+
     std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
+    if (!generatedInference && (!model.setup("session1", modelPath, modelOptions) || !model.bindInput(0, input) || !model.bindInput(1, params) || !model.bindOutput(0, output) || !model.prepare()))
         printf("unable to setup model");
 
-    writePointer = w; // the first w samples must be zeros
-    readPointer = 0;
+    std::array<float, d> initialParams;
+    std::copy(params, params + d, initialParams.begin());
+    conditioning.setup(initialParams, context->audioSampleRate, conditioningRamp_ms);
+
+    circBuff.setup(2*inputSize, w); // the first w samples must be zeros
 
     if(context->audioFrames % w)
         printf("Warning! Period size (%d) is supposed to be an integer multiple of the output size w (%d)!\n", context->audioFrames, outputSize);
 
     //--------------------------------
-    inferenceTimes = new unsigned long long[context->audioSampleRate*testDuration_sec*1.01];
     numLogs = context->audioSampleRate*testDuration_sec / outputSize; // division to handle case of models outputting a block of samples
+    std::string timingLogFileName = "inferenceTiming_"+modelName+"_out"+std::to_string(outputSize)+(generatedInference ? "_generated.tlog" : "_onnx.tlog");
+    if(!timingLog.setup(timingLogDir+"/"+timingLogFileName, modelName, context->audioSampleRate, context->audioFrames, outputSize))
+        return false;
+    deadlineMonitor.setup(context->audioFrames, context->audioSampleRate, deadlineBudgetFraction, maxStoredMisses);
 
     return true;
 }
 
 void render(LDSPcontext *context, void *userData)
 {
+    deadlineMonitor.beginPeriod();
+
     for(int n=0; n<context->audioFrames; n++)
 	{
-        circBuff[writePointer] = audioRead(context,n,0);
+        circBuff.push(audioRead(context,n,0));
 
         // run inference every w inputs
         if( ++inputCounter == outputSize )
         {
             inputCounter = 0;
 
-            if(readPointer<=circBuffLength-inputSize)
-                std::copy(circBuff + readPointer, circBuff + readPointer + inputSize, input);
-            else 
-            {
-                int firstPartSize = circBuffLength - readPointer;
-                std::copy(circBuff + readPointer, circBuff + circBuffLength, input);
-                std::copy(circBuff, circBuff + (inputSize - firstPartSize), input + firstPartSize);
-            }
+            std::copy(circBuff.window(), circBuff.window() + inputSize, input);
+            const float *cond = conditioning.process(outputSize);
+            std::copy(cond, cond + d, params);
 
             // Start the Clock
-            auto start_time = std::chrono::high_resolution_clock::now();
+            auto start_time = std::chrono::steady_clock::now();
 
-            model.run(input, params, output); // outputs a block of w samples
+            if(generatedInference)
+                EDGenerated::run(input, params, output); // outputs a block of w samples
+            else
+                model.run(); // outputs a block of w samples
 
             // Stop the clock  
-            auto end_time = std::chrono::high_resolution_clock::now();
-            inferenceTimes[logPtr] = std::chrono::duration_cast
-                                    <std::chrono::microseconds>(end_time - start_time).count();
-            logPtr++;
+            auto end_time = std::chrono::steady_clock::now();
+            unsigned long long inferenceTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+            inferenceHistogram.record(inferenceTime);
+            timingLog.push(inferenceTime);
+            logCnt++;
             
             for(int out=0; out<outputSize; out++)
             {
@@ -94,33 +125,23 @@ void render(LDSPcontext *context, void *userData)
                 audioWrite(context, n-outputSize+1+out, 1, input[outputSize+out]);
             }
 
-            readPointer += outputSize;
-            if( readPointer >= circBuffLength)
-                readPointer -= circBuffLength;
+            circBuff.advance(outputSize);
         }
-        if(++writePointer >= circBuffLength)
-            writePointer = 0;
         
-        if(logPtr>=numLogs)
+        if(logCnt>=numLogs)
             LDSP_requestStop();
 	}
+
+    deadlineMonitor.endPeriod();
 }
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-    std::string timingLogDir = ".";
-    std::string timingLogFileName = "inferenceTiming_"+modelName+"_out"+std::to_string(outputSize)+"_onnx.txt";
-    std::string timingLogFilePath = timingLogDir+"/"+timingLogFileName;
-
-    std::ofstream logFile(timingLogFilePath);
-    if(logFile.is_open())
-    {
-        for (int i=0;i<numLogs; i++)
-            logFile << std::to_string(inferenceTimes[i]) << "\n";
-    }
-    logFile.close();
-
-    delete[] inferenceTimes;
+    inferenceHistogram.printReport(("inference "+modelName).c_str());
+    deadlineMonitor.printReport(("render "+modelName).c_str());
+
+    timingLog.cleanup();
     
-    model.cleanup();
+    if(!generatedInference)
+        model.cleanup();
 }
\ No newline at end of file
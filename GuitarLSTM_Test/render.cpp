@@ -6,9 +6,13 @@
 */
 
 #include "LDSP.h"
-#include "libraries/OrtModel/OrtModel.h"
+#include "../common/OrtModelRT.h"
+#include "../common/RingBuffer.h"
+#include "../common/NativeAmpModels.h"
+#include <vector>
 
-OrtModel model;
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+OrtModelRT::Options modelOptions; // session options, the default is a single thread that does not spin
 std::string modelType = "onnx";
 std::string modelName = "GuitarLSTM";
 
@@ -17,21 +21,54 @@ const int inputSize = 5;
 float input[inputSize] = {0};
 float output[1] = {0};
 
-const int circBuffLength = 48000; // a reasonably large buffer, to limit end-of-buffer overhead
-int writePointer;
-int readPointer;
-float circBuff[circBuffLength];
+// if true, the whole period goes through a single run, as a batch of audioFrames overlapping windows taken from circBuff
+// the original model already has a dynamic batch axis, and each window gives the same output as when run on its own
+bool blockInference = false;
+OrtModelRT blockModel;
+std::vector<float> blockInput; // [frames, inputSize, 1]
+std::vector<float> blockOutput;
+
+// if true, runs the conv, LSTM and dense layers of common/NativeAmpModels.h instead of ONNX Runtime, with the weights of modelName,
+// so that there is no runtime call per sample; same computation as the original model, restarting from zero state at every window
+// ignored if blockInference is true
+bool nativeInference = false;
+NativeGuitarLSTM nativeModel;
+
+RingBuffer<float> circBuff; // input samples, only a few windows long
 
 
 bool setup(LDSPcontext *context, void *userData)
 {
 
-    std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
-        printf("unable to setup model");
+    if(blockInference)
+    {
+        blockInput.assign(context->audioFrames*inputSize, 0);
+        blockOutput.assign(context->audioFrames, 0);
+        std::string modelPath = "./"+modelName+"."+modelType;
+        if(!blockModel.setup("session1", modelPath, modelOptions) || !blockModel.bindInput(0, blockInput.data(), {context->audioFrames, inputSize, 1}) ||
+           !blockModel.bindOutput(0, blockOutput.data(), {context->audioFrames, 1}) || !blockModel.prepare())
+        {
+            printf("unable to setup block model\n");
+            return false;
+        }
+    }
+    else if(nativeInference)
+    {
+        std::string modelPath = "./"+modelName+"."+modelType;
+        if(!nativeModel.setup(modelPath))
+        {
+            printf("unable to setup native model\n");
+            return false;
+        }
+    }
+    else
+    {
+        std::string modelPath = "./"+modelName+"."+modelType;
+        if (!model.setup("session1", modelPath, modelOptions) || !model.bindInput(0, input) || !model.bindOutput(0, output) || !model.prepare())
+            printf("unable to setup model");
+    }
 
-    writePointer = inputSize-1; // the first intputSize-1 samples must be zeros
-    readPointer = 0;
+    circBuff.setup(2*inputSize, inputSize-1); // the first inputSize-1 samples must be zeros
 
     return true;
 }
@@ -40,31 +77,35 @@ void render(LDSPcontext *context, void *userData)
 {
     for(int n=0; n<context->audioFrames; n++)
 	{
-        circBuff[writePointer] = audioRead(context,n,0);
+        circBuff.push(audioRead(context,n,0));
 
-        if(readPointer<=circBuffLength-inputSize)
-            std::copy(circBuff + readPointer, circBuff + readPointer + inputSize, input);
-        else 
-        {
-            int firstPartSize = circBuffLength - readPointer;
-            std::copy(circBuff + readPointer, circBuff + circBuffLength, input);
-            std::copy(circBuff, circBuff + (inputSize - firstPartSize), input + firstPartSize);
-        }
+        // in block mode, each window goes to its own slot of the batch
+        float *window = blockInference ? blockInput.data() + n*inputSize : input;
+
+        std::copy(circBuff.window(), circBuff.window() + inputSize, window);
 
-        model.run(input, output);
+        if(nativeInference && !blockInference)
+            nativeModel.run(window, output);
+        else if(!blockInference)
+            model.run();
     
         // passthrough test, because the model may not be trained
-        audioWrite(context, n, 0, input[inputSize-1]);
-        audioWrite(context, n, 1, input[inputSize-1]);
+        audioWrite(context, n, 0, window[inputSize-1]);
+        audioWrite(context, n, 1, window[inputSize-1]);
 
-        if(++readPointer >= circBuffLength)
-            readPointer = 0;
-        if(++writePointer >= circBuffLength)
-            writePointer = 0;	
+        circBuff.advance(1);
     }
+
+    if(blockInference)
+        blockModel.run();
 }
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-    model.cleanup();
+    if(blockInference)
+        blockModel.cleanup();
+    else if(nativeInference)
+        nativeModel.cleanup();
+    else
+        model.cleanup();
 }
\ No newline at end of file
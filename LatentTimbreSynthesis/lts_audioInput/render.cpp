@@ -1,74 +1,151 @@
 #include "LDSP.h"
-#include <libraries/OrtModel/OrtModel.h>
-#include <libraries/AudioFile/AudioFile.h>
+#include "../../common/StreamingAudioFile.h"
+#include "../../common/OrtModelRT.h"
+#include "../../common/EncodedSourceCache.h"
 
-OrtModel model(true);
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+// session options, the model is split across several threads; prepare() warms it up with modelOptions.warmupRuns runs
+OrtModelRT::Options modelOptions = OrtModelRT::Options::largeModel();
 std::string modelType = "onnx";
 std::string modelName = "audioInput_rawvae";
 
 const int segment_size = 1024;
 
-float* inputs[3];
 float output[segment_size] = {0};
 
 float interpolation = 0.5;
 
 std::string filename[2] = {"472451__erokia__msfxp-sound-399.wav", "472454__erokia__msfxp-sound-402.wav"};	// name of the sound files (in project folder)
-std::vector<float> audioFileSamples[2];
-int readPointer[2] = {0};
-std::vector<float> audioInput[2];
+StreamingAudioFile audioFiles[2]; // streamed in a loop by a background thread, see common/StreamingAudioFile.h
+std::vector<float> audioInput[2]; // bound to the model
 
 int outputSampleCnt = 0;
 
 bool liveInput = false;
 
-bool setup(LDSPcontext *context, void *userData)
+// if true, the model is split into an encoder and a decoder, derived with tools/make_model_variants.py rawvae-encoder,
+// the decoder being the latentInput model
+// the latents of the file sources are encoded the first time each of their segments is played and then kept,
+// so from the second loop of the files on only the decoder runs, and only live input goes through the encoder every time
+// once a file is fully encoded, its streaming thread and ring are released
+// the encoder and the decoder are set up with modelOptions, as the whole model
+bool encodeOnce = false;
+std::string encoderModelName = "encoder_rawvae";
+std::string decoderModelName = "latentInput_rawvae";
+OrtModelRT encoder;
+OrtModelRT decoder;
+const int latent_dim = 256;
+EncodedSourceCache encodedSources[2];
+std::vector<float> encoderInput; // [segment_size]
+std::vector<float> encoderOutputs[2]; // mu and logvar
+std::vector<float> decoderInputs[4]; // mu and logvar of the first source, then of the second
+float decoderInterpolation;
+
+bool setupSplitModel()
 {
-    std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
-    {
-        printf("unable to setup ortModel");
+    encoderInput.assign(segment_size, 0);
+    for(auto &buffer : encoderOutputs)
+        buffer.assign(latent_dim, 0);
+    for(auto &buffer : decoderInputs)
+        buffer.assign(latent_dim, 0);
+
+    if(!encoder.setup("session1", "./"+encoderModelName+"."+modelType, modelOptions) || encoder.getNumOutputs() < 2 ||
+       !encoder.bindInput(0, encoderInput.data()) || !encoder.bindOutput(0, encoderOutputs[0].data()) ||
+       !encoder.bindOutput(1, encoderOutputs[1].data()) || !encoder.prepare())
         return false;
+    if(!decoder.setup("session2", "./"+decoderModelName+"."+modelType, modelOptions) || decoder.getNumInputs() != 5)
+        return false;
+    for(int i=0; i<4; i++)
+    {
+        if(!decoder.bindInput(i, decoderInputs[i].data()))
+            return false;
     }
+    if(!decoder.bindInput(4, &decoderInterpolation) || !decoder.bindOutput(0, output) || !decoder.prepare())
+        return false;
 
+    for(int s=0; s<2; s++)
+    {
+        if(!encodedSources[s].setup(audioFiles[s].getNumFrames(), segment_size, latent_dim))
+            return false;
+    }
+    return true;
+}
 
-    audioFileSamples[0] = AudioFileUtilities::loadMono(filename[0]);	
-	if(audioFileSamples[0].size() == 0) 
-	{
-    	printf("Error loading audio file '%s'\n", filename[0].c_str());
-    	return false;
-	}
+bool setup(LDSPcontext *context, void *userData)
+{
+    if(!audioFiles[0].setup(filename[0]))
+    {
+        printf("Error loading audio file '%s'\n", filename[0].c_str());
+        return false;
+    }
 
-    audioFileSamples[1] = AudioFileUtilities::loadMono(filename[1]);	
-	if(audioFileSamples[1].size() == 0) 
-	{
-    	printf("Error loading audio file '%s'\n", filename[1].c_str());
-    	return false;
-	}
+    if(!audioFiles[1].setup(filename[1]))
+    {
+        printf("Error loading audio file '%s'\n", filename[1].c_str());
+        return false;
+    }
 
     audioInput[0].resize(segment_size);
     audioInput[1].resize(segment_size);
 
+    if(encodeOnce)
+    {
+        if(!setupSplitModel())
+        {
+            printf("unable to setup encoder and decoder\n");
+            return false;
+        }
+        return true;
+    }
+
+    // inputs: the two audio segments and the interpolation
+    std::string modelPath = "./"+modelName+"."+modelType;
+    if(!model.setup("session1", modelPath, modelOptions) || model.getNumInputs() != 3 ||
+       !model.bindInput(0, audioInput[0].data()) || !model.bindInput(1, audioInput[1].data()) || !model.bindInput(2, &interpolation) ||
+       !model.bindOutput(0, output) || !model.prepare())
+    {
+        printf("unable to setup model\n");
+        return false;
+    }
+
     return true;
 }
 
 
-inline void fillAudioInput(const std::vector<float>& audio_samples, std::vector<float>& audio_input, int& read_pointer) 
+// encodes the file segments that are not cached yet and the live input, then decodes
+void runSplitModel()
 {
-    size_t remaining = audio_samples.size() - read_pointer;
-
-    // no wrapping needed, copy directly
-    if (remaining >= audio_input.size()) 
-        std::copy(audio_samples.begin() + read_pointer, audio_samples.begin() + read_pointer + audio_input.size(), audio_input.begin());
-    else // wrapping needed
+    for(int s=0; s<2; s++)
     {
-        // fill part of the audio_input until the end of the audio_samples vector
-        std::copy(audio_samples.begin() + read_pointer, audio_samples.end(), audio_input.begin());
-        // wrap around and continue filling from the beginning of the audio_samples vector
-        std::copy(audio_samples.begin(), audio_samples.begin() + audio_input.size() - remaining, audio_input.begin() + remaining);
+        bool live = liveInput && s == 0;
+        std::vector<float> &mu = decoderInputs[2*s];
+        std::vector<float> &logvar = decoderInputs[2*s+1];
+        if(!live && encodedSources[s].isEncoded())
+        {
+            std::copy(encodedSources[s].getMu(), encodedSources[s].getMu() + latent_dim, mu.begin());
+            std::copy(encodedSources[s].getLogvar(), encodedSources[s].getLogvar() + latent_dim, logvar.begin());
+        }
+        else
+        {
+            if(live)
+                std::copy(audioInput[s].begin(), audioInput[s].end(), encoderInput.begin());
+            else
+                audioFiles[s].read(encoderInput.data(), segment_size, segment_size);
+            encoder.run();
+            std::copy(encoderOutputs[0].begin(), encoderOutputs[0].end(), mu.begin());
+            std::copy(encoderOutputs[1].begin(), encoderOutputs[1].end(), logvar.begin());
+            if(!live)
+            {
+                encodedSources[s].store(mu.data(), logvar.data());
+                if(encodedSources[s].isComplete())
+                    audioFiles[s].release(); // last segment encoded, the file is not read anymore
+            }
+        }
+        if(!live)
+            encodedSources[s].advance();
     }
-
-    read_pointer = (read_pointer + audio_input.size()) % audio_samples.size();
+    decoderInterpolation = interpolation;
+    decoder.run();
 }
 
 void render(LDSPcontext *context, void *userData)
@@ -79,18 +156,18 @@ void render(LDSPcontext *context, void *userData)
         // generate new output samples when we run out of them
         if(outputSampleCnt >= segment_size)
         {
-            // if not live input, combine two audio files
-            if(!liveInput)
-                fillAudioInput(audioFileSamples[0], audioInput[0], readPointer[0]);
-            fillAudioInput(audioFileSamples[1], audioInput[1], readPointer[1]);
-            
-            // combine audio inputs and interpolation into single input data structure
-            inputs[0] = audioInput[0].data();
-            inputs[1] = audioInput[1].data();
-            inputs[2] = &interpolation;
-
-            // generate a new segment of output samples
-            model.run(inputs, output);
+            if(encodeOnce)
+                runSplitModel();
+            else
+            {
+                // if not live input, combine two audio files
+                if(!liveInput)
+                    audioFiles[0].read(audioInput[0].data(), segment_size, segment_size);
+                audioFiles[1].read(audioInput[1].data(), segment_size, segment_size);
+
+                // generate a new segment of output samples, from the bound audio inputs and interpolation
+                model.run();
+            }
             
             outputSampleCnt = 0;
         }
@@ -108,5 +185,13 @@ void render(LDSPcontext *context, void *userData)
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-
+    audioFiles[0].cleanup();
+    audioFiles[1].cleanup();
+    if(encodeOnce)
+    {
+        encoder.cleanup();
+        decoder.cleanup();
+    }
+    else
+        model.cleanup();
 }
\ No newline at end of file
@@ -1,25 +1,35 @@
 #include "LDSP.h"
-#include <libraries/OrtModel/OrtModel.h>
-#include <libraries/AudioFile/AudioFile.h>
 #include <libraries/Gui/Gui.h>
 #include <libraries/GuiController/GuiController.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../../common/SmoothedParameter.h"
+#include "../../common/StreamingAudioFile.h"
+#include "../../common/OrtModelRT.h"
 
 
-OrtModel model(true);
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+// session options, the model is split across several threads; prepare() warms it up with modelOptions.warmupRuns runs
+OrtModelRT::Options modelOptions = OrtModelRT::Options::largeModel();
 std::string modelType = "onnx";
 std::string modelName = "audioInput_rawvae";
 
 const int segment_size = 1024;
 
-float* inputs[3];
 float output[segment_size] = {0};
 
 float interpolation = 0.5;
+// the slider is polled by a control thread and reaches render() through an atomic, ramped over a few blocks to avoid zipper noise
+SmoothedParameter interpolationParam;
+float interpolationRamp_ms = 50;
+int controlPeriod_ms = 10;
+std::thread controlThread;
+std::atomic<bool> controlRunning(false);
 
 std::string filename[2] = {"472451__erokia__msfxp-sound-399.wav", "472454__erokia__msfxp-sound-402.wav"};	// name of the sound files (in project folder)
-std::vector<float> fileSamples[2];
-int readPointer[2] = {0};
-std::vector<float> audioInput[2];
+StreamingAudioFile audioFiles[2]; // streamed in a loop by a background thread, see common/StreamingAudioFile.h
+std::vector<float> audioInput[2]; // bound to the model
 
 int outputSampleCnt = 0;
 
@@ -28,63 +38,59 @@ bool liveInput = true;
 Gui gui;
 GuiController controller;
 
+// reads the GUI outside of the audio thread
+void controlLoop()
+{
+    while(controlRunning)
+    {
+        interpolationParam.set(controller.getSliderValue(0));
+        std::this_thread::sleep_for(std::chrono::milliseconds(controlPeriod_ms));
+    }
+}
+
 bool setup(LDSPcontext *context, void *userData)
 {
-    std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
+    if(!audioFiles[0].setup(filename[0]))
     {
-        printf("unable to setup ortModel");
+        printf("Error loading audio file '%s'\n", filename[0].c_str());
         return false;
     }
 
-
-    fileSamples[0] = AudioFileUtilities::loadMono(filename[0]);	
-	if(fileSamples[0].size() == 0) 
-	{
-    	printf("Error loading audio file '%s'\n", filename[0].c_str());
-    	return false;
-	}
-
-    fileSamples[1] = AudioFileUtilities::loadMono(filename[1]);	
-	if(fileSamples[1].size() == 0) 
-	{
-    	printf("Error loading audio file '%s'\n", filename[1].c_str());
-    	return false;
-	}
+    if(!audioFiles[1].setup(filename[1]))
+    {
+        printf("Error loading audio file '%s'\n", filename[1].c_str());
+        return false;
+    }
 
     audioInput[0].resize(segment_size);
     audioInput[1].resize(segment_size);
 
+    // inputs: the two audio segments and the interpolation
+    std::string modelPath = "./"+modelName+"."+modelType;
+    if(!model.setup("session1", modelPath, modelOptions) || model.getNumInputs() != 3 ||
+       !model.bindInput(0, audioInput[0].data()) || !model.bindInput(1, audioInput[1].data()) || !model.bindInput(2, &interpolation) ||
+       !model.bindOutput(0, output) || !model.prepare())
+    {
+        printf("unable to setup model\n");
+        return false;
+    }
+
     // Set up the GUI
 	gui.setup(context->projectName);
 	controller.setup(&gui, "RawVAE");
 	controller.addSlider("Interpolation", 0.5, 0, 1, 0); 
 
+    interpolationParam.setup(interpolation, context->audioSampleRate, interpolationRamp_ms);
+    controlRunning = true;
+    controlThread = std::thread(controlLoop);
+
     return true;
 }
 
 
-inline void fillAudioInput(const std::vector<float>& file_samples, std::vector<float>& audio_input, int& read_pointer) 
-{
-    size_t remaining = file_samples.size() - read_pointer;
-
-    // no wrapping needed, copy directly
-    if (remaining >= audio_input.size()) 
-        std::copy(file_samples.begin() + read_pointer, file_samples.begin() + read_pointer + audio_input.size(), audio_input.begin());
-    else // wrapping needed
-    {
-        // fill part of the audio_input until the end of the file_samples vector
-        std::copy(file_samples.begin() + read_pointer, file_samples.end(), audio_input.begin());
-        // wrap around and continue filling from the beginning of the file_samples vector
-        std::copy(file_samples.begin(), file_samples.begin() + audio_input.size() - remaining, audio_input.begin() + remaining);
-    }
-
-    read_pointer = (read_pointer + audio_input.size()) % file_samples.size();
-}
-
 void render(LDSPcontext *context, void *userData)
 {
-    interpolation = controller.getSliderValue(0);
+    interpolation = interpolationParam.process(context->audioFrames);
 
     for(int n=0; n<context->audioFrames; n++)
 	{
@@ -93,16 +99,11 @@ void render(LDSPcontext *context, void *userData)
         {
             // if not live input, combine two audio files
             if(!liveInput)
-                fillAudioInput(fileSamples[0], audioInput[0], readPointer[0]);
-            fillAudioInput(fileSamples[1], audioInput[1], readPointer[1]);
-            
-            // combine audio inputs and interpolation into single input data structure
-            inputs[0] = audioInput[0].data();
-            inputs[1] = audioInput[1].data();
-            inputs[2] = &interpolation;
+                audioFiles[0].read(audioInput[0].data(), segment_size, segment_size);
+            audioFiles[1].read(audioInput[1].data(), segment_size, segment_size);
 
-            // generate a new segment of output samples
-            model.run(inputs, output);
+            // generate a new segment of output samples, from the bound audio inputs and interpolation
+            model.run();
             
             outputSampleCnt = 0;
         }
@@ -120,5 +121,10 @@ void render(LDSPcontext *context, void *userData)
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-
+    controlRunning = false;
+    if(controlThread.joinable())
+        controlThread.join();
+    audioFiles[0].cleanup();
+    audioFiles[1].cleanup();
+    model.cleanup();
 }
\ No newline at end of file
@@ -1,97 +1,117 @@
 #include "LDSP.h"
-#include <libraries/OrtModel/OrtModel.h>
-#include <libraries/AudioFile/AudioFile.h>
 #include <algorithm>
-
-OrtModel model(true);
+#include "../../common/OrtModelRT.h"
+#include "../../common/AsyncInference.h"
+#include "../../common/OverlapAdd.h"
+#include "../../common/RingBuffer.h"
+#include "../../common/StreamingAudioFile.h"
+
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+// session options, the model is split across several threads; prepare() warms it up with modelOptions.warmupRuns runs
+OrtModelRT::Options modelOptions = OrtModelRT::Options::largeModel();
 std::string modelType = "onnx";
 std::string modelName = "audioInput_windowed_rawvae";
 
 const int segment_size = 1024;
-const int hop_size = segment_size/2;
+const int hop_size = segment_size/2; // any hop up to segment_size, e.g., segment_size/4 for 75% overlap, which doubles the inference rate
+
+float outputSegment[segment_size] = {0}; // filled by the model, then added to the overlap-add accumulator
+const float *output;
 
-float* inputs[3];
-float outputSegment[2][segment_size] = {0};
-float *output;
-int outputSegmentIdx = 0;
+OverlapAdd overlapAdd;
+OverlapAdd::Window synthesisWindow = OverlapAdd::none; // the models window their output already, the other windows are normalized to sum to one
 
 float interpolation = 0.5;
+float inputInterpolation; // copy passed to the model, so that interpolation can change while the worker is running
 
 std::string filename[2] = {"472451__erokia__msfxp-sound-399.wav", "472454__erokia__msfxp-sound-402.wav"};	// name of the sound files (in project folder)
-std::vector<float> audioFileSamples[2];
-int readPointer_audioFile[2] = {0};
-std::vector<float> audioInput[2];
+StreamingAudioFile audioFiles[2]; // streamed in a loop by a background thread, see common/StreamingAudioFile.h
+std::vector<float> audioInput[2]; // bound to the model
 
 int outputSampleCnt = 0;
-int overlap_size;
-int overlap_start;
 
 bool liveInput = false;
-std::vector<float> liveInputSamples; // circular buffer
-int writePointer_liveIn;
-int readPointer_liveIn;
+RingBuffer<float> liveInputSamples; // holds the last segment_size input samples
+
+// if true, each segment is generated by a worker thread during the previous hop, adding one hop of latency
+// otherwise, the model runs in the audio thread at the beginning of each hop
+bool asyncInference = true;
+AsyncInference inference;
+
+void prepareInputs();
+void runInference();
 
 bool setup(LDSPcontext *context, void *userData)
 {
-    std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
+    if(!audioFiles[0].setup(filename[0]))
     {
-        printf("unable to setup ortModel");
+        printf("Error loading audio file '%s'\n", filename[0].c_str());
         return false;
     }
 
-
-    audioFileSamples[0] = AudioFileUtilities::loadMono(filename[0]);	
-	if(audioFileSamples[0].size() == 0) 
-	{
-    	printf("Error loading audio file '%s'\n", filename[0].c_str());
-    	return false;
-	}
-
-    audioFileSamples[1] = AudioFileUtilities::loadMono(filename[1]);	
-	if(audioFileSamples[1].size() == 0) 
-	{
-    	printf("Error loading audio file '%s'\n", filename[1].c_str());
-    	return false;
-	}
+    if(!audioFiles[1].setup(filename[1]))
+    {
+        printf("Error loading audio file '%s'\n", filename[1].c_str());
+        return false;
+    }
 
     audioInput[0].resize(segment_size);
     audioInput[1].resize(segment_size);
 
+    // inputs: the two audio segments and the interpolation
+    std::string modelPath = "./"+modelName+"."+modelType;
+    if(!model.setup("session1", modelPath, modelOptions) || model.getNumInputs() != 3 ||
+       !model.bindInput(0, audioInput[0].data()) || !model.bindInput(1, audioInput[1].data()) || !model.bindInput(2, &inputInterpolation) ||
+       !model.bindOutput(0, outputSegment) || !model.prepare())
+    {
+        printf("unable to setup model\n");
+        return false;
+    }
+
     if(liveInput) 
     {
-        liveInputSamples.resize(hop_size*10);
-        std::fill(liveInputSamples.begin(), liveInputSamples.end(), 0.0f); // we need zeros for proper initial overlap and add
-        writePointer_liveIn = hop_size; // the first hop_size samples will be left as zeros
-        readPointer_liveIn = 0;
+        liveInputSamples.setup(segment_size); // we need zeros for proper initial overlap and add
     }
 
     
     // for overlap and add mechanism
-    output = outputSegment[outputSegmentIdx];
-    overlap_size = segment_size - hop_size;
-    overlap_start = segment_size - overlap_size;
+    if(!overlapAdd.setup(segment_size, hop_size, synthesisWindow))
+        return false;
+    output = overlapAdd.getHop();
+
+    if(asyncInference)
+    {
+        if(!inference.setup(runInference))
+        {
+            printf("unable to start inference worker\n");
+            return false;
+        }
+        // the first segment is generated while the first hop is played
+        prepareInputs();
+        inference.trigger();
+    }
 
     return true;
 }
 
 
-inline void fillAudioInput(const std::vector<float>& audio_samples, std::vector<float>& audio_input, int& read_pointer, int hopSize) 
+void prepareInputs()
 {
-    size_t remaining = audio_samples.size() - read_pointer;
-
-    // no wrapping needed, copy directly
-    if (remaining >= audio_input.size()) 
-        std::copy(audio_samples.begin() + read_pointer, audio_samples.begin() + read_pointer + audio_input.size(), audio_input.begin());
-    else // wrapping needed
-    {
-        // fill part of the audio_input until the end of the audio_samples vector
-        std::copy(audio_samples.begin() + read_pointer, audio_samples.end(), audio_input.begin());
-        // wrap around and continue filling from the beginning of the audio_samples vector
-        std::copy(audio_samples.begin(), audio_samples.begin() + audio_input.size() - remaining, audio_input.begin() + remaining);
-    }
+    // if live input, combine live input with the second audio file
+    if(liveInput)
+        std::copy(liveInputSamples.latest(segment_size), liveInputSamples.latest(segment_size) + segment_size, audioInput[0].begin()); // the segment that ends with the newest sample
+    else // otherwise, combine two audio files
+        audioFiles[0].read(audioInput[0].data(), segment_size, hop_size);
+    audioFiles[1].read(audioInput[1].data(), segment_size, hop_size);
+    
+    // audio inputs are already in place, add interpolation
+    inputInterpolation = interpolation;
+}
 
-    read_pointer = (read_pointer + hopSize) % audio_samples.size(); // advance of hop size only, to obtain overlapping behavior at next call
+// called by the worker thread
+void runInference()
+{
+    model.run();
 }
 
 void render(LDSPcontext *context, void *userData)
@@ -102,28 +122,32 @@ void render(LDSPcontext *context, void *userData)
         // generate new output samples when we run out of them
         if(outputSampleCnt >= hop_size)
         {
-            // if live input, combine live input with the second audio file
-            if(liveInput)
-                fillAudioInput(liveInputSamples, audioInput[0], readPointer_liveIn, hop_size);
-            else // otherwise, combine two audio files
-                fillAudioInput(audioFileSamples[0], audioInput[0], readPointer_audioFile[0], hop_size);
-            fillAudioInput(audioFileSamples[1], audioInput[1], readPointer_audioFile[1], hop_size);
-            
-            // combine audio inputs and interpolation into single input data structure
-            inputs[0] = audioInput[0].data();
-            inputs[1] = audioInput[1].data();
-            inputs[2] = &interpolation;
-
-            outputSegmentIdx = 1-outputSegmentIdx; // update current segment
-            output = outputSegment[outputSegmentIdx]; // point to current output segment to fill
-
-            // generate a new segment of output samples
-            model.run(inputs, output);
-            
-            // add first samples of current output segment with overlapping samples of previous output segment
-            for(int i=0; i<overlap_size; i++)
-                output[i] = outputSegment[outputSegmentIdx][i] + outputSegment[1-outputSegmentIdx][overlap_start+i];
-
+            overlapAdd.advance(); // the previous hop has been played
+
+            if(!asyncInference)
+            {
+                prepareInputs();
+
+                // generate a new segment of output samples
+                model.run();
+                overlapAdd.addSegment(outputSegment);
+            }
+            else if(inference.isDone())
+            {
+                overlapAdd.addSegment(outputSegment); // filled by the worker during the previous hop
+
+                // let the worker generate the next segment during this hop
+                prepareInputs();
+                inference.trigger();
+            }
+            else
+            {
+                // the worker is late, play what the previous segments left in this hop rather than waiting,
+                // i.e., their tails, or silence once those have been played
+                inference.markLate();
+            }
+
+            output = overlapAdd.getHop();
             outputSampleCnt = 0;
         }
     
@@ -133,8 +157,7 @@ void render(LDSPcontext *context, void *userData)
         // if live input, fill live input circular buffer 
         if(liveInput)
         {
-            liveInputSamples[writePointer_liveIn] = audioRead(context, n, 0); 
-            writePointer_liveIn = (writePointer_liveIn + 1) % liveInputSamples.size();
+            liveInputSamples.push(audioRead(context, n, 0));
         }
             
         outputSampleCnt++;
@@ -143,5 +166,13 @@ void render(LDSPcontext *context, void *userData)
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-
+    if(asyncInference)
+    {
+        inference.cleanup();
+        if(inference.getLateCount() > 0)
+            printf("inference worker was late %d times\n", inference.getLateCount());
+    }
+    audioFiles[0].cleanup();
+    audioFiles[1].cleanup();
+    model.cleanup();
 }
\ No newline at end of file
@@ -1,124 +1,123 @@
 #include "LDSP.h"
-#include <libraries/OrtModel/OrtModel.h>
 #include <libraries/AudioFile/AudioFile.h>
-#include <fstream>
-#include <iostream>
-
-OrtModel model(true);
+#include "../../common/OrtModelRT.h"
+#include "../../common/LatentFile.h"
+#include "../../common/LtsVoiceEngine.h"
+#include "../../common/SegmentCache.h"
+
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+// session options, the decoder is split across several threads; prepare() warms it up with modelOptions.warmupRuns runs
+OrtModelRT::Options modelOptions = OrtModelRT::Options::largeModel();
 std::string modelType = "onnx";
 std::string modelName = "latentInput_rawvae";
 
 const int segment_size = 1024;
 const int latent_dim = 256;
 
-float* inputs[5];
 float output[segment_size] = {0};
 
 float interpolation = 0.5;
+float inputInterpolation; // passed to the model, quantized when segments are cached
 
 std::string filename_mu[2] = {"472451__erokia__msfxp-sound-399_mu.lts", "472454__erokia__msfxp-sound-402_mu.lts"};	// name of the mu bin files (in project folder)
-std::string filename_logvar[2] = {"472451__erokia__msfxp-sound-399_logvar.lts", "472454__erokia__msfxp-sound-402_logvar.lts"};	// name of the logvar bin files (in project folder)
-std::vector<float> muFileSamples[2];
-std::vector<float> logvarFileSamples[2];
-int readPointer[2] = {0};
-std::vector<float> muInput[2];
+std::string filename_logvar[2] = {"472451__erokia__msfxp-sound-399_logvar.lts", "472454__erokia__msfxp-sound-402_logvar.lts"};	// name of the logvar bin files (in project folder), not used if the mu files are packed containers, see tools/lts_pack.py
+LatentSequence latents[2]; // memory-mapped mu and logvar frames
+int readPointer[2] = {0}; // in latent frames
+std::vector<float> muInput[2]; // bound to the model, only float16 and int8 frames are converted into them, float32 frames are read in place
 std::vector<float> logvarInput[2];
 
 int outputSampleCnt = 0;
 
-
-
-
-
-
-std::vector<float> read_binary_file(const std::string& filename) 
+// if true, numVoices voices, each with its own read pointers and interpolation, are played by a single decoder session,
+// which decodes the segments of all of them with one batched run and mixes them
+// the model must have a dynamic batch axis, see common/LtsVoiceEngine.h
+bool polyphonic = false;
+int numVoices = 4;
+LtsVoiceEngine voiceEngine; // its decoder session is set up with modelOptions too
+
+// if true, decoded segments are kept in memory and reused when the same pair of latent frames comes back with the same interpolation,
+// so once the latent files have looped, the decoder only runs again when the interpolation moves
+bool cacheSegments = false;
+size_t segmentCacheBudget = 8<<20; // bytes, the least recently used segments are evicted beyond it
+SegmentCache segmentCache;
+
+// the model reads the float32 frames straight from the mapped files, through a tensor built over each of them here
+inline bool bindLatentFrames(OrtModelRT& model, int mu_index, const LatentSequence& latents)
 {
-    std::ifstream input(filename, std::ios::binary);
-    if (!input) 
-    {
-        std::cerr << "Error opening file: " << filename << std::endl;
-        return {};
-    }
-    // Get the size of the file
-    input.seekg(0, std::ios::end);
-    std::size_t size = input.tellg();
-    input.seekg(0, std::ios::beg);
-
-    // Read the content of the file into a vector
-    std::vector<float> buffer(size / sizeof(float));
-    input.read(reinterpret_cast<char*>(buffer.data()), size);
-    return buffer;
+    std::vector<const float*> mu;
+    std::vector<const float*> logvar;
+    latents.getFrames(mu, logvar);
+    return model.bindInputFrames(mu_index, mu) && model.bindInputFrames(mu_index+1, logvar);
 }
 
 bool setup(LDSPcontext *context, void *userData)
 {
     std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
+    if(polyphonic)
     {
-        printf("unable to setup ortModel");
+        if(!voiceEngine.setup("session1", modelPath, numVoices, latent_dim, segment_size, modelOptions))
+        {
+            printf("unable to setup voice engine\n");
+            return false;
+        }
+    }
+    else if(!model.setup("session1", modelPath, modelOptions) || model.getNumInputs() != 5)
+    {
+        printf("unable to setup model\n");
         return false;
     }
 
 
-    muFileSamples[0] = read_binary_file(filename_mu[0]);
-    if(muFileSamples[0].empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_mu[0].c_str());
-    	return false;
-	}
-    muFileSamples[1] = read_binary_file(filename_mu[1]);
-    if(muFileSamples[1].empty())
+    for(int i=0; i<2; i++)
     {
-    	printf("Error loading binary file '%s'\n", filename_mu[1].c_str());
-    	return false;
-	}
-    
-    logvarFileSamples[0] = read_binary_file(filename_logvar[0]);
-    if(logvarFileSamples[0].empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_logvar[0].c_str());
-    	return false;
-	}
-    logvarFileSamples[1] = read_binary_file(filename_logvar[1]);
-    if(logvarFileSamples[1].empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_logvar[1].c_str());
-    	return false;
-	}
+        if(!latents[i].open(filename_mu[i], filename_logvar[i], latent_dim))
+            return false;
+    }
 
     muInput[0].resize(latent_dim);
     muInput[1].resize(latent_dim);
     logvarInput[0].resize(latent_dim);
     logvarInput[1].resize(latent_dim);
 
+    // inputs: mu and logvar of the first source, then of the second, and the interpolation
+    if(!polyphonic && (!model.bindInput(0, muInput[0].data()) || !model.bindInput(1, logvarInput[0].data()) ||
+                       !model.bindInput(2, muInput[1].data()) || !model.bindInput(3, logvarInput[1].data()) ||
+                       !model.bindInput(4, &inputInterpolation) || !model.bindOutput(0, output) ||
+                       !bindLatentFrames(model, 0, latents[0]) || !bindLatentFrames(model, 2, latents[1]) || !model.prepare()))
+    {
+        printf("unable to setup model\n");
+        return false;
+    }
+
+    if(cacheSegments && !segmentCache.setup(segment_size, segmentCacheBudget))
+        return false;
+
+    // voices spread across the interpolation range, each starting from a different point of the sources
+    for(int v=0; polyphonic && v<numVoices; v++)
+    {
+        LtsVoice &voice = voiceEngine.getVoice(v);
+        for(int i=0; i<2; i++)
+        {
+            voice.sources[i] = &latents[i];
+            voice.readPointer[i] = v*latents[i].getNumFrames()/numVoices;
+        }
+        voice.interpolation = (v+0.5f)/numVoices;
+        voice.gain = 1.0f/numVoices;
+        voice.active = true;
+    }
+
     return true;
 }
 
 
-inline void fillLatentInput(const std::vector<float>& mu_samples, const std::vector<float>& logvar_samples, 
-                       std::vector<float>& mu_input, std::vector<float>& logvar_input, int& read_pointer) 
+// selects the next mu and logvar frames, which the model reads in place, only float16 and int8 frames are converted into mu_input and logvar_input
+inline void fillLatentInput(OrtModelRT& model, int mu_index, const LatentSequence& latents, std::vector<float>& mu_input, std::vector<float>& logvar_input, int& read_pointer)
 {
-    size_t input_size = mu_input.size(); // mu and logvar inputs are expected to have the same size
-    size_t source_size = mu_samples.size(); // mu and logvar sources are expected to have the same size
-    size_t remaining = source_size - read_pointer;
-
-    // no wrapping needed, copy directly
-    if (remaining >= input_size) 
-    {
-        std::copy(mu_samples.begin() + read_pointer, mu_samples.begin() + read_pointer + input_size, mu_input.begin());
-        std::copy(logvar_samples.begin() + read_pointer, logvar_samples.begin() + read_pointer + logvar_input.size(), logvar_input.begin());
-    }
-    else // wrapping needed
-    {
-        // fill part of the mu_input until the end of the mu_samples vector
-        std::copy(mu_samples.begin() + read_pointer, mu_samples.end(), mu_input.begin());
-        std::copy(logvar_samples.begin() + read_pointer, logvar_samples.end(), logvar_input.begin());
-        // wrap around and continue filling from the beginning of the mu_samples vector
-        std::copy(mu_samples.begin(), mu_samples.begin() + input_size - remaining, mu_input.begin() + remaining);
-        std::copy(logvar_samples.begin(), logvar_samples.begin() + logvar_input.size() - remaining, logvar_input.begin() + remaining);
-    }
-    
-    read_pointer = (read_pointer + input_size) % source_size;
+    if(!latents.isFloat32())
+        latents.readFrame(read_pointer, mu_input.data(), logvar_input.data());
+    model.selectInputFrame(mu_index, read_pointer);
+    model.selectInputFrame(mu_index+1, read_pointer);
+    read_pointer = (read_pointer + 1) % latents.getNumFrames();
 }
 
 
@@ -130,18 +129,33 @@ void render(LDSPcontext *context, void *userData)
         // generate new output samples when we run out of them
         if(outputSampleCnt >= segment_size)
         {            
-            fillLatentInput(muFileSamples[0], logvarFileSamples[0], muInput[0], logvarInput[0], readPointer[0]);
-            fillLatentInput(muFileSamples[1], logvarFileSamples[1], muInput[1], logvarInput[1], readPointer[1]);
-            
-            // combine latent inputs and interpolation into single input data structure
-            inputs[0] = muInput[0].data();
-            inputs[1] = logvarInput[0].data();
-            inputs[2] = muInput[1].data();
-            inputs[3] = logvarInput[1].data();
-            inputs[4] = &interpolation;
-
-            // generate a new segment of output samples
-            model.run(inputs, output);
+            if(polyphonic)
+                voiceEngine.renderSegment(output); // all the voices in one run
+            else
+            {
+                int frame0 = readPointer[0];
+                int frame1 = readPointer[1];
+                const float *cached = cacheSegments ? segmentCache.find(frame0, frame1, interpolation) : nullptr;
+                if(cached)
+                {
+                    std::copy(cached, cached + segment_size, output);
+                    readPointer[0] = (readPointer[0] + 1) % latents[0].getNumFrames();
+                    readPointer[1] = (readPointer[1] + 1) % latents[1].getNumFrames();
+                }
+                else
+                {
+                    fillLatentInput(model, 0, latents[0], muInput[0], logvarInput[0], readPointer[0]);
+                    fillLatentInput(model, 2, latents[1], muInput[1], logvarInput[1], readPointer[1]);
+                    
+                    // latent inputs are already in place, add interpolation
+                    inputInterpolation = cacheSegments ? segmentCache.quantize(interpolation) : interpolation;
+
+                    // generate a new segment of output samples
+                    model.run();
+                    if(cacheSegments)
+                        segmentCache.insert(frame0, frame1, interpolation, output);
+                }
+            }
             
             outputSampleCnt = 0;
         }
@@ -155,5 +169,10 @@ void render(LDSPcontext *context, void *userData)
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-
+    if(polyphonic)
+        voiceEngine.cleanup();
+    else
+        model.cleanup();
+    if(cacheSegments)
+        printf("segment cache: %llu hits, %llu misses\n", (unsigned long long)segmentCache.getHits(), (unsigned long long)segmentCache.getMisses());
 }
\ No newline at end of file
@@ -1,135 +1,161 @@
 #include "LDSP.h"
-#include <libraries/OrtModel/OrtModel.h>
 #include <libraries/AudioFile/AudioFile.h>
-#include <fstream>
-#include <iostream>
-
-OrtModel model(true);
+#include "../../common/OrtModelRT.h"
+#include "../../common/LatentFile.h"
+#include "../../common/AsyncInference.h"
+#include "../../common/OverlapAdd.h"
+#include "../../common/SegmentCache.h"
+
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+// session options, the decoder is split across several threads; prepare() warms it up with modelOptions.warmupRuns runs
+OrtModelRT::Options modelOptions = OrtModelRT::Options::largeModel();
 std::string modelType = "onnx";
 std::string modelName = "latentInput_windowed_rawvae";
 
 const int segment_size = 1024;
-const int hop_size = segment_size/2;
+const int hop_size = segment_size/2; // must be the hop the windowed latent files were encoded with
 const int latent_dim = 256;
 
-float* inputs[5];
-float outputSegment[2][segment_size] = {0};
-float *output;
-int outputSegmentIdx = 0;
+float outputSegment[segment_size] = {0}; // filled by the model, then added to the overlap-add accumulator
+const float *output;
+
+OverlapAdd overlapAdd;
+OverlapAdd::Window synthesisWindow = OverlapAdd::none; // the models window their output already, the other windows are normalized to sum to one
 
 float interpolation = 0.5;
+float inputInterpolation; // copy passed to the model, so that interpolation can change while the worker is running, quantized when segments are cached
 
 std::string filename_mu[2] = {"472451__erokia__msfxp-sound-399_mu_windowed.lts", "472454__erokia__msfxp-sound-402_mu_windowed.lts"};	// name of the mu bin files (in project folder)
-std::string filename_logvar[2] = {"472451__erokia__msfxp-sound-399_logvar_windowed.lts", "472454__erokia__msfxp-sound-402_logvar_windowed.lts"};	// name of the logvar bin files (in project folder)
-std::vector<float> muFileSamples[2];
-std::vector<float> logvarFileSamples[2];
-int readPointer[2] = {0};
-std::vector<float> muInput[2];
+std::string filename_logvar[2] = {"472451__erokia__msfxp-sound-399_logvar_windowed.lts", "472454__erokia__msfxp-sound-402_logvar_windowed.lts"};	// name of the logvar bin files (in project folder), not used if the mu files are packed containers, see tools/lts_pack.py
+LatentSequence latents[2]; // memory-mapped mu and logvar frames
+int readPointer[2] = {0}; // in latent frames
+std::vector<float> muInput[2]; // bound to the model, only float16 and int8 frames are converted into them, float32 frames are read in place
 std::vector<float> logvarInput[2];
 
 int outputSampleCnt = 0;
-int overlap_size;
-int overlap_start;
 
+// if true, each segment is generated by a worker thread during the previous hop, adding one hop of latency
+// otherwise, the model runs in the audio thread at the beginning of each hop
+bool asyncInference = true;
+AsyncInference inference;
 
+// if true, decoded segments are kept in memory and reused when the same pair of latent frames comes back with the same interpolation,
+// so once the latent files have looped, the decoder only runs again when the interpolation moves
+bool cacheSegments = false;
+size_t segmentCacheBudget = 8<<20; // bytes, the least recently used segments are evicted beyond it
+SegmentCache segmentCache;
+int segmentFrames[2]; // latent frames of the segment being prepared
+const float *cachedSegment = nullptr; // next segment, when it was found in the cache rather than left to the worker
 
+void prepareInputs();
+void runInference();
 
-std::vector<float> read_binary_file(const std::string& filename) 
+// the model reads the float32 frames straight from the mapped files, through a tensor built over each of them here
+inline bool bindLatentFrames(OrtModelRT& model, int mu_index, const LatentSequence& latents)
 {
-    std::ifstream input(filename, std::ios::binary);
-    if (!input) 
-    {
-        std::cerr << "Error opening file: " << filename << std::endl;
-        return {};
-    }
-    // Get the size of the file
-    input.seekg(0, std::ios::end);
-    std::size_t size = input.tellg();
-    input.seekg(0, std::ios::beg);
-
-    // Read the content of the file into a vector
-    std::vector<float> buffer(size / sizeof(float));
-    input.read(reinterpret_cast<char*>(buffer.data()), size);
-    return buffer;
+    std::vector<const float*> mu;
+    std::vector<const float*> logvar;
+    latents.getFrames(mu, logvar);
+    return model.bindInputFrames(mu_index, mu) && model.bindInputFrames(mu_index+1, logvar);
 }
 
 bool setup(LDSPcontext *context, void *userData)
 {
     std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
+    if(!model.setup("session1", modelPath, modelOptions) || model.getNumInputs() != 5)
     {
-        printf("unable to setup ortModel");
+        printf("unable to setup model\n");
         return false;
     }
 
 
-    muFileSamples[0] = read_binary_file(filename_mu[0]);
-    if(muFileSamples[0].empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_mu[0].c_str());
-    	return false;
-	}
-    muFileSamples[1] = read_binary_file(filename_mu[1]);
-    if(muFileSamples[1].empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_mu[1].c_str());
-    	return false;
-	}
-    
-    logvarFileSamples[0] = read_binary_file(filename_logvar[0]);
-    if(logvarFileSamples[0].empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_logvar[0].c_str());
-    	return false;
-	}
-    logvarFileSamples[1] = read_binary_file(filename_logvar[1]);
-    if(logvarFileSamples[1].empty())
+    for(int i=0; i<2; i++)
     {
-    	printf("Error loading binary file '%s'\n", filename_logvar[1].c_str());
-    	return false;
-	}
-
+        if(!latents[i].open(filename_mu[i], filename_logvar[i], latent_dim))
+            return false;
+        if(latents[i].getMuFile().getHop() != 0 && latents[i].getMuFile().getHop() != hop_size)
+            printf("warning: '%s' was encoded with a hop of %d samples, %d used\n", filename_mu[i].c_str(), latents[i].getMuFile().getHop(), hop_size);
+    }
 
     muInput[0].resize(latent_dim);
     muInput[1].resize(latent_dim);
     logvarInput[0].resize(latent_dim);
     logvarInput[1].resize(latent_dim);
 
+    // inputs: mu and logvar of the first source, then of the second, and the interpolation
+    if(!model.bindInput(0, muInput[0].data()) || !model.bindInput(1, logvarInput[0].data()) ||
+       !model.bindInput(2, muInput[1].data()) || !model.bindInput(3, logvarInput[1].data()) ||
+       !model.bindInput(4, &inputInterpolation) || !model.bindOutput(0, outputSegment) ||
+       !bindLatentFrames(model, 0, latents[0]) || !bindLatentFrames(model, 2, latents[1]) || !model.prepare())
+    {
+        printf("unable to setup model\n");
+        return false;
+    }
+
+
+    if(cacheSegments && !segmentCache.setup(segment_size, segmentCacheBudget))
+        return false;
 
     // for overlap and add mechanism
-    output = outputSegment[outputSegmentIdx];
-    overlap_size = segment_size - hop_size;
-    overlap_start = segment_size - overlap_size;
+    if(!overlapAdd.setup(segment_size, hop_size, synthesisWindow))
+        return false;
+    output = overlapAdd.getHop();
+
+    if(asyncInference)
+    {
+        if(!inference.setup(runInference))
+        {
+            printf("unable to start inference worker\n");
+            return false;
+        }
+        // the first segment is generated while the first hop is played
+        prepareInputs();
+        inference.trigger();
+    }
 
     return true;
 }
 
 
-inline void fillLatentInput(const std::vector<float>& mu_samples, const std::vector<float>& logvar_samples, 
-                       std::vector<float>& mu_input, std::vector<float>& logvar_input, int& read_pointer) 
+// selects the next mu and logvar frames, which the model reads in place, only float16 and int8 frames are converted into mu_input and logvar_input
+inline void fillLatentInput(OrtModelRT& model, int mu_index, const LatentSequence& latents, std::vector<float>& mu_input, std::vector<float>& logvar_input, int& read_pointer)
 {
     // windowed latent bin files are composed of spread out overlapping segments
-    size_t input_size = mu_input.size(); // mu and logvar inputs are expected to have the same size
-    size_t source_size = mu_samples.size(); // mu and logvar sources are expected to have the same size
-    size_t remaining = source_size - read_pointer;
+    if(!latents.isFloat32())
+        latents.readFrame(read_pointer, mu_input.data(), logvar_input.data());
+    model.selectInputFrame(mu_index, read_pointer);
+    model.selectInputFrame(mu_index+1, read_pointer);
+    read_pointer = (read_pointer + 1) % latents.getNumFrames(); // one frame per hop, consecutive frames overlap already
+}
 
-    // no wrapping needed, copy directly
-    if (remaining >= input_size) 
-    {
-        std::copy(mu_samples.begin() + read_pointer, mu_samples.begin() + read_pointer + input_size, mu_input.begin());
-        std::copy(logvar_samples.begin() + read_pointer, logvar_samples.begin() + read_pointer + logvar_input.size(), logvar_input.begin());
-    }
-    else // wrapping needed
-    {
-        // fill part of the mu_input until the end of the mu_samples vector
-        std::copy(mu_samples.begin() + read_pointer, mu_samples.end(), mu_input.begin());
-        std::copy(logvar_samples.begin() + read_pointer, logvar_samples.end(), logvar_input.begin());
-        // wrap around and continue filling from the beginning of the mu_samples vector
-        std::copy(mu_samples.begin(), mu_samples.begin() + input_size - remaining, mu_input.begin() + remaining);
-        std::copy(logvar_samples.begin(), logvar_samples.begin() + logvar_input.size() - remaining, logvar_input.begin() + remaining);
-    }
+void prepareInputs()
+{
+    segmentFrames[0] = readPointer[0];
+    segmentFrames[1] = readPointer[1];
+    fillLatentInput(model, 0, latents[0], muInput[0], logvarInput[0], readPointer[0]);
+    fillLatentInput(model, 2, latents[1], muInput[1], logvarInput[1], readPointer[1]);
     
-    read_pointer = (read_pointer + input_size) % source_size; // advance of hop size only, to obtain overlapping behavior at next call
+    // latent inputs are already in place, add interpolation
+    inputInterpolation = cacheSegments ? segmentCache.quantize(interpolation) : interpolation;
+}
+
+// the segment prepared by prepareInputs(), if it was decoded already
+const float* findSegment()
+{
+    return cacheSegments ? segmentCache.find(segmentFrames[0], segmentFrames[1], inputInterpolation) : nullptr;
+}
+
+// keeps the segment just decoded from the prepared inputs
+void storeSegment()
+{
+    if(cacheSegments)
+        segmentCache.insert(segmentFrames[0], segmentFrames[1], inputInterpolation, outputSegment);
+}
+
+// called by the worker thread
+void runInference()
+{
+    model.run();
 }
 
 
@@ -141,26 +167,46 @@ void render(LDSPcontext *context, void *userData)
         // generate new output samples when we run out of them
         if(outputSampleCnt >= hop_size)
         {            
-            fillLatentInput(muFileSamples[0], logvarFileSamples[0], muInput[0], logvarInput[0], readPointer[0]);
-            fillLatentInput(muFileSamples[1], logvarFileSamples[1], muInput[1], logvarInput[1], readPointer[1]);
-            
-            // combine latent inputs and interpolation into single input data structure
-            inputs[0] = muInput[0].data();
-            inputs[1] = logvarInput[0].data();
-            inputs[2] = muInput[1].data();
-            inputs[3] = logvarInput[1].data();
-            inputs[4] = &interpolation;
-
-            outputSegmentIdx = 1-outputSegmentIdx; // update current segment
-            output = outputSegment[outputSegmentIdx]; // point to current output segment to fill
-            
-            // generate a new segment of output samples
-            model.run(inputs, output);
-            
-            // add first samples of current output segment with overlapping samples of previous output segment
-            for(int i=0; i<overlap_size; i++)
-                output[i] = outputSegment[outputSegmentIdx][i] + outputSegment[1-outputSegmentIdx][overlap_start+i];
-
+            overlapAdd.advance(); // the previous hop has been played
+
+            if(!asyncInference)
+            {
+                prepareInputs();
+
+                // generate a new segment of output samples, unless it is cached
+                const float *segment = findSegment();
+                if(!segment)
+                {
+                    model.run();
+                    storeSegment();
+                    segment = outputSegment;
+                }
+                overlapAdd.addSegment(segment);
+            }
+            else if(cachedSegment || inference.isDone())
+            {
+                if(cachedSegment)
+                    overlapAdd.addSegment(cachedSegment);
+                else
+                {
+                    overlapAdd.addSegment(outputSegment); // filled by the worker during the previous hop
+                    storeSegment();
+                }
+
+                // let the worker generate the next segment during this hop, unless it is cached
+                prepareInputs();
+                cachedSegment = findSegment();
+                if(!cachedSegment)
+                    inference.trigger();
+            }
+            else
+            {
+                // the worker is late, play what the previous segments left in this hop rather than waiting,
+                // i.e., their tails, or silence once those have been played
+                inference.markLate();
+            }
+
+            output = overlapAdd.getHop();
             outputSampleCnt = 0;
         }
     
@@ -173,5 +219,13 @@ void render(LDSPcontext *context, void *userData)
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-
+    if(asyncInference)
+    {
+        inference.cleanup();
+        if(inference.getLateCount() > 0)
+            printf("inference worker was late %d times\n", inference.getLateCount());
+    }
+    if(cacheSegments)
+        printf("segment cache: %llu hits, %llu misses\n", (unsigned long long)segmentCache.getHits(), (unsigned long long)segmentCache.getMisses());
+    model.cleanup();
 }
\ No newline at end of file
@@ -1,31 +1,29 @@
 #include "LDSP.h"
-#include <libraries/OrtModel/OrtModel.h>
-#include <libraries/AudioFile/AudioFile.h>
-#include <fstream>
-#include <iostream>
-
-OrtModel model(true);
+#include "../../common/LatentFile.h"
+#include "../../common/StreamingAudioFile.h"
+#include "../../common/OrtModelRT.h"
+#include "../../common/EncodedSourceCache.h"
+
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+// session options, the model is split across several threads; prepare() warms it up with modelOptions.warmupRuns runs
+OrtModelRT::Options modelOptions = OrtModelRT::Options::largeModel();
 std::string modelType = "onnx";
 std::string modelName = "mixedInput_rawvae";
 
 const int segment_size = 1024;
 const int latent_dim = 256;
 
-float* inputs[4];
 float output[segment_size] = {0};
 
 float interpolation = 0.5;
 
 std::string filename_mu = "472451__erokia__msfxp-sound-399_mu.lts";	// name of the mu bin file (in project folder)
-std::string filename_logvar = "472451__erokia__msfxp-sound-399_logvar.lts"; // name of the logvar bin file (in project folder)
+std::string filename_logvar = "472451__erokia__msfxp-sound-399_logvar.lts"; // name of the logvar bin file (in project folder), not used if the mu file is a packed container, see tools/lts_pack.py
 std::string filename_audio = "472454__erokia__msfxp-sound-402.wav";	// name of the sound file (in project folder)
-std::vector<float> muFileSamples;
-std::vector<float> logvarFileSamples;
-std::vector<float> audioFileSamples;
-int readPointer_mu = 0;
-int readPointer_logvar = 0;
-int readPointer_audioFile = 0;
-std::vector<float> muInput;
+LatentSequence latents; // memory-mapped mu and logvar frames
+StreamingAudioFile audioFile; // streamed in a loop by a background thread, see common/StreamingAudioFile.h
+int readPointer_latent = 0; // in latent frames
+std::vector<float> muInput; // bound to the model with audioInput, only float16 and int8 frames are converted into them, float32 frames are read in place
 std::vector<float> logvarInput;
 std::vector<float> audioInput;
 
@@ -33,97 +31,139 @@ int outputSampleCnt = 0;
 
 bool liveInput = false;
 
+// if true, the model is split into an encoder and a decoder, derived with tools/make_model_variants.py rawvae-encoder,
+// the decoder being the latentInput model, which takes the latent frames as first source and the encoded audio as second one
+// the latents of the audio file are encoded the first time each of its segments is played and then kept,
+// so from the second loop of the file on only the decoder runs, and only live input goes through the encoder every time
+// once the file is fully encoded, its streaming thread and ring are released
+// the encoder and the decoder are set up with modelOptions, as the whole model
+bool encodeOnce = false;
+std::string encoderModelName = "encoder_rawvae";
+std::string decoderModelName = "latentInput_rawvae";
+OrtModelRT encoder;
+OrtModelRT decoder;
+EncodedSourceCache encodedAudio;
+std::vector<float> encoderInput; // [segment_size]
+std::vector<float> encoderOutputs[2]; // mu and logvar
+std::vector<float> decoderInputs[4]; // mu and logvar of the latent frames, only for float16 and int8 files as float32 frames are read in place, then of the audio
+float decoderInterpolation;
+
+// the model reads the float32 frames straight from the mapped files, through a tensor built over each of them here
+inline bool bindLatentFrames(OrtModelRT& model, int mu_index, const LatentSequence& latents)
+{
+    std::vector<const float*> mu;
+    std::vector<const float*> logvar;
+    latents.getFrames(mu, logvar);
+    return model.bindInputFrames(mu_index, mu) && model.bindInputFrames(mu_index+1, logvar);
+}
 
-
-
-
-std::vector<float> read_binary_file(const std::string& filename) 
+bool setupSplitModel()
 {
-    std::ifstream input(filename, std::ios::binary);
-    if (!input) 
+    encoderInput.assign(segment_size, 0);
+    for(auto &buffer : encoderOutputs)
+        buffer.assign(latent_dim, 0);
+    for(auto &buffer : decoderInputs)
+        buffer.assign(latent_dim, 0);
+
+    if(!encoder.setup("session1", "./"+encoderModelName+"."+modelType, modelOptions) || encoder.getNumOutputs() < 2 ||
+       !encoder.bindInput(0, encoderInput.data()) || !encoder.bindOutput(0, encoderOutputs[0].data()) ||
+       !encoder.bindOutput(1, encoderOutputs[1].data()) || !encoder.prepare())
+        return false;
+    if(!decoder.setup("session2", "./"+decoderModelName+"."+modelType, modelOptions) || decoder.getNumInputs() != 5)
+        return false;
+    for(int i=0; i<4; i++)
     {
-        std::cerr << "Error opening file: " << filename << std::endl;
-        return {};
+        if(!decoder.bindInput(i, decoderInputs[i].data()))
+            return false;
     }
-    // Get the size of the file
-    input.seekg(0, std::ios::end);
-    std::size_t size = input.tellg();
-    input.seekg(0, std::ios::beg);
-
-    // Read the content of the file into a vector
-    std::vector<float> buffer(size / sizeof(float));
-    input.read(reinterpret_cast<char*>(buffer.data()), size);
-    return buffer;
+    if(!decoder.bindInput(4, &decoderInterpolation) || !decoder.bindOutput(0, output) || !bindLatentFrames(decoder, 0, latents) || !decoder.prepare())
+        return false;
+
+    return encodedAudio.setup(audioFile.getNumFrames(), segment_size, latent_dim);
 }
 
 bool setup(LDSPcontext *context, void *userData)
 {
-    std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
-    {
-        printf("unable to setup ortModel");
+    if(!latents.open(filename_mu, filename_logvar, latent_dim))
         return false;
-    }
-
-    muFileSamples = read_binary_file(filename_mu);
-    if(muFileSamples.empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_mu.c_str());
-    	return false;
-	}
-    logvarFileSamples = read_binary_file(filename_logvar);
-    if(logvarFileSamples.empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_logvar.c_str());
-    	return false;
-	}
 
     muInput.resize(latent_dim);
     logvarInput.resize(latent_dim);
     
 
-    audioFileSamples = AudioFileUtilities::loadMono(filename_audio);	
-	if(audioFileSamples.size() == 0) 
-	{
-    	printf("Error loading audio file '%s'\n", filename_audio.c_str());
-    	return false;
-	}
+    if(!audioFile.setup(filename_audio))
+    {
+        printf("Error loading audio file '%s'\n", filename_audio.c_str());
+        return false;
+    }
 
     audioInput.resize(segment_size);
 
-    return true;
-}
-
-
-inline void fillInput(const std::vector<float>& file_samples, std::vector<float>& input, int& read_pointer) 
-{
-    size_t remaining = file_samples.size() - read_pointer;
+    if(encodeOnce)
+    {
+        if(!setupSplitModel())
+        {
+            printf("unable to setup encoder and decoder\n");
+            return false;
+        }
+        return true;
+    }
 
-    // no wrapping needed, copy directly
-    if (remaining >= input.size()) 
-        std::copy(file_samples.begin() + read_pointer, file_samples.begin() + read_pointer + input.size(), input.begin());
-    else // wrapping needed
+    // inputs: mu and logvar of the latent frame, the audio segment and the interpolation
+    std::string modelPath = "./"+modelName+"."+modelType;
+    if(!model.setup("session1", modelPath, modelOptions) || model.getNumInputs() != 4 ||
+       !model.bindInput(0, muInput.data()) || !model.bindInput(1, logvarInput.data()) || !model.bindInput(2, audioInput.data()) ||
+       !model.bindInput(3, &interpolation) || !model.bindOutput(0, output) || !bindLatentFrames(model, 0, latents) || !model.prepare())
     {
-        // fill part of the input until the end of the file_samples vector
-        std::copy(file_samples.begin() + read_pointer, file_samples.end(), input.begin());
-        // wrap around and continue filling from the beginning of the file_samples vector
-        std::copy(file_samples.begin(), file_samples.begin() + input.size() - remaining, input.begin() + remaining);
+        printf("unable to setup model\n");
+        return false;
     }
 
-    read_pointer = (read_pointer + input.size()) % file_samples.size();
+    return true;
 }
 
 
-inline void fillLatentInput(const std::vector<float>& mu_samples, const std::vector<float>& logvar_samples, 
-                       std::vector<float>& mu_input, std::vector<float>& logvar_input, int& mu_read_pointer, int& logvar_read_pointer) 
+// selects the next mu and logvar frames, which the model reads in place, only float16 and int8 frames are converted into mu_input and logvar_input
+inline void fillLatentInput(OrtModelRT& model, int mu_index, const LatentSequence& latents, std::vector<float>& mu_input, std::vector<float>& logvar_input, int& read_pointer)
 {
-    fillInput(mu_samples, mu_input, mu_read_pointer);
-    fillInput(logvar_samples, logvar_input, logvar_read_pointer);
+    if(!latents.isFloat32())
+        latents.readFrame(read_pointer, mu_input.data(), logvar_input.data());
+    model.selectInputFrame(mu_index, read_pointer);
+    model.selectInputFrame(mu_index+1, read_pointer);
+    read_pointer = (read_pointer + 1) % latents.getNumFrames();
 }
 
-inline void fillAudioInput(const std::vector<float>& audio_samples, std::vector<float>& audio_input, int& read_pointer) 
+// encodes the audio segment if it is live or not cached yet, then decodes it with the latent frame
+void runSplitModel()
 {
-    fillInput(audio_samples, audio_input, read_pointer);
+    fillLatentInput(decoder, 0, latents, decoderInputs[0], decoderInputs[1], readPointer_latent);
+
+    if(!liveInput && encodedAudio.isEncoded())
+    {
+        std::copy(encodedAudio.getMu(), encodedAudio.getMu() + latent_dim, decoderInputs[2].begin());
+        std::copy(encodedAudio.getLogvar(), encodedAudio.getLogvar() + latent_dim, decoderInputs[3].begin());
+    }
+    else
+    {
+        if(liveInput)
+            std::copy(audioInput.begin(), audioInput.end(), encoderInput.begin());
+        else
+            audioFile.read(encoderInput.data(), segment_size, segment_size);
+        encoder.run();
+        std::copy(encoderOutputs[0].begin(), encoderOutputs[0].end(), decoderInputs[2].begin());
+        std::copy(encoderOutputs[1].begin(), encoderOutputs[1].end(), decoderInputs[3].begin());
+        if(!liveInput)
+        {
+            encodedAudio.store(decoderInputs[2].data(), decoderInputs[3].data());
+            if(encodedAudio.isComplete())
+                audioFile.release(); // last segment encoded, the file is not read anymore
+        }
+    }
+    if(!liveInput)
+        encodedAudio.advance();
+
+    decoderInterpolation = interpolation;
+    decoder.run();
 }
 
 void render(LDSPcontext *context, void *userData)
@@ -134,20 +174,18 @@ void render(LDSPcontext *context, void *userData)
         // generate new output samples when we run out of them
         if(outputSampleCnt >= segment_size)
         {
-            fillLatentInput(muFileSamples, logvarFileSamples, muInput, logvarInput, readPointer_mu, readPointer_logvar);
-            // if not live input, combine latent files with audio file
-            if(!liveInput)
-                fillAudioInput(audioFileSamples, audioInput, readPointer_audioFile);
-            
-            
-            // combine letent inputs, audio input and interpolation into single input data structure
-            inputs[0] = muInput.data();
-            inputs[1] = logvarInput.data();
-            inputs[2] = audioInput.data();
-            inputs[3] = &interpolation;
-
-            // generate a new segment of output samples
-            model.run(inputs, output);
+            if(encodeOnce)
+                runSplitModel();
+            else
+            {
+                fillLatentInput(model, 0, latents, muInput, logvarInput, readPointer_latent);
+                // if not live input, combine latent files with audio file
+                if(!liveInput)
+                    audioFile.read(audioInput.data(), segment_size, segment_size);
+
+                // generate a new segment of output samples, from the bound latent inputs, audio input and interpolation
+                model.run();
+            }
             
             outputSampleCnt = 0;
         }
@@ -165,5 +203,12 @@ void render(LDSPcontext *context, void *userData)
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-
+    audioFile.cleanup();
+    if(encodeOnce)
+    {
+        encoder.cleanup();
+        decoder.cleanup();
+    }
+    else
+        model.cleanup();
 }
\ No newline at end of file
@@ -1,155 +1,147 @@
 #include "LDSP.h"
-#include <libraries/OrtModel/OrtModel.h>
-#include <libraries/AudioFile/AudioFile.h>
-#include <fstream>
-#include <iostream>
-
-OrtModel model(true);
+#include "../../common/OrtModelRT.h"
+#include "../../common/LatentFile.h"
+#include "../../common/AsyncInference.h"
+#include "../../common/OverlapAdd.h"
+#include "../../common/RingBuffer.h"
+#include "../../common/StreamingAudioFile.h"
+
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+// session options, the model is split across several threads; prepare() warms it up with modelOptions.warmupRuns runs
+OrtModelRT::Options modelOptions = OrtModelRT::Options::largeModel();
 std::string modelType = "onnx";
 std::string modelName = "mixedInput_windowed_rawvae";
 
 const int segment_size = 1024;
-const int hop_size = segment_size/2;
+const int hop_size = segment_size/2; // must be the hop the windowed latent files were encoded with
 const int latent_dim = 256;
 
-float* inputs[4];
-float outputSegment[2][segment_size] = {0};
-float *output;
-int outputSegmentIdx = 0;
+float outputSegment[segment_size] = {0}; // filled by the model, then added to the overlap-add accumulator
+const float *output;
+
+OverlapAdd overlapAdd;
+OverlapAdd::Window synthesisWindow = OverlapAdd::none; // the models window their output already, the other windows are normalized to sum to one
 
 float interpolation = 0.5;
+float inputInterpolation; // copy passed to the model, so that interpolation can change while the worker is running
 
 std::string filename_mu = "472451__erokia__msfxp-sound-399_mu_windowed.lts";	// name of the mu bin file (in project folder)
-std::string filename_logvar = "472451__erokia__msfxp-sound-399_logvar_windowed.lts"; // name of the logvar bin file (in project folder)
+std::string filename_logvar = "472451__erokia__msfxp-sound-399_logvar_windowed.lts"; // name of the logvar bin file (in project folder), not used if the mu file is a packed container, see tools/lts_pack.py
 std::string filename_audio = "472454__erokia__msfxp-sound-402.wav";	// name of the sound file (in project folder)
-std::vector<float> muFileSamples;
-std::vector<float> logvarFileSamples;
-std::vector<float> audioFileSamples;
-int readPointer_mu = 0;
-int readPointer_logvar = 0;
-int readPointer_audioFile = 0;
-std::vector<float> muInput;
+LatentSequence latents; // memory-mapped mu and logvar frames
+StreamingAudioFile audioFile; // streamed in a loop by a background thread, see common/StreamingAudioFile.h
+int readPointer_latent = 0; // in latent frames
+std::vector<float> muInput; // bound to the model with audioInput, only float16 and int8 frames are converted into them, float32 frames are read in place
 std::vector<float> logvarInput;
 std::vector<float> audioInput;
 
 int outputSampleCnt = 0;
-int overlap_size;
-int overlap_start;
 
 bool liveInput = false;
-std::vector<float> liveInputSamples; // circular buffer
-int writePointer_liveIn;
-int readPointer_liveIn;
-
+RingBuffer<float> liveInputSamples; // holds the last segment_size input samples
 
+// if true, each segment is generated by a worker thread during the previous hop, adding one hop of latency
+// otherwise, the model runs in the audio thread at the beginning of each hop
+bool asyncInference = true;
+AsyncInference inference;
 
+void prepareInputs();
+void runInference();
 
-std::vector<float> read_binary_file(const std::string& filename) 
+// the model reads the float32 frames straight from the mapped files, through a tensor built over each of them here
+inline bool bindLatentFrames(OrtModelRT& model, int mu_index, const LatentSequence& latents)
 {
-    std::ifstream input(filename, std::ios::binary);
-    if (!input) 
-    {
-        std::cerr << "Error opening file: " << filename << std::endl;
-        return {};
-    }
-    // Get the size of the file
-    input.seekg(0, std::ios::end);
-    std::size_t size = input.tellg();
-    input.seekg(0, std::ios::beg);
-
-    // Read the content of the file into a vector
-    std::vector<float> buffer(size / sizeof(float));
-    input.read(reinterpret_cast<char*>(buffer.data()), size);
-    return buffer;
+    std::vector<const float*> mu;
+    std::vector<const float*> logvar;
+    latents.getFrames(mu, logvar);
+    return model.bindInputFrames(mu_index, mu) && model.bindInputFrames(mu_index+1, logvar);
 }
 
 bool setup(LDSPcontext *context, void *userData)
 {
-    std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
-    {
-        printf("unable to setup ortModel");
+    if(!latents.open(filename_mu, filename_logvar, latent_dim))
         return false;
-    }
-
-    muFileSamples = read_binary_file(filename_mu);
-    if(muFileSamples.empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_mu.c_str());
-    	return false;
-	}
-    logvarFileSamples = read_binary_file(filename_logvar);
-    if(logvarFileSamples.empty())
-    {
-    	printf("Error loading binary file '%s'\n", filename_logvar.c_str());
-    	return false;
-	}
+    if(latents.getMuFile().getHop() != 0 && latents.getMuFile().getHop() != hop_size)
+        printf("warning: '%s' was encoded with a hop of %d samples, %d used\n", filename_mu.c_str(), latents.getMuFile().getHop(), hop_size);
 
     muInput.resize(latent_dim);
     logvarInput.resize(latent_dim);
     
 
-    audioFileSamples = AudioFileUtilities::loadMono(filename_audio);	
-	if(audioFileSamples.size() == 0) 
-	{
-    	printf("Error loading audio file '%s'\n", filename_audio.c_str());
-    	return false;
-	}
+    if(!audioFile.setup(filename_audio))
+    {
+        printf("Error loading audio file '%s'\n", filename_audio.c_str());
+        return false;
+    }
 
     audioInput.resize(segment_size);
 
+    // inputs: mu and logvar of the latent frame, the audio segment and the interpolation
+    std::string modelPath = "./"+modelName+"."+modelType;
+    if(!model.setup("session1", modelPath, modelOptions) || model.getNumInputs() != 4 ||
+       !model.bindInput(0, muInput.data()) || !model.bindInput(1, logvarInput.data()) || !model.bindInput(2, audioInput.data()) ||
+       !model.bindInput(3, &inputInterpolation) || !model.bindOutput(0, outputSegment) || !bindLatentFrames(model, 0, latents) || !model.prepare())
+    {
+        printf("unable to setup model\n");
+        return false;
+    }
+
 
     if(liveInput) 
     {
-        liveInputSamples.resize(hop_size*10);
-        std::fill(liveInputSamples.begin(), liveInputSamples.end(), 0.0f); // we need zeros for proper initial overlap and add
-        writePointer_liveIn = hop_size; // the first hop_size samples will be left as zeros
-        readPointer_liveIn = 0;
+        liveInputSamples.setup(segment_size); // we need zeros for proper initial overlap and add
     }
 
     
     // for overlap and add mechanism
-    output = outputSegment[outputSegmentIdx];
-    overlap_size = segment_size - hop_size;
-    overlap_start = segment_size - overlap_size;
-
-    return true;
-}
-
-
-inline void fillInput(const std::vector<float>& file_samples, std::vector<float>& input, int& read_pointer, int hopSize=-1) 
-{
-    size_t remaining = file_samples.size() - read_pointer;
+    if(!overlapAdd.setup(segment_size, hop_size, synthesisWindow))
+        return false;
+    output = overlapAdd.getHop();
 
-    // no wrapping needed, copy directly
-    if (remaining >= input.size()) 
-        std::copy(file_samples.begin() + read_pointer, file_samples.begin() + read_pointer + input.size(), input.begin());
-    else // wrapping needed
+    if(asyncInference)
     {
-        // fill part of the input until the end of the file_samples vector
-        std::copy(file_samples.begin() + read_pointer, file_samples.end(), input.begin());
-        // wrap around and continue filling from the beginning of the file_samples vector
-        std::copy(file_samples.begin(), file_samples.begin() + input.size() - remaining, input.begin() + remaining);
+        if(!inference.setup(runInference))
+        {
+            printf("unable to start inference worker\n");
+            return false;
+        }
+        // the first segment is generated while the first hop is played
+        prepareInputs();
+        inference.trigger();
     }
 
-    // supports advancement of hop size only, to allow for overlapping behavior at next call
-    if(hopSize == -1)
-        hopSize = input.size();
-    read_pointer = (read_pointer + hopSize) % file_samples.size();
+    return true;
 }
 
 
-inline void fillLatentInput(const std::vector<float>& mu_samples, const std::vector<float>& logvar_samples, 
-                       std::vector<float>& mu_input, std::vector<float>& logvar_input, int& mu_read_pointer, int& logvar_read_pointer) 
+// selects the next mu and logvar frames, which the model reads in place, only float16 and int8 frames are converted into mu_input and logvar_input
+inline void fillLatentInput(OrtModelRT& model, int mu_index, const LatentSequence& latents, std::vector<float>& mu_input, std::vector<float>& logvar_input, int& read_pointer)
 {
     // windowed latent bin files are composed of spread out overlapping segments already, so no need for hop mechanism
-    fillInput(mu_samples, mu_input, mu_read_pointer);
-    fillInput(logvar_samples, logvar_input, logvar_read_pointer);
+    if(!latents.isFloat32())
+        latents.readFrame(read_pointer, mu_input.data(), logvar_input.data());
+    model.selectInputFrame(mu_index, read_pointer);
+    model.selectInputFrame(mu_index+1, read_pointer);
+    read_pointer = (read_pointer + 1) % latents.getNumFrames();
+}
+
+void prepareInputs()
+{
+    fillLatentInput(model, 0, latents, muInput, logvarInput, readPointer_latent);
+    // if live input, combine latent files with live input
+    if(liveInput)
+        std::copy(liveInputSamples.latest(segment_size), liveInputSamples.latest(segment_size) + segment_size, audioInput.begin()); // the segment that ends with the newest sample
+    else // otherwise, combine latent files with audio file
+        audioFile.read(audioInput.data(), segment_size, hop_size);
+    
+    // latent and audio inputs are already in place, add interpolation
+    inputInterpolation = interpolation;
 }
 
-inline void fillAudioInput(const std::vector<float>& audio_samples, std::vector<float>& audio_input, int& read_pointer, int hopSize) 
+// called by the worker thread
+void runInference()
 {
-    fillInput(audio_samples, audio_input, read_pointer, hopSize);
+    model.run();
 }
 
 void render(LDSPcontext *context, void *userData)
@@ -160,29 +152,32 @@ void render(LDSPcontext *context, void *userData)
         // generate new output samples when we run out of them
         if(outputSampleCnt >= hop_size)
         {
-            fillLatentInput(muFileSamples, logvarFileSamples, muInput, logvarInput, readPointer_mu, readPointer_logvar);
-            // if live input, combine latent files with live input
-            if(liveInput)
-                fillAudioInput(liveInputSamples, audioInput, readPointer_liveIn, hop_size);
-            else // otherwise, combine latent files with audio file
-                fillAudioInput(audioFileSamples, audioInput, readPointer_audioFile, hop_size);
-            
-            // combine letent inputs, audio input and interpolation into single input data structure
-            inputs[0] = muInput.data();
-            inputs[1] = logvarInput.data();
-            inputs[2] = audioInput.data();
-            inputs[3] = &interpolation;
-            
-            outputSegmentIdx = 1-outputSegmentIdx; // update current segment
-            output = outputSegment[outputSegmentIdx]; // point to current output segment to fill
-
-            // generate a new segment of output samples
-            model.run(inputs, output);
-            
-            // add first samples of current output segment with overlapping samples of previous output segment
-            for(int i=0; i<overlap_size; i++)
-                output[i] = outputSegment[outputSegmentIdx][i] + outputSegment[1-outputSegmentIdx][overlap_start+i];
-
+            overlapAdd.advance(); // the previous hop has been played
+
+            if(!asyncInference)
+            {
+                prepareInputs();
+
+                // generate a new segment of output samples
+                model.run();
+                overlapAdd.addSegment(outputSegment);
+            }
+            else if(inference.isDone())
+            {
+                overlapAdd.addSegment(outputSegment); // filled by the worker during the previous hop
+
+                // let the worker generate the next segment during this hop
+                prepareInputs();
+                inference.trigger();
+            }
+            else
+            {
+                // the worker is late, play what the previous segments left in this hop rather than waiting,
+                // i.e., their tails, or silence once those have been played
+                inference.markLate();
+            }
+
+            output = overlapAdd.getHop();
             outputSampleCnt = 0;
         }
     
@@ -192,8 +187,7 @@ void render(LDSPcontext *context, void *userData)
         // if live input, fill live input circular buffer 
         if(liveInput)
         {
-            liveInputSamples[writePointer_liveIn] = audioRead(context, n, 0); 
-            writePointer_liveIn = (writePointer_liveIn + 1) % liveInputSamples.size();
+            liveInputSamples.push(audioRead(context, n, 0));
         }
 
         outputSampleCnt++;
@@ -202,5 +196,12 @@ void render(LDSPcontext *context, void *userData)
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-
+    if(asyncInference)
+    {
+        inference.cleanup();
+        if(inference.getLateCount() > 0)
+            printf("inference worker was late %d times\n", inference.getLateCount());
+    }
+    audioFile.cleanup();
+    model.cleanup();
 }
\ No newline at end of file
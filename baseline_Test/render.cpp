@@ -1,21 +1,43 @@
 #include "LDSP.h"
-#include "libraries/OrtModel/OrtModel.h"
+#include "../common/OrtModelRT.h"
+#include <vector>
 
 std::string modelType = "onnx";
 std::string modelName = "baseline";
 int numInputSamples = 1;
 
-OrtModel model;
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+OrtModelRT::Options modelOptions; // session options, the default is a single thread that does not spin
 
 float input[1] = {0};
 float output[1];
 
+// if true, the whole period goes through a single run, as a batch of audioFrames samples
+// the model with a dynamic frames axis is derived with tools/make_model_variants.py frames-dynamic
+bool blockInference = false;
+std::string blockModelName = "baseline_block";
+OrtModelRT blockModel;
+std::vector<float> blockInput;
+std::vector<float> blockOutput;
+
 
 bool setup(LDSPcontext *context, void *userData) {
 
-  std::string modelPath = "./"+modelName+"."+modelType;
-  if (!model.setup("session1", modelPath))
-    printf("unable to setup model\n");
+  if(blockInference) {
+    blockInput.assign(context->audioFrames, 0);
+    blockOutput.assign(context->audioFrames, 0);
+    std::string modelPath = "./"+blockModelName+"."+modelType;
+    if(!blockModel.setup("session1", modelPath, modelOptions) || !blockModel.bindInput(0, blockInput.data(), {context->audioFrames, 1}) ||
+       !blockModel.bindOutput(0, blockOutput.data(), {context->audioFrames, 1}) || !blockModel.prepare()) {
+      printf("unable to setup block model\n");
+      return false;
+    }
+  }
+  else {
+    std::string modelPath = "./"+modelName+"."+modelType;
+    if (!model.setup("session1", modelPath, modelOptions) || !model.bindInput(0, input) || !model.bindOutput(0, output) || !model.prepare())
+      printf("unable to setup model\n");
+  }
 
   return true;
 }
@@ -27,16 +49,25 @@ void render(LDSPcontext *context, void *userData)
     float out = audioRead(context, n, 0);
 
     // Run the model
-    model.run(input, output);
+    if(blockInference)
+      blockInput[n] = out;
+    else
+      model.run();
 
     // passthrough test, because the model may not be trained
     audioWrite(context, n, 0, out);
     audioWrite(context, n, 1, out);
   }
+
+  if(blockInference)
+    blockModel.run();
 }
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-  model.cleanup();
+  if(blockInference)
+    blockModel.cleanup();
+  else
+    model.cleanup();
 }
 
@@ -1,9 +1,12 @@
 #include "LDSP.h"
-#include "libraries/OrtModel/OrtModel.h"
+#include "../common/OrtModelRT.h"
 #include <chrono>
-#include <fstream> // ofstream
+#include "../common/LatencyHistogram.h"
+#include "../common/DeadlineMonitor.h"
+#include "../common/TimingLogWriter.h"
 
-OrtModel model;
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+OrtModelRT::Options modelOptions; // session options, the default is a single thread that does not spin
 
 float input[1];
 float output[1] = {0};
@@ -13,40 +16,58 @@ int outputSize = 1;
 //-------------------------------
 std::string modelType = "onnx";
 std::string modelName = "baseline";
+// if true, loads the int8 variant <modelName>_int8.onnx, produced and qualified by tools/quantize_models.py
+bool quantizedModel = false;
 
-unsigned long long * inferenceTimes;
-int logPtr = 0;
+std::string timingLogDir = ".";
+TimingLogWriter timingLog; // streams inference times to a binary file
+long long logCnt = 0;
 constexpr int testDuration_sec = 10;
-int numLogs;
+long long numLogs;
+LatencyHistogram inferenceHistogram; // nanoseconds
+
+float deadlineBudgetFraction = 0.75; // callbacks longer than this fraction of the period duration count as deadline misses
+DeadlineMonitor deadlineMonitor; // times the whole render() callback
+int maxStoredMisses = 4096; // further misses are counted, but their indices are not stored
 
 bool setup(LDSPcontext *context, void *userData)
 {
+    if(quantizedModel)
+        modelName += "_int8";
+
     std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
+    if (!model.setup("session1", modelPath, modelOptions) || !model.bindInput(0, input) || !model.bindOutput(0, output) || !model.prepare())
       printf("unable to setup model\n");
 
     //--------------------------------
-    inferenceTimes = new unsigned long long[context->audioSampleRate*testDuration_sec*1.01];
     numLogs = context->audioSampleRate*testDuration_sec / outputSize; // division to handle case of models outputting a block of samples
+    std::string timingLogFileName = "inferenceTiming_"+modelName+"_out"+std::to_string(outputSize)+"_onnx.tlog";
+    if(!timingLog.setup(timingLogDir+"/"+timingLogFileName, modelName, context->audioSampleRate, context->audioFrames, outputSize))
+        return false;
+    deadlineMonitor.setup(context->audioFrames, context->audioSampleRate, deadlineBudgetFraction, maxStoredMisses);
 
     return true;
 }
 
 void render(LDSPcontext *context, void *userData)
 {
+  deadlineMonitor.beginPeriod();
+
   for(int n=0; n<context->audioFrames; n++)
   {
     input[0] = audioRead(context, n, 0);
 
     // Start the Clock
-    auto start_time = std::chrono::high_resolution_clock::now();
+    auto start_time = std::chrono::steady_clock::now();
     
-    model.run(input, output);
+    model.run();
 
     // Stop the clock  
-    auto end_time = std::chrono::high_resolution_clock::now();
-    inferenceTimes[logPtr] = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
-    logPtr++;
+    auto end_time = std::chrono::steady_clock::now();
+    unsigned long long inferenceTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+    inferenceHistogram.record(inferenceTime);
+    timingLog.push(inferenceTime);
+    logCnt++;
 
 
 
@@ -54,26 +75,19 @@ void render(LDSPcontext *context, void *userData)
     audioWrite(context, n, 0, input[0]);
     audioWrite(context, n, 1, input[0]);
 
-    if(logPtr>=numLogs)
+    if(logCnt>=numLogs)
       LDSP_requestStop();
   }
+
+  deadlineMonitor.endPeriod();
 }
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-  std::string timingLogDir = ".";
-  std::string timingLogFileName = "inferenceTiming_"+modelName+"_out"+std::to_string(outputSize)+"_onnx.txt";
-  std::string timingLogFilePath = timingLogDir+"/"+timingLogFileName;
-
-  std::ofstream logFile(timingLogFilePath);
-  if(logFile.is_open())
-  {
-    for (int i=0;i<numLogs; i++)
-      logFile << std::to_string(inferenceTimes[i]) << "\n";
-  }
-  logFile.close();
+  inferenceHistogram.printReport(("inference "+modelName).c_str());
+  deadlineMonitor.printReport(("render "+modelName).c_str());
 
-  delete[] inferenceTimes;
+  timingLog.cleanup();
 
   model.cleanup();
 }
\ No newline at end of file
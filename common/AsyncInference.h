@@ -0,0 +1,102 @@
+#ifndef ASYNC_INFERENCE_H_
+#define ASYNC_INFERENCE_H_
+
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <thread>
+#include <pthread.h>
+#include <semaphore.h>
+
+// Runs an inference job on a dedicated worker thread, so that the audio thread never waits for the model.
+// The audio thread prepares the job's inputs, calls trigger() and collects the result at a later callback,
+// once isDone() returns true. Neither call blocks: trigger() posts a semaphore and isDone() is an atomic load.
+// The job's inputs and outputs must not be touched by the audio thread while the job is busy.
+class AsyncInference
+{
+public:
+    AsyncInference() {}
+    ~AsyncInference() { cleanup(); }
+
+    // priority > 0 runs the worker with SCHED_FIFO at that priority, which should be lower than the audio thread's
+    bool setup(std::function<void()> job, int priority = 0)
+    {
+        cleanup();
+        this->job = job;
+        if(sem_init(&jobSem, 0, 0) != 0)
+            return false;
+        state.store(idle);
+        lateCount = 0;
+        running = true;
+        worker = std::thread(&AsyncInference::loop, this);
+
+        if(priority > 0)
+        {
+            sched_param param;
+            param.sched_priority = priority;
+            if(pthread_setschedparam(worker.native_handle(), SCHED_FIFO, &param) != 0)
+                printf("AsyncInference: unable to set worker priority to %d, running with default policy\n", priority);
+        }
+        return true;
+    }
+
+    // starts a new job, returns false if the previous one is still running
+    bool trigger()
+    {
+        if(state.load(std::memory_order_acquire) == busy)
+            return false;
+        state.store(busy, std::memory_order_release);
+        sem_post(&jobSem);
+        return true;
+    }
+
+    // true when the last triggered job has completed and its outputs can be read
+    bool isDone() const
+    {
+#ifdef LDSP_HOST_RUNNER
+        // offline renders must not depend on timing, so wait for the worker rather than reporting it late
+        while(state.load(std::memory_order_acquire) == busy)
+            std::this_thread::yield();
+#endif
+        return state.load(std::memory_order_acquire) == done;
+    }
+    bool isBusy() const { return state.load(std::memory_order_acquire) == busy; }
+
+    // counts a period in which the job's result was not ready when the audio thread needed it
+    void markLate() { lateCount++; }
+    int getLateCount() const { return lateCount; }
+
+    void cleanup()
+    {
+        if(!worker.joinable())
+            return;
+        running = false;
+        sem_post(&jobSem);
+        worker.join();
+        sem_destroy(&jobSem);
+    }
+
+private:
+    enum JobState { idle, busy, done };
+
+    void loop()
+    {
+        while(true)
+        {
+            sem_wait(&jobSem);
+            if(!running)
+                break;
+            job();
+            state.store(done, std::memory_order_release);
+        }
+    }
+
+    std::function<void()> job;
+    std::thread worker;
+    sem_t jobSem;
+    std::atomic<int> state{idle};
+    std::atomic<bool> running{false};
+    int lateCount = 0; // only accessed by the audio thread
+};
+
+#endif /* ASYNC_INFERENCE_H_ */
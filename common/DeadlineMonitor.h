@@ -0,0 +1,90 @@
+#ifndef DEADLINE_MONITOR_H_
+#define DEADLINE_MONITOR_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "LatencyHistogram.h"
+
+// Times whole audio callbacks against the real-time budget of a period, i.e., audioFrames/audioSampleRate.
+// A callback that takes longer than budgetFraction of the budget counts as a deadline miss,
+// leaving the rest of the period to the audio driver and to the rest of the system.
+// The index of each miss is stored in a buffer preallocated in setup(), so beginPeriod() and endPeriod() can run on the audio thread.
+class DeadlineMonitor
+{
+public:
+    DeadlineMonitor() {}
+
+    void setup(int periodFrames, float sampleRate, float budgetFraction, int maxMisses)
+    {
+        this->budgetFraction = budgetFraction;
+        budget_ns = (uint64_t)(1e9 * periodFrames / sampleRate);
+        threshold_ns = (uint64_t)(budget_ns * budgetFraction);
+        missIndices.resize(maxMisses);
+        numMisses = 0;
+        numPeriods = 0;
+        worst_ns = 0;
+        worstIndex = -1;
+        callbackHistogram.reset();
+    }
+
+    void beginPeriod()
+    {
+        start_ns = LatencyHistogram::now();
+    }
+
+    void endPeriod()
+    {
+        uint64_t duration = LatencyHistogram::now() - start_ns;
+        callbackHistogram.record(duration);
+        if(duration > worst_ns)
+        {
+            worst_ns = duration;
+            worstIndex = numPeriods;
+        }
+        if(duration > threshold_ns)
+        {
+            if(numMisses < (int64_t)missIndices.size())
+                missIndices[numMisses] = numPeriods;
+            numMisses++;
+        }
+        numPeriods++;
+    }
+
+    int64_t getNumPeriods() const { return numPeriods; }
+    int64_t getNumMisses() const { return numMisses; }
+    double getMissRate() const { return numPeriods ? (double)numMisses/numPeriods : 0; }
+    uint64_t getWorst() const { return worst_ns; }
+    const LatencyHistogram& getHistogram() const { return callbackHistogram; }
+
+    void printReport(const char *label, int maxPrintedMisses = 32) const
+    {
+        printf("%s: %lld/%lld periods over %.0f%% of the %llu ns budget (miss rate %.4f%%), worst callback %llu ns (%.1f%% of budget) at period %lld\n",
+               label, (long long)numMisses, (long long)numPeriods, budgetFraction*100, (unsigned long long)budget_ns,
+               getMissRate()*100, (unsigned long long)worst_ns, budget_ns ? 100.0*worst_ns/budget_ns : 0, (long long)worstIndex);
+        callbackHistogram.printReport(label);
+
+        if(numMisses == 0)
+            return;
+        int64_t stored = numMisses < (int64_t)missIndices.size() ? numMisses : missIndices.size();
+        int64_t printed = stored < maxPrintedMisses ? stored : maxPrintedMisses;
+        printf("%s: missed periods", label);
+        for(int64_t i=0; i<printed; i++)
+            printf(" %lld", (long long)missIndices[i]);
+        printf(numMisses > printed ? " ...\n" : "\n");
+    }
+
+private:
+    float budgetFraction = 1;
+    uint64_t budget_ns = 0;
+    uint64_t threshold_ns = 0;
+    uint64_t start_ns = 0;
+    uint64_t worst_ns = 0;
+    int64_t worstIndex = -1;
+    int64_t numPeriods = 0;
+    int64_t numMisses = 0;
+    std::vector<int64_t> missIndices;
+    LatencyHistogram callbackHistogram;
+};
+
+#endif /* DEADLINE_MONITOR_H_ */
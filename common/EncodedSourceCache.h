@@ -0,0 +1,71 @@
+#ifndef ENCODED_SOURCE_CACHE_H_
+#define ENCODED_SOURCE_CACHE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Latent frames of a looping file source, for models split into an encoder and a decoder.
+// The source is cut into segments, hop samples apart, that are encoded the first time they are played;
+// from the second loop on, their frames come from memory and the encoder does not run for this source.
+// The loop is the file length rounded up to a whole number of hops, the last segment being completed with the start of the file,
+// as it is in the first pass. All the frames are allocated in setup(), so the audio thread does not allocate.
+class EncodedSourceCache
+{
+public:
+    EncodedSourceCache() {}
+
+    bool setup(size_t fileFrames, int hop, int latentDim)
+    {
+        if(fileFrames == 0 || hop <= 0 || latentDim <= 0)
+        {
+            printf("EncodedSourceCache: invalid source of %zu frames, hop %d, latent size %d\n", fileFrames, hop, latentDim);
+            return false;
+        }
+        this->latentDim = latentDim;
+        numFrames = (fileFrames + hop - 1)/hop;
+        mu.assign((size_t)numFrames*latentDim, 0);
+        logvar.assign((size_t)numFrames*latentDim, 0);
+        encoded.assign(numFrames, 0);
+        encodedCount = 0;
+        frame = 0;
+        return true;
+    }
+
+    // current frame
+    int getFrame() const { return frame; }
+    bool isEncoded() const { return encoded[frame]; }
+    const float* getMu() const { return mu.data() + (size_t)frame*latentDim; }
+    const float* getLogvar() const { return logvar.data() + (size_t)frame*latentDim; }
+
+    // keeps the latents of the current frame
+    void store(const float *frameMu, const float *frameLogvar)
+    {
+        std::copy(frameMu, frameMu + latentDim, mu.begin() + (size_t)frame*latentDim);
+        std::copy(frameLogvar, frameLogvar + latentDim, logvar.begin() + (size_t)frame*latentDim);
+        if(!encoded[frame])
+        {
+            encoded[frame] = 1;
+            encodedCount++;
+        }
+    }
+
+    // moves to the next frame, looping
+    void advance() { frame = frame+1 < numFrames ? frame+1 : 0; }
+
+    // once complete, the source is not needed anymore
+    bool isComplete() const { return encodedCount == numFrames; }
+    int getNumFrames() const { return numFrames; }
+
+private:
+    int latentDim = 0;
+    int numFrames = 0;
+    std::vector<float> mu; // [numFrames, latentDim]
+    std::vector<float> logvar;
+    std::vector<uint8_t> encoded;
+    int encodedCount = 0;
+    int frame = 0;
+};
+
+#endif /* ENCODED_SOURCE_CACHE_H_ */
@@ -0,0 +1,136 @@
+#ifndef LATENCY_HISTOGRAM_H_
+#define LATENCY_HISTOGRAM_H_
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+
+// Log-linear histogram of durations in nanoseconds, safe to fill from the audio thread.
+// Values below subBuckets are stored exactly, larger values go into one of subBuckets linear buckets per power of two,
+// for a worst case relative error of 1/subBuckets (~6%) on the reported percentiles.
+// All the storage is preallocated in the object, record() is a handful of integer ops and never allocates.
+class LatencyHistogram
+{
+public:
+    static constexpr int subBucketBits = 4;
+    static constexpr int subBuckets = 1<<subBucketBits;
+    static constexpr int numBuckets = subBuckets + (64-subBucketBits)*subBuckets;
+
+    LatencyHistogram() { reset(); }
+
+    static uint64_t now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void reset()
+    {
+        for(int i=0; i<numBuckets; i++)
+            counts[i] = 0;
+        count = 0;
+        min = std::numeric_limits<uint64_t>::max();
+        max = 0;
+        sum = 0;
+        sumSquares = 0;
+    }
+
+    void record(uint64_t ns)
+    {
+        counts[bucketIndex(ns)]++;
+        count++;
+        if(ns < min)
+            min = ns;
+        if(ns > max)
+            max = ns;
+        sum += ns;
+        sumSquares += (double)ns*ns;
+    }
+
+    uint64_t getCount() const { return count; }
+    uint64_t getMin() const { return count ? min : 0; }
+    uint64_t getMax() const { return max; }
+    double getMean() const { return count ? (double)sum/count : 0; }
+
+    // standard deviation, i.e., the jitter around the mean
+    double getJitter() const
+    {
+        if(count < 2)
+            return 0;
+        double mean = getMean();
+        double variance = sumSquares/count - mean*mean;
+        return variance > 0 ? std::sqrt(variance) : 0;
+    }
+
+    // value below which the given percentage [0, 100] of the recorded durations falls
+    uint64_t getPercentile(double percentile) const
+    {
+        if(count == 0)
+            return 0;
+        uint64_t rank = (uint64_t)std::ceil(percentile/100.0 * count);
+        if(rank < 1)
+            rank = 1;
+        uint64_t cumulative = 0;
+        for(int i=0; i<numBuckets; i++)
+        {
+            cumulative += counts[i];
+            if(cumulative >= rank)
+            {
+                // middle of the bucket, clipped to the exact extremes
+                uint64_t value = bucketLowerBound(i) + (bucketWidth(i)-1)/2;
+                if(value < min)
+                    value = min;
+                if(value > max)
+                    value = max;
+                return value;
+            }
+        }
+        return max;
+    }
+
+    void printReport(const char *label) const
+    {
+        printf("%s: %llu samples [ns] min %llu | p50 %llu | p90 %llu | p99 %llu | p99.9 %llu | max %llu | mean %.1f | jitter %.1f\n",
+               label, (unsigned long long)count, (unsigned long long)getMin(),
+               (unsigned long long)getPercentile(50), (unsigned long long)getPercentile(90),
+               (unsigned long long)getPercentile(99), (unsigned long long)getPercentile(99.9),
+               (unsigned long long)getMax(), getMean(), getJitter());
+    }
+
+private:
+    static int bucketIndex(uint64_t ns)
+    {
+        if(ns < (uint64_t)subBuckets)
+            return (int)ns;
+        int msb = 63 - __builtin_clzll(ns);
+        int exponent = msb - subBucketBits;
+        int mantissa = (int)(ns >> exponent) - subBuckets; // in [0, subBuckets)
+        return subBuckets + exponent*subBuckets + mantissa;
+    }
+
+    static uint64_t bucketLowerBound(int index)
+    {
+        if(index < subBuckets)
+            return index;
+        int exponent = (index-subBuckets) / subBuckets;
+        int mantissa = (index-subBuckets) % subBuckets;
+        return (uint64_t)(subBuckets+mantissa) << exponent;
+    }
+
+    static uint64_t bucketWidth(int index)
+    {
+        if(index < subBuckets)
+            return 1;
+        return (uint64_t)1 << ((index-subBuckets) / subBuckets);
+    }
+
+    uint64_t counts[numBuckets];
+    uint64_t count;
+    uint64_t min;
+    uint64_t max;
+    uint64_t sum;
+    double sumSquares;
+};
+
+#endif /* LATENCY_HISTOGRAM_H_ */
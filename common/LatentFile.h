@@ -0,0 +1,334 @@
+#ifndef LATENT_FILE_H_
+#define LATENT_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Packed .lts container, little-endian, written by tools/lts_pack.py:
+// - a LatentFileHeader
+// - numFrames frame records, each frameStride bytes long (a multiple of 64, so that every frame starts on a cache line)
+// A record holds the mu values of the frame followed by its logvar values, as:
+// - float32: float mu[latentDim], float logvar[latentDim]
+// - float16: uint16_t mu[latentDim], uint16_t logvar[latentDim], IEEE half precision
+// - int8:    float muScale, muOffset, logvarScale, logvarOffset, int8_t mu[latentDim], int8_t logvar[latentDim],
+//            where value = offset + scale*q
+// Files that do not start with the magic are raw float32 dumps of a single stream (either mu or logvar), as exported originally.
+struct LatentFileHeader
+{
+    char magic[8];          // "LDSPLTS\0"
+    uint32_t version;
+    uint32_t headerSize;    // records start right after, sizeof(LatentFileHeader)
+    uint32_t latentDim;
+    uint32_t numFrames;
+    uint32_t hop;           // audio samples between consecutive frames, 0 if unknown
+    uint32_t flags;         // LatentFile::Flags
+    uint32_t dataType;      // LatentFile::DataType
+    uint32_t frameStride;   // bytes
+    uint32_t checksum;      // CRC-32 of all the records
+    uint32_t reserved[5];
+};
+static_assert(sizeof(LatentFileHeader) == 64, "LatentFileHeader must stay packed");
+
+// Read-only view of a .lts latent file, either a packed container or a raw float32 dump of latentDim-sized frames.
+// The file is memory-mapped rather than copied into a vector, so setup() does not read it all in,
+// and its pages are shared among processes and can be evicted by the OS, since they are backed by the file.
+class LatentFile
+{
+public:
+    enum DataType { float32 = 0, float16 = 1, int8 = 2 };
+    enum Flags { windowed = 1 };
+    enum Stream { mu = 0, logvar = 1 };
+
+    LatentFile() {}
+    ~LatentFile() { close(); }
+
+    LatentFile(const LatentFile&) = delete;
+    LatentFile& operator=(const LatentFile&) = delete;
+
+    bool open(const std::string &path, int latentDim)
+    {
+        close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+        {
+            printf("LatentFile: unable to open '%s'\n", path.c_str());
+            return false;
+        }
+        struct stat info;
+        if(fstat(fd, &info) != 0 || info.st_size == 0)
+        {
+            printf("LatentFile: '%s' is empty\n", path.c_str());
+            ::close(fd);
+            return false;
+        }
+
+        void *mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping stays valid
+        if(mapped == MAP_FAILED)
+        {
+            printf("LatentFile: unable to map '%s'\n", path.c_str());
+            return false;
+        }
+        mapping = (const uint8_t*)mapped;
+        mappingSize = info.st_size;
+        prefault();
+
+        bool valid = isPacked() ? parseHeader(path, latentDim) : parseRaw(path, latentDim);
+        if(!valid)
+            close();
+        return valid;
+    }
+
+    void close()
+    {
+        if(mapping)
+            munmap((void*)mapping, mappingSize);
+        mapping = nullptr;
+        mappingSize = 0;
+        packed = false;
+    }
+
+    bool isOpen() const { return mapping != nullptr; }
+    bool isPacked() const { return mappingSize >= sizeof(LatentFileHeader) && memcmp(mapping, "LDSPLTS\0", 8) == 0; }
+    int getNumStreams() const { return packed ? 2 : 1; } // packed containers hold mu and logvar, raw files only one of them
+
+    int getLatentDim() const { return latentDim; }
+    size_t getNumFrames() const { return numFrames; }
+    int getHop() const { return hop; }
+    bool isWindowed() const { return flags & windowed; }
+    DataType getDataType() const { return dataType; }
+
+    // direct pointer to the values of a frame, only available for float32 data, nullptr otherwise
+    const float* getFrameData(size_t frame, int stream = 0) const
+    {
+        if(dataType != float32)
+            return nullptr;
+        return (const float*)(record(frame) + stream*latentDim*sizeof(float));
+    }
+
+    // copies the values of a frame into dst, converting them to float
+    void readFrame(size_t frame, int stream, float *dst) const
+    {
+        const uint8_t *rec = record(frame);
+        if(dataType == float32)
+            memcpy(dst, rec + stream*latentDim*sizeof(float), latentDim*sizeof(float));
+        else if(dataType == float16)
+        {
+            const uint16_t *src = (const uint16_t*)rec + stream*latentDim;
+            for(int i=0; i<latentDim; i++)
+                dst[i] = halfToFloat(src[i]);
+        }
+        else
+        {
+            const float *params = (const float*)rec + 2*stream; // scale, offset
+            const int8_t *src = (const int8_t*)(rec + 4*sizeof(float)) + stream*latentDim;
+            for(int i=0; i<latentDim; i++)
+                dst[i] = params[1] + params[0]*src[i];
+        }
+    }
+
+private:
+    // frames are read from the audio thread, possibly straight from the mapping, so all pages are loaded now
+    // they are not locked, so they stay shared and evictable, a page evicted under memory pressure is read back from the file
+    void prefault()
+    {
+        madvise((void*)mapping, mappingSize, MADV_WILLNEED);
+        volatile uint8_t sum = 0;
+        for(size_t i=0; i<mappingSize; i+=4096)
+            sum += mapping[i];
+        (void)sum;
+    }
+
+    bool parseRaw(const std::string &path, int latentDim)
+    {
+        if(mappingSize % (latentDim*sizeof(float)) != 0)
+        {
+            printf("LatentFile: '%s' is not a sequence of %d-dimensional float latent frames\n", path.c_str(), latentDim);
+            return false;
+        }
+        packed = false;
+        this->latentDim = latentDim;
+        numFrames = mappingSize/(latentDim*sizeof(float));
+        hop = 0;
+        flags = 0;
+        dataType = float32;
+        frameStride = latentDim*sizeof(float);
+        records = mapping;
+        return true;
+    }
+
+    bool parseHeader(const std::string &path, int latentDim)
+    {
+        LatentFileHeader header;
+        memcpy(&header, mapping, sizeof(header));
+        if(header.version != 1 || header.headerSize < sizeof(LatentFileHeader) || header.headerSize % 64 != 0)
+        {
+            printf("LatentFile: '%s' has unsupported version %u\n", path.c_str(), header.version);
+            return false;
+        }
+        if((int)header.latentDim != latentDim)
+        {
+            printf("LatentFile: '%s' has %u-dimensional latent frames, %d expected\n", path.c_str(), header.latentDim, latentDim);
+            return false;
+        }
+        size_t minStride = 0;
+        if(header.dataType == float32)
+            minStride = 2*latentDim*sizeof(float);
+        else if(header.dataType == float16)
+            minStride = 2*latentDim*sizeof(uint16_t);
+        else if(header.dataType == int8)
+            minStride = 4*sizeof(float) + 2*latentDim;
+        if(minStride == 0 || header.frameStride < minStride || header.frameStride % 64 != 0 || header.numFrames == 0 ||
+           header.headerSize + (uint64_t)header.numFrames*header.frameStride > mappingSize)
+        {
+            printf("LatentFile: '%s' is truncated or corrupted\n", path.c_str());
+            return false;
+        }
+        if(crc32(mapping + header.headerSize, (size_t)header.numFrames*header.frameStride) != header.checksum)
+        {
+            printf("LatentFile: '%s' fails its checksum\n", path.c_str());
+            return false;
+        }
+
+        packed = true;
+        this->latentDim = latentDim;
+        numFrames = header.numFrames;
+        hop = header.hop;
+        flags = header.flags;
+        dataType = (DataType)header.dataType;
+        frameStride = header.frameStride;
+        records = mapping + header.headerSize;
+        return true;
+    }
+
+    const uint8_t* record(size_t frame) const { return records + frame*frameStride; }
+
+    static float halfToFloat(uint16_t h)
+    {
+        uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+        uint32_t exponent = (h >> 10) & 0x1f;
+        uint32_t mantissa = h & 0x3ff;
+        uint32_t bits;
+        if(exponent == 0x1f) // inf or nan
+            bits = sign | 0x7f800000 | (mantissa << 13);
+        else if(exponent != 0)
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        else if(mantissa == 0)
+            bits = sign;
+        else // subnormal half, normal float
+        {
+            exponent = 113;
+            while(!(mantissa & 0x400))
+            {
+                mantissa <<= 1;
+                exponent--;
+            }
+            bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+        }
+        float f;
+        memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    // same as zlib's crc32(), used by tools/lts_pack.py
+    static uint32_t crc32(const uint8_t *data, size_t size)
+    {
+        static uint32_t table[256] = {0};
+        if(table[1] == 0)
+        {
+            for(uint32_t i=0; i<256; i++)
+            {
+                uint32_t c = i;
+                for(int k=0; k<8; k++)
+                    c = c & 1 ? 0xedb88320 ^ (c >> 1) : c >> 1;
+                table[i] = c;
+            }
+        }
+        uint32_t crc = 0xffffffff;
+        for(size_t i=0; i<size; i++)
+            crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+        return crc ^ 0xffffffff;
+    }
+
+    const uint8_t *mapping = nullptr;
+    size_t mappingSize = 0;
+    bool packed = false;
+    const uint8_t *records = nullptr;
+    int latentDim = 0;
+    size_t numFrames = 0;
+    int hop = 0;
+    uint32_t flags = 0;
+    DataType dataType = float32;
+    size_t frameStride = 0;
+};
+
+// The mu and logvar frames of a sound, either from a single packed container or from a pair of raw files read in lockstep.
+class LatentSequence
+{
+public:
+    // logvarPath is not used if muPath is a packed container
+    bool open(const std::string &muPath, const std::string &logvarPath, int latentDim)
+    {
+        if(!muFile.open(muPath, latentDim))
+            return false;
+        logvarFile.close();
+        if(muFile.isPacked())
+            return true;
+
+        if(!logvarFile.open(logvarPath, latentDim))
+            return false;
+        if(logvarFile.isPacked() || logvarFile.getNumFrames() != muFile.getNumFrames())
+        {
+            printf("LatentSequence: '%s' and '%s' do not have the same number of latent frames\n", muPath.c_str(), logvarPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    size_t getNumFrames() const { return muFile.getNumFrames(); }
+    int getLatentDim() const { return muFile.getLatentDim(); }
+    const LatentFile& getMuFile() const { return muFile; }
+
+    // true if the frames can be read in place, see getFrames(), otherwise they must be converted with readFrame()
+    bool isFloat32() const { return muFile.getDataType() == LatentFile::float32; }
+
+    // pointers to the mu and logvar values of every frame, straight into the mapped files,
+    // e.g., to build a tensor over each frame once rather than copying the frame at every segment
+    // the pointers are nullptr for frames stored as float16 or int8
+    void getFrames(std::vector<const float*> &mu, std::vector<const float*> &logvar) const
+    {
+        const LatentFile &logvarSource = muFile.isPacked() ? muFile : logvarFile;
+        int logvarStream = muFile.isPacked() ? LatentFile::logvar : 0;
+        mu.resize(getNumFrames());
+        logvar.resize(getNumFrames());
+        for(size_t frame=0; frame<getNumFrames(); frame++)
+        {
+            mu[frame] = muFile.getFrameData(frame, LatentFile::mu);
+            logvar[frame] = logvarSource.getFrameData(frame, logvarStream);
+        }
+    }
+
+    void readFrame(size_t frame, float *mu, float *logvar) const
+    {
+        muFile.readFrame(frame, LatentFile::mu, mu);
+        if(muFile.isPacked())
+            muFile.readFrame(frame, LatentFile::logvar, logvar);
+        else
+            logvarFile.readFrame(frame, 0, logvar);
+    }
+
+private:
+    LatentFile muFile; // or packed container
+    LatentFile logvarFile;
+};
+
+#endif /* LATENT_FILE_H_ */
@@ -0,0 +1,131 @@
+#ifndef LTS_VOICE_ENGINE_H_
+#define LTS_VOICE_ENGINE_H_
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "OrtModelRT.h"
+#include "LatentFile.h"
+
+// A Latent Timbre Synthesis voice: interpolates between the latent frames of two sources, read in a loop.
+struct LtsVoice
+{
+    const LatentSequence *sources[2] = {nullptr, nullptr};
+    int readPointer[2] = {0, 0}; // in latent frames
+    float interpolation = 0.5;
+    float gain = 1;
+    bool active = false;
+};
+
+// Many LTS voices played by a single decoder session.
+// At every segment, the frames of all the active voices are gathered into the rows of a batch and decoded in one run,
+// then the segments of the voices are mixed. Only as many rows as active voices are decoded.
+// The decoder takes mu and logvar of the first source, mu and logvar of the second one and the interpolation,
+// as the latentInput models, and must have been exported with a dynamic batch axis first in all its inputs and outputs.
+// The mix is linear, so it can go through a single overlap-add for windowed models.
+class LtsVoiceEngine
+{
+public:
+    LtsVoiceEngine() {}
+
+    bool setup(std::string sessionName, std::string modelPath, int maxVoices, int latentDim, int segmentSize,
+               const OrtModelRT::Options &options = OrtModelRT::Options())
+    {
+        this->latentDim = latentDim;
+        this->segmentSize = segmentSize;
+        voices.assign(maxVoices, LtsVoice());
+        rows.resize(maxVoices);
+
+        if(!decoder.setup(sessionName, modelPath, options))
+            return false;
+        if(decoder.getNumInputs() != 5 || decoder.getNumOutputs() < 1)
+        {
+            printf("LtsVoiceEngine: '%s' does not have the inputs of a latentInput model\n", modelPath.c_str());
+            return false;
+        }
+        for(int i=0; i<4; i++)
+            latents[i].assign(maxVoices*latentDim, 0);
+        interpolations.assign(maxVoices, 0);
+        output.assign(maxVoices*segmentSize, 0);
+
+        for(int i=0; i<4; i++)
+        {
+            if(!decoder.bindInput(i, latents[i].data(), batchShape(decoder.getInputShape(i), maxVoices)))
+                return false;
+        }
+        if(!decoder.bindInput(4, interpolations.data(), batchShape(decoder.getInputShape(4), maxVoices)) ||
+           !decoder.bindOutput(0, output.data(), batchShape(decoder.getOutputShape(0), maxVoices)) || !decoder.prepareBatches())
+        {
+            printf("LtsVoiceEngine: unable to bind a batch of %d voices to '%s'\n", maxVoices, modelPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    int getMaxVoices() const { return voices.size(); }
+    LtsVoice& getVoice(int index) { return voices[index]; }
+
+    // decodes the next segment of all the active voices with a single run and writes their mix into segmentSize samples,
+    // returns the number of voices decoded
+    int renderSegment(float *mix)
+    {
+        int count = 0;
+        for(size_t v=0; v<voices.size(); v++)
+        {
+            LtsVoice &voice = voices[v];
+            if(!voice.active || !voice.sources[0] || !voice.sources[1])
+                continue;
+            // the rows of a batch must be contiguous, so unlike the single-voice renders, which read float32 frames in place,
+            // the frames of the voices are gathered here, one copy per frame that also converts float16 and int8 frames
+            for(int s=0; s<2; s++)
+            {
+                const LatentSequence &source = *voice.sources[s];
+                source.readFrame(voice.readPointer[s], latents[2*s].data() + count*latentDim, latents[2*s+1].data() + count*latentDim);
+                voice.readPointer[s] = (voice.readPointer[s] + 1) % source.getNumFrames();
+            }
+            interpolations[count] = voice.interpolation;
+            rows[count++] = v;
+        }
+
+        std::fill(mix, mix + segmentSize, 0.0f);
+        if(count == 0)
+            return 0;
+
+        decoder.setBatchSize(count);
+        decoder.run();
+        for(int r=0; r<count; r++)
+        {
+            const float *segment = output.data() + r*segmentSize;
+            float gain = voices[rows[r]].gain;
+            for(int i=0; i<segmentSize; i++)
+                mix[i] += gain*segment[i];
+        }
+        return count;
+    }
+
+    void cleanup() { decoder.cleanup(); }
+
+private:
+    // the model shape with the batch size first and any other dynamic dimension set to 1
+    static std::vector<int64_t> batchShape(std::vector<int64_t> shape, int batch)
+    {
+        if(shape.empty())
+            shape.push_back(1);
+        shape[0] = batch;
+        for(auto &dim : shape)
+            if(dim < 0)
+                dim = 1;
+        return shape;
+    }
+
+    OrtModelRT decoder;
+    int latentDim = 0;
+    int segmentSize = 0;
+    std::vector<LtsVoice> voices;
+    std::vector<int> rows; // voice of each batch row
+    std::vector<float> latents[4]; // [voices, latentDim] each: mu and logvar of the first source, then of the second
+    std::vector<float> interpolations; // [voices]
+    std::vector<float> output; // [voices, segmentSize]
+};
+
+#endif /* LTS_VOICE_ENGINE_H_ */
@@ -0,0 +1,45 @@
+#ifndef MODEL_WARMUP_H_
+#define MODEL_WARMUP_H_
+
+#include <chrono>
+#include <cstdio>
+
+struct WarmupReport
+{
+    int runs = 0;
+    double firstRun_ms = 0;
+    double steadyRun_ms = 0; // mean of the second half of the runs
+};
+
+// Runs a model a few times before the audio loop starts, so that the lazy allocations and kernel selections of the first runs
+// happen in setup() rather than in the first audio callbacks.
+// run(i) is called for i from 0 to runs-1, with the same buffers and shapes that the render will use;
+// whatever it writes should be cleared afterwards.
+template<typename RunFunction>
+WarmupReport warmUpModel(const char *name, int runs, RunFunction run)
+{
+    WarmupReport report;
+    report.runs = runs;
+    if(runs <= 0)
+        return report;
+
+    int steadyRuns = 0;
+    for(int i=0; i<runs; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        run(i);
+        double time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if(i == 0)
+            report.firstRun_ms = time_ms;
+        if(i >= runs/2)
+        {
+            report.steadyRun_ms += time_ms;
+            steadyRuns++;
+        }
+    }
+    report.steadyRun_ms /= steadyRuns;
+    printf("%s: warm-up of %d runs, first %.3f ms, steady state %.3f ms\n", name, runs, report.firstRun_ms, report.steadyRun_ms);
+    return report;
+}
+
+#endif /* MODEL_WARMUP_H_ */
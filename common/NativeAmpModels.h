@@ -0,0 +1,117 @@
+#ifndef NATIVE_AMP_MODELS_H_
+#define NATIVE_AMP_MODELS_H_
+
+#include <string>
+#include "NativeRnn.h"
+
+// The amp models of AutoGuitarAmp and GuitarLSTM on the layers of NativeRnn.h, with the same setup() and run() as OrtModel.
+// The topology is fixed here, the weights are read from the shipped .onnx files, whose shapes are checked against the templates.
+
+// LSTM of 20 units on the sample and the conditioning, then a dense layer to the output sample.
+// Unlike AutoGuitarAmp.onnx, which restarts from zero state at every call, the state is carried from one sample to the next,
+// as the model runs when trained and as in AutoGuitarAmp_multichannel.onnx.
+class NativeAutoGuitarAmp
+{
+public:
+    static const int hiddenSize = 20;
+
+    bool setup(std::string modelPath)
+    {
+        OnnxWeights weights;
+        if(!weights.load(modelPath))
+            return false;
+        auto lstms = weights.findNodes("LSTM");
+        auto gemms = weights.findNodes("Gemm");
+        if(lstms.size() != 1 || gemms.size() != 1 || gemms[0]->getInt("transB", 0) != 1)
+        {
+            printf("NativeAutoGuitarAmp: '%s' is not an AutoGuitarAmp model\n", modelPath.c_str());
+            return false;
+        }
+        if(!lstm.load(weights, *lstms[0]) || !dense.load(weights, gemms[0]->input(1), gemms[0]->input(2)))
+        {
+            printf("NativeAutoGuitarAmp: unable to load the weights of '%s'\n", modelPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // second input feature of the LSTM
+    void setConditioning(float value) { features[1] = value; }
+
+    // one sample
+    void run(float *input, float *output)
+    {
+        features[0] = input[0];
+        dense.forward(lstm.step(features), output);
+    }
+
+    void reset() { lstm.reset(); }
+    void cleanup() {}
+
+private:
+    LstmLayer<2, hiddenSize> lstm;
+    DenseLayer<hiddenSize, 1> dense;
+    float features[2] = {0};
+};
+
+// Two 'same' convolutions of 16 channels and kernel 12 over the window of 5 samples, an LSTM of 32 units stepping through it
+// from zero state, and a dense layer on its last hidden state; the same computation as GuitarLSTM.onnx for a batch of one window.
+class NativeGuitarLSTM
+{
+public:
+    static const int inputSize = 5;
+    static const int channels = 16;
+    static const int kernelSize = 12;
+    static const int hiddenSize = 32;
+
+    bool setup(std::string modelPath)
+    {
+        OnnxWeights weights;
+        if(!weights.load(modelPath))
+            return false;
+        auto convs = weights.findNodes("Conv");
+        auto lstms = weights.findNodes("LSTM");
+        auto matmuls = weights.findNodes("MatMul");
+        if(convs.size() != 2 || lstms.size() != 1 || matmuls.size() != 1)
+        {
+            printf("NativeGuitarLSTM: '%s' is not a GuitarLSTM model\n", modelPath.c_str());
+            return false;
+        }
+        // the biases are separate Add nodes in the Keras export
+        if(!conv1.load(weights, *convs[0], convBias(weights, *convs[0])) || !conv2.load(weights, *convs[1], convBias(weights, *convs[1])) ||
+           !lstm.load(weights, *lstms[0]) || !dense.load(weights, matmuls[0]->input(1), findBiasAdd(weights, matmuls[0]->outputs[0]), false))
+        {
+            printf("NativeGuitarLSTM: unable to load the weights of '%s'\n", modelPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // a window of inputSize samples, oldest first
+    void run(float *input, float *output)
+    {
+        conv1.forward(input, features1);
+        conv2.forward(features1, features2);
+        lstm.reset();
+        for(int t=0; t<inputSize; t++)
+            lstm.step(features2 + t*channels);
+        dense.forward(lstm.getHidden(), output);
+    }
+
+    void cleanup() {}
+
+private:
+    static std::string convBias(const OnnxWeights &weights, const OnnxNode &conv)
+    {
+        return conv.input(2) != "" ? conv.input(2) : findBiasAdd(weights, conv.outputs[0]);
+    }
+
+    Conv1dLayer<1, channels, kernelSize, inputSize, kernelSize/2 - 1> conv1;
+    Conv1dLayer<channels, channels, kernelSize, inputSize, kernelSize/2 - 1> conv2;
+    LstmLayer<channels, hiddenSize> lstm;
+    DenseLayer<hiddenSize, 1> dense;
+    float features1[inputSize*channels] = {0};
+    float features2[inputSize*channels] = {0};
+};
+
+#endif /* NATIVE_AMP_MODELS_H_ */
@@ -0,0 +1,458 @@
+#ifndef NATIVE_RNN_H_
+#define NATIVE_RNN_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "OnnxWeights.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define NATIVE_RNN_NEON
+#elif defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define NATIVE_RNN_SSE
+#endif
+
+// Layers for small recurrent models with their sizes fixed at compile time, so that a model is a few fixed-size arrays
+// and a handful of loops the compiler can unroll, without the per-call overhead of a runtime.
+// Weights are copied from the initializers of the exported .onnx files, in the layouts of the ONNX operators.
+// All the buffers are members, so the forward passes do not allocate.
+
+// Row-major matrix of Rows x Cols, packed by blocks of 4 rows: block b holds, for each column, the 4 values of rows 4b..4b+3,
+// so a matrix-vector product streams through the weights once, with 4 rows accumulated per SIMD register.
+// Rows are padded with zeros to a multiple of 4, and so must be the output vectors.
+template<int Rows, int Cols>
+class PackedMatrix
+{
+public:
+    static constexpr int blocks = (Rows + 3)/4;
+    static constexpr int paddedRows = blocks*4;
+
+    void set(int row, int col, float value) { data[((row/4)*Cols + col)*4 + row%4] = value; }
+
+    // y[0..paddedRows) += W x
+    // 4 blocks go together, so that 4 independent accumulators hide the latency of the multiply-adds
+    void multiplyAccumulate(const float *x, float *y) const
+    {
+        for(int b=0; b+4<=blocks; b+=4)
+        {
+            const float *w = data + b*Cols*4;
+#if defined(NATIVE_RNN_NEON)
+            float32x4_t acc0 = vld1q_f32(y + 4*b), acc1 = vld1q_f32(y + 4*b+4), acc2 = vld1q_f32(y + 4*b+8), acc3 = vld1q_f32(y + 4*b+12);
+            for(int j=0; j<Cols; j++, w+=4)
+            {
+                acc0 = vmlaq_n_f32(acc0, vld1q_f32(w), x[j]);
+                acc1 = vmlaq_n_f32(acc1, vld1q_f32(w + Cols*4), x[j]);
+                acc2 = vmlaq_n_f32(acc2, vld1q_f32(w + Cols*8), x[j]);
+                acc3 = vmlaq_n_f32(acc3, vld1q_f32(w + Cols*12), x[j]);
+            }
+            vst1q_f32(y + 4*b, acc0);
+            vst1q_f32(y + 4*b+4, acc1);
+            vst1q_f32(y + 4*b+8, acc2);
+            vst1q_f32(y + 4*b+12, acc3);
+#elif defined(NATIVE_RNN_SSE)
+            __m128 acc0 = _mm_loadu_ps(y + 4*b), acc1 = _mm_loadu_ps(y + 4*b+4), acc2 = _mm_loadu_ps(y + 4*b+8), acc3 = _mm_loadu_ps(y + 4*b+12);
+            for(int j=0; j<Cols; j++, w+=4)
+            {
+                __m128 xj = _mm_set1_ps(x[j]);
+                acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_load_ps(w), xj));
+                acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_load_ps(w + Cols*4), xj));
+                acc2 = _mm_add_ps(acc2, _mm_mul_ps(_mm_load_ps(w + Cols*8), xj));
+                acc3 = _mm_add_ps(acc3, _mm_mul_ps(_mm_load_ps(w + Cols*12), xj));
+            }
+            _mm_storeu_ps(y + 4*b, acc0);
+            _mm_storeu_ps(y + 4*b+4, acc1);
+            _mm_storeu_ps(y + 4*b+8, acc2);
+            _mm_storeu_ps(y + 4*b+12, acc3);
+#else
+            accumulateBlocks<4>(w, x, y + 4*b);
+#endif
+        }
+        for(int b=blocks/4*4; b<blocks; b++)
+            accumulateBlocks<1>(data + b*Cols*4, x, y + 4*b);
+    }
+
+private:
+    template<int Count>
+    static void accumulateBlocks(const float *w, const float *x, float *y)
+    {
+        float acc[Count*4];
+        std::copy(y, y + Count*4, acc);
+        for(int j=0; j<Cols; j++, w+=4)
+        {
+            for(int c=0; c<Count; c++)
+            {
+                for(int k=0; k<4; k++)
+                    acc[c*4 + k] += w[c*Cols*4 + k]*x[j];
+            }
+        }
+        std::copy(acc, acc + Count*4, y);
+    }
+
+    alignas(16) float data[paddedRows*Cols] = {0};
+};
+
+// Rational approximation of tanh, accurate to a few float ulps over the whole range, and branchless so that the loops
+// over the gates vectorize; the same approximation as the vectorized tanh of Eigen
+inline float nativeTanh(float x)
+{
+    x = std::min(std::max(x, -7.90531110763549805f), 7.90531110763549805f);
+    float x2 = x*x;
+    float p = -2.76076847742355e-16f;
+    p = p*x2 + 2.00018790482477e-13f;
+    p = p*x2 + -8.60467152213735e-11f;
+    p = p*x2 + 5.12229709037114e-08f;
+    p = p*x2 + 1.48572235717979e-05f;
+    p = p*x2 + 6.37261928875436e-04f;
+    p = p*x2 + 4.89352455891786e-03f;
+    p = p*x;
+    float q = 1.19825839466702e-06f;
+    q = q*x2 + 1.18534705686654e-04f;
+    q = q*x2 + 2.26843463243900e-03f;
+    q = q*x2 + 4.89352518554385e-03f;
+    return p/q;
+}
+
+inline float nativeSigmoid(float x) { return 0.5f*nativeTanh(0.5f*x) + 0.5f; }
+
+// tanh of count values in place, 4 at a time; the compiler does not vectorize the clamp of the scalar version without -ffast-math
+inline void nativeTanh(float *values, int count)
+{
+    int i = 0;
+#if defined(NATIVE_RNN_NEON) || defined(NATIVE_RNN_SSE)
+    static const float alpha[7] = {-2.76076847742355e-16f, 2.00018790482477e-13f, -8.60467152213735e-11f, 5.12229709037114e-08f,
+                                   1.48572235717979e-05f, 6.37261928875436e-04f, 4.89352455891786e-03f};
+    static const float beta[4] = {1.19825839466702e-06f, 1.18534705686654e-04f, 2.26843463243900e-03f, 4.89352518554385e-03f};
+    for(; i+4<=count; i+=4)
+    {
+#if defined(NATIVE_RNN_NEON)
+        float32x4_t x = vminq_f32(vmaxq_f32(vld1q_f32(values + i), vdupq_n_f32(-7.90531110763549805f)), vdupq_n_f32(7.90531110763549805f));
+        float32x4_t x2 = vmulq_f32(x, x);
+        float32x4_t p = vdupq_n_f32(alpha[0]);
+        for(int k=1; k<7; k++)
+            p = vmlaq_f32(vdupq_n_f32(alpha[k]), p, x2);
+        p = vmulq_f32(p, x);
+        float32x4_t q = vdupq_n_f32(beta[0]);
+        for(int k=1; k<4; k++)
+            q = vmlaq_f32(vdupq_n_f32(beta[k]), q, x2);
+#if defined(__aarch64__)
+        vst1q_f32(values + i, vdivq_f32(p, q));
+#else
+        float32x4_t r = vrecpeq_f32(q); // no vector division on 32-bit ARM, reciprocal estimate and two Newton steps
+        r = vmulq_f32(vrecpsq_f32(q, r), r);
+        r = vmulq_f32(vrecpsq_f32(q, r), r);
+        vst1q_f32(values + i, vmulq_f32(p, r));
+#endif
+#else
+        __m128 x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(values + i), _mm_set1_ps(-7.90531110763549805f)), _mm_set1_ps(7.90531110763549805f));
+        __m128 x2 = _mm_mul_ps(x, x);
+        __m128 p = _mm_set1_ps(alpha[0]);
+        for(int k=1; k<7; k++)
+            p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(alpha[k]));
+        p = _mm_mul_ps(p, x);
+        __m128 q = _mm_set1_ps(beta[0]);
+        for(int k=1; k<4; k++)
+            q = _mm_add_ps(_mm_mul_ps(q, x2), _mm_set1_ps(beta[k]));
+        _mm_storeu_ps(values + i, _mm_div_ps(p, q));
+#endif
+    }
+#endif
+    for(; i<count; i++)
+        values[i] = nativeTanh(values[i]);
+}
+
+inline void nativeSigmoid(float *values, int count)
+{
+    for(int i=0; i<count; i++)
+        values[i] *= 0.5f;
+    nativeTanh(values, count);
+    for(int i=0; i<count; i++)
+        values[i] = 0.5f*values[i] + 0.5f;
+}
+
+inline bool checkInitializerShape(const OnnxWeights &weights, const std::string &name, std::vector<int64_t> shape)
+{
+    const OnnxTensor *tensor = weights.getInitializer(name);
+    if(!tensor || tensor->dims != shape)
+    {
+        printf("NativeRnn: initializer '%s' is missing or does not have the expected shape\n", name.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Fully connected layer, out = W in + b
+template<int In, int Out>
+class DenseLayer
+{
+public:
+    // weights of a Gemm with transB set ([Out, In]), or of a MatMul ([In, Out], outFirst false)
+    bool load(const OnnxWeights &weights, const std::string &weightName, const std::string &biasName, bool outFirst = true)
+    {
+        std::vector<float> w(In*Out);
+        if(!weights.getValues(weightName, In*Out, w.data()) || !weights.getValues(biasName, Out, bias))
+            return false;
+        for(int o=0; o<Out; o++)
+        {
+            for(int i=0; i<In; i++)
+                matrix.set(o, i, outFirst ? w[o*In + i] : w[i*Out + o]);
+        }
+        return true;
+    }
+
+    void forward(const float *in, float *out)
+    {
+        std::copy(bias, bias + Out, result);
+        matrix.multiplyAccumulate(in, result);
+        std::copy(result, result + Out, out);
+    }
+
+private:
+    PackedMatrix<Out, In> matrix;
+    float bias[Out] = {0};
+    alignas(16) float result[PackedMatrix<Out, In>::paddedRows] = {0};
+};
+
+// 1D convolution over a whole window of Length steps, with PadLeft zeros before it and as many after as keep the length,
+// i.e., the 'same' padding of Keras. Input and output are time-major, [Length, InCh] and [Length, OutCh].
+// The input is copied into a zero-padded window, then each step is a single product with the [OutCh, Kernel*InCh] matrix.
+template<int InCh, int OutCh, int Kernel, int Length, int PadLeft>
+class Conv1dLayer
+{
+public:
+    // weights of a Conv with a [OutCh, InCh, Kernel] or [OutCh, InCh, 1, Kernel] kernel; bias of OutCh values
+    bool load(const OnnxWeights &weights, const OnnxNode &conv, const std::string &biasName)
+    {
+        const OnnxTensor *kernel = weights.getInitializer(conv.input(1));
+        if(!kernel || kernel->size() != (size_t)OutCh*InCh*Kernel || kernel->dims[0] != OutCh || kernel->dims[1] != InCh ||
+           kernel->dims.back() != Kernel)
+        {
+            printf("NativeRnn: conv '%s' does not have the expected kernel\n", conv.name.c_str());
+            return false;
+        }
+        auto pads = conv.intAttributes.find("pads");
+        int padLeft = pads != conv.intAttributes.end() ? pads->second[pads->second.size()/2 - 1] : 0;
+        if(padLeft != PadLeft || conv.getInt("group", 1) != 1 || conv.stringAttributes.count("auto_pad"))
+        {
+            printf("NativeRnn: conv '%s' does not have the expected padding\n", conv.name.c_str());
+            return false;
+        }
+        if(!weights.getValues(biasName, OutCh, bias))
+            return false;
+        for(int o=0; o<OutCh; o++)
+        {
+            for(int i=0; i<InCh; i++)
+            {
+                for(int k=0; k<Kernel; k++)
+                    matrix.set(o, k*InCh + i, kernel->values[(o*InCh + i)*Kernel + k]);
+            }
+        }
+        return true;
+    }
+
+    void forward(const float *in, float *out)
+    {
+        std::copy(in, in + Length*InCh, padded + PadLeft*InCh);
+        for(int t=0; t<Length; t++)
+        {
+            std::copy(bias, bias + OutCh, result);
+            matrix.multiplyAccumulate(padded + t*InCh, result);
+            std::copy(result, result + OutCh, out + t*OutCh);
+        }
+    }
+
+private:
+    PackedMatrix<OutCh, Kernel*InCh> matrix;
+    float bias[OutCh] = {0};
+    float padded[(Length + Kernel - 1)*InCh] = {0}; // the padding is never written
+    alignas(16) float result[PackedMatrix<OutCh, Kernel*InCh>::paddedRows] = {0};
+};
+
+// LSTM cell of the ONNX LSTM operator, forward direction, default activations (sigmoid, tanh, tanh), no peepholes
+// gates are in the ONNX order: input, output, forget, cell
+template<int In, int Hidden>
+class LstmLayer
+{
+public:
+    bool load(const OnnxWeights &weights, const OnnxNode &lstm)
+    {
+        auto direction = lstm.stringAttributes.find("direction");
+        auto activations = lstm.stringAttributes.find("activations");
+        if(lstm.getInt("hidden_size", 0) != Hidden || lstm.getInt("input_forget", 0) != 0 || lstm.intAttributes.count("clip") ||
+           lstm.input(7) != "" || (direction != lstm.stringAttributes.end() && direction->second[0] != "forward") ||
+           (activations != lstm.stringAttributes.end() && activations->second != std::vector<std::string>{"Sigmoid", "Tanh", "Tanh"}))
+        {
+            printf("NativeRnn: LSTM '%s' is not a forward LSTM of %d units without peepholes\n", lstm.name.c_str(), Hidden);
+            return false;
+        }
+        std::vector<float> w(4*Hidden*In), r(4*Hidden*Hidden), b(8*Hidden, 0.0f);
+        if(!checkInitializerShape(weights, lstm.input(1), {1, 4*Hidden, In}) || !checkInitializerShape(weights, lstm.input(2), {1, 4*Hidden, Hidden}) ||
+           !weights.getValues(lstm.input(1), w.size(), w.data()) || !weights.getValues(lstm.input(2), r.size(), r.data()))
+            return false;
+        if(lstm.input(3) != "" && !weights.getValues(lstm.input(3), b.size(), b.data()))
+            return false;
+        for(int g=0; g<4*Hidden; g++)
+        {
+            for(int i=0; i<In; i++)
+                inputWeights.set(g, i, w[g*In + i]);
+            for(int h=0; h<Hidden; h++)
+                recurrentWeights.set(g, h, r[g*Hidden + h]);
+            bias[g] = b[g] + b[4*Hidden + g]; // input and recurrent biases are always summed
+        }
+        reset();
+        return true;
+    }
+
+    void reset()
+    {
+        std::fill(hidden, hidden + Hidden, 0.0f);
+        std::fill(cell, cell + Hidden, 0.0f);
+    }
+
+    // one time step, the new hidden state is returned
+    const float* step(const float *x)
+    {
+        std::copy(bias, bias + 4*Hidden, gates);
+        inputWeights.multiplyAccumulate(x, gates);
+        recurrentWeights.multiplyAccumulate(hidden, gates);
+        // activations over the contiguous gates, the three sigmoid ones first
+        nativeSigmoid(gates, 3*Hidden);
+        nativeTanh(gates + 3*Hidden, Hidden);
+        const float *i = gates, *o = gates + Hidden, *f = gates + 2*Hidden, *c = gates + 3*Hidden;
+        for(int h=0; h<Hidden; h++)
+        {
+            cell[h] = f[h]*cell[h] + i[h]*c[h];
+            cellActivation[h] = cell[h];
+        }
+        nativeTanh(cellActivation, Hidden);
+        for(int h=0; h<Hidden; h++)
+            hidden[h] = o[h]*cellActivation[h];
+        return hidden;
+    }
+
+    const float* getHidden() const { return hidden; }
+
+private:
+    PackedMatrix<4*Hidden, In> inputWeights;
+    PackedMatrix<4*Hidden, Hidden> recurrentWeights;
+    float bias[4*Hidden] = {0};
+    alignas(16) float gates[4*Hidden] = {0};
+    float hidden[Hidden] = {0};
+    float cell[Hidden] = {0};
+    float cellActivation[Hidden] = {0};
+};
+
+// GRU cell of the ONNX GRU operator, forward direction, default activations (sigmoid, tanh)
+// gates are in the ONNX order: update, reset, hidden; both values of linear_before_reset are supported,
+// PyTorch exports set it, Keras exports with reset_after do as well
+template<int In, int Hidden>
+class GruLayer
+{
+public:
+    bool load(const OnnxWeights &weights, const OnnxNode &gru)
+    {
+        auto direction = gru.stringAttributes.find("direction");
+        auto activations = gru.stringAttributes.find("activations");
+        if(gru.getInt("hidden_size", 0) != Hidden || gru.intAttributes.count("clip") ||
+           (direction != gru.stringAttributes.end() && direction->second[0] != "forward") ||
+           (activations != gru.stringAttributes.end() && activations->second != std::vector<std::string>{"Sigmoid", "Tanh"}))
+        {
+            printf("NativeRnn: GRU '%s' is not a forward GRU of %d units\n", gru.name.c_str(), Hidden);
+            return false;
+        }
+        linearBeforeReset = gru.getInt("linear_before_reset", 0) != 0;
+        std::vector<float> w(3*Hidden*In), r(3*Hidden*Hidden), b(6*Hidden, 0.0f);
+        if(!checkInitializerShape(weights, gru.input(1), {1, 3*Hidden, In}) || !checkInitializerShape(weights, gru.input(2), {1, 3*Hidden, Hidden}) ||
+           !weights.getValues(gru.input(1), w.size(), w.data()) || !weights.getValues(gru.input(2), r.size(), r.data()))
+            return false;
+        if(gru.input(3) != "" && !weights.getValues(gru.input(3), b.size(), b.data()))
+            return false;
+        for(int g=0; g<3*Hidden; g++)
+        {
+            for(int i=0; i<In; i++)
+                inputWeights.set(g, i, w[g*In + i]);
+            for(int h=0; h<Hidden; h++)
+            {
+                if(g < 2*Hidden)
+                    gateWeights.set(g, h, r[g*Hidden + h]);
+                else
+                    candidateWeights.set(g - 2*Hidden, h, r[g*Hidden + h]);
+            }
+            inputBias[g] = b[g];
+            recurrentBias[g] = b[3*Hidden + g];
+        }
+        reset();
+        return true;
+    }
+
+    void reset() { std::fill(hidden, hidden + Hidden, 0.0f); }
+
+    // one time step, the new hidden state is returned
+    const float* step(const float *x)
+    {
+        std::copy(inputBias, inputBias + 3*Hidden, inputGates);
+        inputWeights.multiplyAccumulate(x, inputGates);
+        std::copy(recurrentBias, recurrentBias + 2*Hidden, recurrentGates);
+        gateWeights.multiplyAccumulate(hidden, recurrentGates);
+        const float *z = recurrentGates, *r = recurrentGates + Hidden;
+        for(int h=0; h<2*Hidden; h++)
+            recurrentGates[h] += inputGates[h];
+        nativeSigmoid(recurrentGates, 2*Hidden);
+
+        // candidate, with the reset gate applied after the recurrent product, or to the state before it
+        std::copy(recurrentBias + 2*Hidden, recurrentBias + 3*Hidden, candidate);
+        if(linearBeforeReset)
+            candidateWeights.multiplyAccumulate(hidden, candidate);
+        else
+        {
+            for(int h=0; h<Hidden; h++)
+                resetHidden[h] = r[h]*hidden[h];
+            candidateWeights.multiplyAccumulate(resetHidden, candidate);
+        }
+        for(int h=0; h<Hidden; h++)
+            candidate[h] = inputGates[2*Hidden + h] + (linearBeforeReset ? r[h]*candidate[h] : candidate[h]);
+        nativeTanh(candidate, Hidden);
+        for(int h=0; h<Hidden; h++)
+            hidden[h] = (1 - z[h])*candidate[h] + z[h]*hidden[h];
+        return hidden;
+    }
+
+    const float* getHidden() const { return hidden; }
+
+private:
+    PackedMatrix<3*Hidden, In> inputWeights;
+    PackedMatrix<2*Hidden, Hidden> gateWeights; // update and reset
+    PackedMatrix<Hidden, Hidden> candidateWeights;
+    float inputBias[3*Hidden] = {0};
+    float recurrentBias[3*Hidden] = {0};
+    bool linearBeforeReset = false;
+    alignas(16) float inputGates[PackedMatrix<3*Hidden, In>::paddedRows] = {0};
+    alignas(16) float recurrentGates[PackedMatrix<2*Hidden, Hidden>::paddedRows] = {0};
+    alignas(16) float candidate[PackedMatrix<Hidden, Hidden>::paddedRows] = {0};
+    float resetHidden[Hidden] = {0};
+    float hidden[Hidden] = {0};
+};
+
+// follows a tensor through reshaping nodes to the Add of a bias initializer, as in graphs where the bias of a Conv or MatMul
+// is a separate node; returns the name of the bias, empty if none
+inline std::string findBiasAdd(const OnnxWeights &weights, std::string tensor)
+{
+    const OnnxNode *node;
+    while((node = weights.findConsumer(tensor)))
+    {
+        if(node->opType == "Add")
+        {
+            const std::string &other = node->input(0) == tensor ? node->input(1) : node->input(0);
+            return weights.getInitializer(other) ? other : "";
+        }
+        if(node->opType != "Squeeze" && node->opType != "Unsqueeze" && node->opType != "Reshape" && node->opType != "Identity")
+            return "";
+        tensor = node->outputs[0];
+    }
+    return "";
+}
+
+#endif /* NATIVE_RNN_H_ */
@@ -0,0 +1,367 @@
+#ifndef ONNX_WEIGHTS_H_
+#define ONNX_WEIGHTS_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+struct OnnxTensor
+{
+    std::string name;
+    std::vector<int64_t> dims;
+    int dataType = 0; // 1 is float
+    std::vector<float> values; // float tensors only
+
+    size_t size() const
+    {
+        size_t count = 1;
+        for(auto d : dims)
+            count *= d;
+        return count;
+    }
+};
+
+struct OnnxNode
+{
+    std::string name;
+    std::string opType;
+    std::vector<std::string> inputs;
+    std::vector<std::string> outputs;
+    std::map<std::string, std::vector<int64_t>> intAttributes; // int and ints
+    std::map<std::string, std::vector<std::string>> stringAttributes; // string and strings
+
+    const std::string& input(size_t i) const { static const std::string none; return i < inputs.size() ? inputs[i] : none; }
+    int64_t getInt(const std::string &attribute, int64_t defaultValue) const
+    {
+        auto it = intAttributes.find(attribute);
+        return it != intAttributes.end() && !it->second.empty() ? it->second[0] : defaultValue;
+    }
+};
+
+// Reads the nodes and the initializers of an .onnx file, for the native models that take their weights from the exported graphs.
+// This is a minimal reader of the protobuf wire format, covering the fields of ModelProto, GraphProto, NodeProto, AttributeProto
+// and TensorProto that hold the topology and the weights, so no protobuf library is needed on the phone.
+// Tensors stored in external data files are not supported. Float data is assumed little-endian, as on the supported targets.
+class OnnxWeights
+{
+public:
+    OnnxWeights() {}
+
+    bool load(std::string path)
+    {
+        nodes.clear();
+        initializers.clear();
+        FILE *file = fopen(path.c_str(), "rb");
+        if(!file)
+        {
+            printf("OnnxWeights: unable to open '%s'\n", path.c_str());
+            return false;
+        }
+        std::vector<uint8_t> bytes;
+        uint8_t chunk[4096];
+        size_t count;
+        while((count = fread(chunk, 1, sizeof(chunk), file)) > 0)
+            bytes.insert(bytes.end(), chunk, chunk + count);
+        fclose(file);
+
+        if(!parseModel(bytes.data(), bytes.data() + bytes.size()) || nodes.empty())
+        {
+            printf("OnnxWeights: '%s' is not a valid ONNX model\n", path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    const std::vector<OnnxNode>& getNodes() const { return nodes; }
+
+    // nodes of a type, in graph order
+    std::vector<const OnnxNode*> findNodes(const std::string &opType) const
+    {
+        std::vector<const OnnxNode*> found;
+        for(auto &node : nodes)
+        {
+            if(node.opType == opType)
+                found.push_back(&node);
+        }
+        return found;
+    }
+
+    // first node that takes a tensor as input, nullptr if none
+    const OnnxNode* findConsumer(const std::string &tensor) const
+    {
+        for(auto &node : nodes)
+        {
+            for(auto &input : node.inputs)
+            {
+                if(input == tensor)
+                    return &node;
+            }
+        }
+        return nullptr;
+    }
+
+    const OnnxTensor* getInitializer(const std::string &name) const
+    {
+        auto it = initializers.find(name);
+        return it != initializers.end() ? &it->second : nullptr;
+    }
+
+    // copies a float initializer into dest, checking its number of elements
+    bool getValues(const std::string &name, size_t expectedSize, float *dest) const
+    {
+        const OnnxTensor *tensor = getInitializer(name);
+        if(!tensor || tensor->dataType != 1 || tensor->values.size() != expectedSize)
+        {
+            printf("OnnxWeights: expected a float initializer '%s' of %zu values\n", name.c_str(), expectedSize);
+            return false;
+        }
+        std::copy(tensor->values.begin(), tensor->values.end(), dest);
+        return true;
+    }
+
+private:
+    // protobuf wire format
+    struct Field
+    {
+        uint32_t number = 0;
+        int wireType = 0;
+        uint64_t value = 0; // varint and fixed
+        const uint8_t *data = nullptr; // length-delimited
+        size_t length = 0;
+    };
+
+    static bool readVarint(const uint8_t *&p, const uint8_t *end, uint64_t &value)
+    {
+        value = 0;
+        for(int shift=0; shift<64 && p<end; shift+=7)
+        {
+            uint8_t byte = *p++;
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if(!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    static bool readField(const uint8_t *&p, const uint8_t *end, Field &field)
+    {
+        uint64_t key;
+        if(!readVarint(p, end, key))
+            return false;
+        field.number = key >> 3;
+        field.wireType = key & 7;
+        switch(field.wireType)
+        {
+            case 0:
+                return readVarint(p, end, field.value);
+            case 1:
+                if(end - p < 8)
+                    return false;
+                memcpy(&field.value, p, 8);
+                p += 8;
+                return true;
+            case 2:
+            {
+                uint64_t length;
+                if(!readVarint(p, end, length) || length > (uint64_t)(end - p))
+                    return false;
+                field.data = p;
+                field.length = length;
+                p += length;
+                return true;
+            }
+            case 5:
+            {
+                if(end - p < 4)
+                    return false;
+                uint32_t value;
+                memcpy(&value, p, 4);
+                field.value = value;
+                p += 4;
+                return true;
+            }
+            default:
+                return false; // groups are not used by ONNX
+        }
+    }
+
+    static std::string toString(const Field &field) { return std::string((const char*)field.data, field.length); }
+
+    // repeated int64, packed or not
+    static bool readInts(const Field &field, std::vector<int64_t> &values)
+    {
+        if(field.wireType == 0)
+        {
+            values.push_back((int64_t)field.value);
+            return true;
+        }
+        const uint8_t *p = field.data, *end = field.data + field.length;
+        while(p < end)
+        {
+            uint64_t value;
+            if(!readVarint(p, end, value))
+                return false;
+            values.push_back((int64_t)value);
+        }
+        return true;
+    }
+
+    // repeated float, packed or not
+    static void readFloats(const Field &field, std::vector<float> &values)
+    {
+        if(field.wireType == 5)
+        {
+            uint32_t bits = (uint32_t)field.value;
+            float value;
+            memcpy(&value, &bits, 4);
+            values.push_back(value);
+            return;
+        }
+        size_t start = values.size();
+        values.resize(start + field.length/4);
+        memcpy(values.data() + start, field.data, field.length/4*4);
+    }
+
+    bool parseModel(const uint8_t *p, const uint8_t *end)
+    {
+        Field field;
+        while(p < end)
+        {
+            if(!readField(p, end, field))
+                return false;
+            if(field.number == 7 && field.wireType == 2 && !parseGraph(field.data, field.data + field.length)) // graph
+                return false;
+        }
+        return true;
+    }
+
+    bool parseGraph(const uint8_t *p, const uint8_t *end)
+    {
+        Field field;
+        while(p < end)
+        {
+            if(!readField(p, end, field))
+                return false;
+            if(field.wireType != 2)
+                continue;
+            if(field.number == 1) // node
+            {
+                nodes.emplace_back();
+                if(!parseNode(field.data, field.data + field.length, nodes.back()))
+                    return false;
+            }
+            else if(field.number == 5) // initializer
+            {
+                OnnxTensor tensor;
+                if(!parseTensor(field.data, field.data + field.length, tensor))
+                    return false;
+                initializers[tensor.name] = std::move(tensor);
+            }
+        }
+        return true;
+    }
+
+    bool parseNode(const uint8_t *p, const uint8_t *end, OnnxNode &node)
+    {
+        Field field;
+        while(p < end)
+        {
+            if(!readField(p, end, field))
+                return false;
+            if(field.wireType != 2)
+                continue;
+            switch(field.number)
+            {
+                case 1: node.inputs.push_back(toString(field)); break;
+                case 2: node.outputs.push_back(toString(field)); break;
+                case 3: node.name = toString(field); break;
+                case 4: node.opType = toString(field); break;
+                case 5:
+                    if(!parseAttribute(field.data, field.data + field.length, node))
+                        return false;
+                    break;
+            }
+        }
+        return true;
+    }
+
+    // int, ints, string and strings attributes, the others (floats, tensors, graphs) are not needed by the native models
+    bool parseAttribute(const uint8_t *p, const uint8_t *end, OnnxNode &node)
+    {
+        std::string name;
+        std::vector<int64_t> ints;
+        std::vector<std::string> strings;
+        Field field;
+        while(p < end)
+        {
+            if(!readField(p, end, field))
+                return false;
+            if(field.number == 1 && field.wireType == 2)
+                name = toString(field);
+            else if(field.number == 3 && field.wireType == 0)
+                ints.push_back((int64_t)field.value);
+            else if(field.number == 8 && !readInts(field, ints))
+                return false;
+            else if((field.number == 4 || field.number == 9) && field.wireType == 2)
+                strings.push_back(toString(field));
+        }
+        if(!ints.empty())
+            node.intAttributes[name] = ints;
+        if(!strings.empty())
+            node.stringAttributes[name] = strings;
+        return true;
+    }
+
+    bool parseTensor(const uint8_t *p, const uint8_t *end, OnnxTensor &tensor)
+    {
+        std::vector<float> floatData;
+        const uint8_t *raw = nullptr;
+        size_t rawLength = 0;
+        bool external = false;
+        Field field;
+        while(p < end)
+        {
+            if(!readField(p, end, field))
+                return false;
+            switch(field.number)
+            {
+                case 1:
+                    if(!readInts(field, tensor.dims))
+                        return false;
+                    break;
+                case 2: tensor.dataType = (int)field.value; break;
+                case 4: readFloats(field, floatData); break;
+                case 8: tensor.name = toString(field); break;
+                case 9:
+                    raw = field.data;
+                    rawLength = field.length;
+                    break;
+                case 14: external = field.value == 1; break;
+            }
+        }
+        if(tensor.dataType != 1)
+            return true;
+        if(external)
+        {
+            printf("OnnxWeights: initializer '%s' is stored in an external file, not supported\n", tensor.name.c_str());
+            return false;
+        }
+        if(raw)
+        {
+            tensor.values.resize(rawLength/4);
+            memcpy(tensor.values.data(), raw, rawLength/4*4);
+        }
+        else
+            tensor.values = std::move(floatData);
+        return tensor.values.size() == tensor.size();
+    }
+
+    std::vector<OnnxNode> nodes;
+    std::map<std::string, OnnxTensor> initializers;
+};
+
+#endif /* ONNX_WEIGHTS_H_ */
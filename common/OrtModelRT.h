@@ -0,0 +1,569 @@
+#ifndef ORT_MODEL_RT_H_
+#define ORT_MODEL_RT_H_
+
+#include <onnxruntime_cxx_api.h>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "ModelWarmup.h"
+
+// OrtModelRT session options, the defaults suit small models run from the audio thread
+struct OrtModelRTOptions
+{
+    int intraOpThreads = 1; // threads used within an operator, including the calling one; 0 lets ONNX Runtime choose
+    int interOpThreads = 1; // threads used across independent operators, only with parallelExecution; 0 lets ONNX Runtime choose
+    bool parallelExecution = false;
+    GraphOptimizationLevel optimizationLevel = ORT_ENABLE_ALL;
+    bool allowSpinning = false; // if true, idle pool threads busy-wait for work, lower latency but cores stay busy
+    bool memoryArena = true;
+    // CPU affinity of the intraOpThreads-1 pool threads, the calling thread is not affected
+    // one group per thread separated by ';', each a list of 1-based logical processors, e.g., "5;6;7" or "5-6;7-8"
+    std::string intraOpAffinities;
+    // if true, the optimized graph is saved at the first setup and loaded directly at the next ones,
+    // as long as the model file, the ONNX Runtime version and the options above do not change
+    // the optimized graph may be specific to the CPU it was generated on, so caches should not be copied across devices
+    bool optimizedModelCache = true;
+    std::string cacheDir; // empty for the folder of the model
+    // runs done by prepare() with the bound buffers, so that the first run() in the audio thread is as fast as the following ones
+    // every batch size and state parity is run at least once; the outputs and states are cleared afterwards
+    int warmupRuns = 10;
+
+    // for the large models that run once per segment rather than once per sample, e.g., the LTS VAEs:
+    // a run is split across 4 threads, which still do not spin, as they are idle for most of the segment
+    // on big.LITTLE devices, set intraOpAffinities to keep the 3 pool threads on the big cores, e.g., "6;7;8" when they are the last four of eight
+    static OrtModelRTOptions largeModel()
+    {
+        OrtModelRTOptions options;
+        options.intraOpThreads = 4;
+        return options;
+    }
+};
+
+// ONNX Runtime model wrapper for the audio thread, alternative to libraries/OrtModel when the render needs more control.
+// Inputs and outputs are bound once, by index, to buffers owned by the render.
+// prepare() wraps the buffers in tensors and attaches them to an IoBinding, so run() does no allocations and no name lookups.
+// Recurrent models can declare state pairs: the state output of a run is fed back to the matching state input at the next run,
+// swapping between two internal buffers, so no copy is needed.
+// An input can also be given a table of read-only frames, e.g., memory-mapped latent frames, and switched between them from run to run,
+// with a tensor built over each frame in advance, so the frames are not copied into the bound buffer.
+class OrtModelRT
+{
+public:
+    using Options = OrtModelRTOptions;
+
+    OrtModelRT() {}
+    ~OrtModelRT() { cleanup(); }
+
+    bool setup(std::string sessionName, std::string modelPath, const Options &options = Options())
+    {
+        cleanup();
+        auto start = std::chrono::steady_clock::now();
+        const char *cacheStatus = "";
+        try
+        {
+            env = Ort::Env(ORT_LOGGING_LEVEL_WARNING, sessionName.c_str());
+            runOptions = Ort::RunOptions();
+            memoryInfo = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+            cacheStatus = createSession(modelPath, options);
+        }
+        catch(const Ort::Exception &e)
+        {
+            printf("OrtModelRT: unable to load '%s': %s\n", modelPath.c_str(), e.what());
+            return false;
+        }
+        setupTime_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        printf("OrtModelRT: '%s' loaded in %.1f ms%s\n", modelPath.c_str(), setupTime_ms, cacheStatus);
+        this->modelPath = modelPath;
+        warmupRuns = options.warmupRuns;
+        warmup = WarmupReport();
+
+        Ort::AllocatorWithDefaultOptions allocator;
+        inputs.resize(session.GetInputCount());
+        for(size_t i=0; i<inputs.size(); i++)
+        {
+            inputs[i].name = session.GetInputNameAllocated(i, allocator).get();
+            inputs[i].modelShape = session.GetInputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape();
+        }
+        outputs.resize(session.GetOutputCount());
+        for(size_t i=0; i<outputs.size(); i++)
+        {
+            outputs[i].name = session.GetOutputNameAllocated(i, allocator).get();
+            outputs[i].modelShape = session.GetOutputTypeInfo(i).GetTensorTypeAndShapeInfo().GetShape();
+        }
+        states.clear();
+        parity = 0;
+        ready = false;
+        return true;
+    }
+
+    // duration of the last setup(), to track cold-start time
+    double getSetupTime_ms() const { return setupTime_ms; }
+    // first and steady-state run times of the last warm-up
+    const WarmupReport& getWarmupReport() const { return warmup; }
+
+    int getNumInputs() const { return inputs.size(); }
+    int getNumOutputs() const { return outputs.size(); }
+
+    // as declared in the model, dynamic dimensions are -1
+    std::vector<int64_t> getInputShape(int index) const { return inputs[index].modelShape; }
+    std::vector<int64_t> getOutputShape(int index) const { return outputs[index].modelShape; }
+
+    // an empty shape takes the one declared in the model, with dynamic dimensions set to 1
+    bool bindInput(int index, float *data, std::vector<int64_t> shape = {})
+    {
+        if(index < 0 || index >= (int)inputs.size())
+            return error("input index", index);
+        return bind(inputs[index], data, shape);
+    }
+
+    bool bindOutput(int index, float *data, std::vector<int64_t> shape = {})
+    {
+        if(index < 0 || index >= (int)outputs.size())
+            return error("output index", index);
+        return bind(outputs[index], data, shape);
+    }
+
+    // frames the input can read instead of its bound buffer, which must be bound first and have the same shape as every frame
+    // a tensor is built over each of them now; nullptr entries stand for the bound buffer, e.g., for frames that must be converted into it
+    // the frames are only read and must stay valid until cleanup(); not for state inputs or batched models
+    bool bindInputFrames(int index, const std::vector<const float*> &frames)
+    {
+        if(index < 0 || index >= (int)inputs.size() || inputs[index].isState || !inputs[index].data)
+            return error("frame input index", index);
+        Port &port = inputs[index];
+        port.frames = frames;
+        port.frameTensors.clear();
+        try
+        {
+            for(const float *frame : frames)
+            {
+                if(!frame)
+                    port.frameTensors.emplace_back(nullptr);
+                else // the model only reads its inputs
+                    port.frameTensors.push_back(Ort::Value::CreateTensor<float>(memoryInfo, const_cast<float*>(frame), elementCount(port.shape),
+                                                                                port.shape.data(), port.shape.size()));
+            }
+        }
+        catch(const Ort::Exception &e)
+        {
+            printf("OrtModelRT: unable to build the frame tensors of input %d: %s\n", index, e.what());
+            port.frames.clear();
+            port.frameTensors.clear();
+            return false;
+        }
+        return true;
+    }
+
+    // the input reads the given frame at the next runs, or its bound buffer for -1 and nullptr frames
+    // the frame tensor is bound in place of the previous one, nothing is copied
+    bool selectInputFrame(int index, int frame)
+    {
+        if(!ready && !prepareBindings(0))
+            return false;
+        if(index < 0 || index >= (int)inputs.size() || maxBatchSize > 1 || frame >= (int)inputs[index].frames.size())
+            return error("frame input index", index);
+        Port &port = inputs[index];
+        bool own = frame < 0 || !port.frames[frame];
+        try
+        {
+            for(size_t b=0; b<bindings.size(); b++)
+                bindings[b].BindInput(port.name.c_str(), own ? values[b*(inputs.size()+outputs.size()) + index] : port.frameTensors[frame]);
+        }
+        catch(const Ort::Exception &e)
+        {
+            printf("OrtModelRT: unable to select frame %d of input %d: %s\n", frame, index, e.what());
+            return false;
+        }
+        return true;
+    }
+
+    // the output at outputIndex is fed back to the input at inputIndex at the next run, starting from zeros
+    bool bindState(int inputIndex, int outputIndex, std::vector<int64_t> shape = {})
+    {
+        if(inputIndex < 0 || inputIndex >= (int)inputs.size())
+            return error("state input index", inputIndex);
+        if(outputIndex < 0 || outputIndex >= (int)outputs.size())
+            return error("state output index", outputIndex);
+        if(shape.empty())
+            shape = concreteShape(inputs[inputIndex].modelShape);
+
+        State state;
+        state.input = inputIndex;
+        state.output = outputIndex;
+        state.shape = shape;
+        size_t size = elementCount(shape);
+        state.buffers[0].assign(size, 0);
+        state.buffers[1].assign(size, 0);
+        states.push_back(state);
+        inputs[inputIndex].isState = true;
+        outputs[outputIndex].isState = true;
+        ready = false;
+        return true;
+    }
+
+    void resetState()
+    {
+        for(auto &state : states)
+        {
+            std::fill(state.buffers[0].begin(), state.buffers[0].end(), 0);
+            std::fill(state.buffers[1].begin(), state.buffers[1].end(), 0);
+        }
+    }
+
+    // builds the tensors over the bound buffers and binds them to the session, once for each state parity
+    // to be called in the render's setup() once everything is bound, otherwise the first run() does it, without warm-up
+    bool prepare() { return prepareBindings(0) && warmUp(); }
+
+    // as prepare(), for models whose inputs and outputs all start with a batch axis, bound with the largest batch size:
+    // every batch size up to that one is bound as well, so that setBatchSize() can restrict run() to the first entries
+    // of the buffers without allocating, e.g., to only process the voices that are playing
+    bool prepareBatches()
+    {
+        if(!states.empty())
+            return error("state pair count for a batched model", states.size());
+        if(inputs.empty() || inputs[0].shape.empty())
+            return error("batched input", 0);
+        int64_t maxBatch = inputs[0].shape[0];
+        for(auto *ports : {&inputs, &outputs})
+            for(size_t i=0; i<ports->size(); i++)
+                if((*ports)[i].shape.empty() || (*ports)[i].shape[0] != maxBatch)
+                    return error("batch size of port", i);
+        return prepareBindings(maxBatch) && warmUp();
+    }
+
+    // number of batch entries processed by run(), between 1 and the size bound before prepareBatches()
+    void setBatchSize(int size) { batchSize = std::max(1, std::min(size, maxBatchSize)); }
+    int getMaxBatchSize() const { return maxBatchSize; }
+
+    // reads the bound inputs and writes the bound outputs
+    bool run()
+    {
+        if(!ready && !prepareBindings(0))
+            return false;
+        try
+        {
+            session.Run(runOptions, bindings[2*(batchSize-1) + parity]);
+        }
+        catch(const Ort::Exception &e)
+        {
+            printf("OrtModelRT: run failed: %s\n", e.what());
+            return false;
+        }
+        if(!states.empty())
+            parity = 1-parity;
+        return true;
+    }
+
+    void cleanup()
+    {
+        bindings.clear();
+        values.clear();
+        inputs.clear();
+        outputs.clear();
+        states.clear();
+        session = Ort::Session(nullptr);
+        ready = false;
+    }
+
+private:
+    // runs every binding once, then the default one, and clears what the runs wrote
+    bool warmUp()
+    {
+        if(warmupRuns <= 0)
+            return true;
+        bool ok = true;
+        int runs = std::max<int>(warmupRuns, bindings.size());
+        int defaultBinding = 2*(maxBatchSize-1);
+        warmup = warmUpModel(("OrtModelRT '"+modelPath+"'").c_str(), runs, [&](int i)
+        {
+            int b = i < (int)bindings.size() ? i : defaultBinding + (states.empty() ? 0 : i%2);
+            try
+            {
+                session.Run(runOptions, bindings[b]);
+            }
+            catch(const Ort::Exception &e)
+            {
+                if(ok)
+                    printf("OrtModelRT: warm-up run failed: %s\n", e.what());
+                ok = false;
+            }
+        });
+
+        resetState();
+        parity = 0;
+        for(auto &output : outputs)
+            if(!output.isState)
+                std::fill(output.data, output.data + elementCount(output.shape), 0);
+        return ok;
+    }
+
+    // maxBatch > 0 binds every batch size from 1 to maxBatch, overriding the first dimension of all the ports
+    bool prepareBindings(int64_t maxBatch)
+    {
+        bindings.clear();
+        values.clear();
+
+        for(size_t i=0; i<inputs.size(); i++)
+            if(!inputs[i].isState && !inputs[i].data)
+                return error("unbound input", i);
+        for(size_t i=0; i<outputs.size(); i++)
+            if(!outputs[i].isState && !outputs[i].data)
+                return error("unbound output", i);
+
+        try
+        {
+            for(int64_t batch=1; batch<=std::max<int64_t>(maxBatch, 1); batch++)
+            {
+                for(int p=0; p<2; p++)
+                {
+                    Ort::IoBinding binding(session);
+                    for(size_t i=0; i<inputs.size(); i++)
+                    {
+                        values.push_back(makeTensor(inputs[i], i, true, p, maxBatch > 0 ? batch : 0));
+                        binding.BindInput(inputs[i].name.c_str(), values.back());
+                    }
+                    for(size_t i=0; i<outputs.size(); i++)
+                    {
+                        values.push_back(makeTensor(outputs[i], i, false, p, maxBatch > 0 ? batch : 0));
+                        binding.BindOutput(outputs[i].name.c_str(), values.back());
+                    }
+                    bindings.push_back(std::move(binding));
+                }
+            }
+        }
+        catch(const Ort::Exception &e)
+        {
+            printf("OrtModelRT: unable to bind tensors: %s\n", e.what());
+            bindings.clear();
+            values.clear();
+            return false;
+        }
+        maxBatchSize = std::max<int64_t>(maxBatch, 1);
+        batchSize = maxBatchSize;
+        ready = true;
+        return true;
+    }
+
+    struct Port
+    {
+        std::string name;
+        std::vector<int64_t> modelShape;
+        std::vector<int64_t> shape;
+        float *data = nullptr;
+        bool isState = false;
+        std::vector<const float*> frames; // see bindInputFrames()
+        std::vector<Ort::Value> frameTensors;
+    };
+
+    struct State
+    {
+        int input;
+        int output;
+        std::vector<int64_t> shape;
+        std::vector<float> buffers[2]; // at even runs the input reads buffers[0] and the output writes buffers[1], then they swap
+    };
+
+    static std::vector<int64_t> concreteShape(std::vector<int64_t> shape)
+    {
+        for(auto &dim : shape)
+            if(dim < 0)
+                dim = 1;
+        return shape;
+    }
+
+    static size_t elementCount(const std::vector<int64_t> &shape)
+    {
+        size_t count = 1;
+        for(auto dim : shape)
+            count *= dim;
+        return count;
+    }
+
+    // returns a note on the optimized model cache, for the setup report
+    const char* createSession(const std::string &modelPath, const Options &options)
+    {
+        std::string cachePath = options.optimizedModelCache ? getCachePath(modelPath, options) : "";
+        if(cachePath.empty())
+        {
+            sessionOptions = Ort::SessionOptions();
+            applyOptions(options);
+            session = Ort::Session(env, modelPath.c_str(), sessionOptions);
+            return "";
+        }
+
+        if(FILE *cached = fopen(cachePath.c_str(), "rb"))
+        {
+            fclose(cached);
+            sessionOptions = Ort::SessionOptions();
+            applyOptions(options);
+            sessionOptions.SetGraphOptimizationLevel(ORT_DISABLE_ALL); // already optimized
+            try
+            {
+                session = Ort::Session(env, cachePath.c_str(), sessionOptions);
+                return ", from optimized model cache";
+            }
+            catch(const Ort::Exception &e)
+            {
+                printf("OrtModelRT: discarding optimized model cache '%s': %s\n", cachePath.c_str(), e.what());
+                remove(cachePath.c_str());
+            }
+        }
+
+        // ONNX Runtime saves the optimized graph while creating the session, renamed only once complete
+        std::string tempPath = cachePath+".tmp";
+        sessionOptions = Ort::SessionOptions();
+        applyOptions(options);
+        sessionOptions.SetOptimizedModelFilePath(tempPath.c_str());
+        try
+        {
+            session = Ort::Session(env, modelPath.c_str(), sessionOptions);
+        }
+        catch(const Ort::Exception &e)
+        {
+            // e.g., the cache folder is not writable, load without caching
+            remove(tempPath.c_str());
+            printf("OrtModelRT: unable to cache optimized model as '%s': %s\n", cachePath.c_str(), e.what());
+            sessionOptions = Ort::SessionOptions();
+            applyOptions(options);
+            session = Ort::Session(env, modelPath.c_str(), sessionOptions);
+            return "";
+        }
+        if(rename(tempPath.c_str(), cachePath.c_str()) != 0)
+        {
+            remove(tempPath.c_str());
+            return "";
+        }
+        return ", optimized model cached";
+    }
+
+    // <cacheDir or model folder>/<model name>.<key>.opt.onnx, where the key hashes the model file, the ONNX Runtime version and the options
+    static std::string getCachePath(const std::string &modelPath, const Options &options)
+    {
+        FILE *model = fopen(modelPath.c_str(), "rb");
+        if(!model)
+            return "";
+        uint64_t hash = 14695981039346656037ULL; // FNV-1a
+        unsigned char chunk[65536];
+        size_t count;
+        while((count = fread(chunk, 1, sizeof(chunk), model)) > 0)
+            hash = fnv1a(hash, chunk, count);
+        fclose(model);
+
+        char key[512];
+        int length = snprintf(key, sizeof(key), "%s|%d|%d|%d|%d|%d|%d|%s", OrtGetApiBase()->GetVersionString(),
+                              options.intraOpThreads, options.interOpThreads, options.parallelExecution, (int)options.optimizationLevel,
+                              options.allowSpinning, options.memoryArena, options.intraOpAffinities.c_str());
+        hash = fnv1a(hash, key, std::min(length, (int)sizeof(key)-1));
+
+        size_t slash = modelPath.find_last_of('/');
+        std::string dir = slash == std::string::npos ? "." : modelPath.substr(0, slash);
+        std::string name = slash == std::string::npos ? modelPath : modelPath.substr(slash+1);
+        size_t dot = name.find_last_of('.');
+        if(dot != std::string::npos)
+            name = name.substr(0, dot);
+        if(!options.cacheDir.empty())
+            dir = options.cacheDir;
+
+        char hex[17];
+        snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+        return dir+"/"+name+"."+hex+".opt.onnx";
+    }
+
+    static uint64_t fnv1a(uint64_t hash, const void *data, size_t size)
+    {
+        const unsigned char *bytes = (const unsigned char*)data;
+        for(size_t i=0; i<size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    void applyOptions(const Options &options)
+    {
+        sessionOptions.SetIntraOpNumThreads(options.intraOpThreads);
+        sessionOptions.SetInterOpNumThreads(options.interOpThreads);
+        sessionOptions.SetExecutionMode(options.parallelExecution ? ORT_PARALLEL : ORT_SEQUENTIAL);
+        sessionOptions.SetGraphOptimizationLevel(options.optimizationLevel);
+        sessionOptions.AddConfigEntry("session.intra_op.allow_spinning", options.allowSpinning ? "1" : "0");
+        sessionOptions.AddConfigEntry("session.inter_op.allow_spinning", options.allowSpinning ? "1" : "0");
+        if(options.memoryArena)
+            sessionOptions.EnableCpuMemArena();
+        else
+            sessionOptions.DisableCpuMemArena();
+        if(!options.intraOpAffinities.empty())
+            sessionOptions.AddConfigEntry("session.intra_op_thread_affinities", options.intraOpAffinities.c_str());
+    }
+
+    bool error(const char *what, int index)
+    {
+        printf("OrtModelRT: invalid %s %d\n", what, index);
+        return false;
+    }
+
+    bool bind(Port &port, float *data, std::vector<int64_t> shape)
+    {
+        port.data = data;
+        port.frames.clear(); // built over the previous shape
+        port.frameTensors.clear();
+        port.shape = shape.empty() ? concreteShape(port.modelShape) : shape;
+        ready = false;
+        return true;
+    }
+
+    // batch > 0 overrides the first dimension of the port
+    Ort::Value makeTensor(Port &port, int index, bool isInput, int p, int64_t batch = 0)
+    {
+        float *data = port.data;
+        std::vector<int64_t> *shape = &port.shape;
+        std::vector<int64_t> batchShape;
+        if(batch > 0)
+        {
+            batchShape = port.shape;
+            batchShape[0] = batch;
+            shape = &batchShape;
+        }
+        for(auto &state : states)
+        {
+            if(isInput && state.input == index)
+            {
+                data = state.buffers[p].data();
+                shape = &state.shape;
+            }
+            else if(!isInput && state.output == index)
+            {
+                data = state.buffers[1-p].data();
+                shape = &state.shape;
+            }
+        }
+        return Ort::Value::CreateTensor<float>(memoryInfo, data, elementCount(*shape), shape->data(), shape->size());
+    }
+
+    // all created in setup(), as renders declare their models as globals, constructed before ONNX Runtime can be used
+    Ort::Env env{nullptr};
+    Ort::SessionOptions sessionOptions{nullptr};
+    Ort::Session session{nullptr};
+    Ort::RunOptions runOptions{nullptr};
+    Ort::MemoryInfo memoryInfo{nullptr};
+
+    std::vector<Port> inputs;
+    std::vector<Port> outputs;
+    std::vector<State> states;
+    int parity = 0;
+    int batchSize = 1;
+    int maxBatchSize = 1;
+    bool ready = false;
+    double setupTime_ms = 0;
+    std::string modelPath;
+    int warmupRuns = 0;
+    WarmupReport warmup;
+
+    std::vector<Ort::IoBinding> bindings; // one per batch size and state parity, at 2*(batchSize-1) + parity
+    std::vector<Ort::Value> values; // tensors referenced by the bindings, binding b binds the inputs then the outputs from b*(inputs+outputs)
+};
+
+#endif /* ORT_MODEL_RT_H_ */
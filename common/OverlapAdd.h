@@ -0,0 +1,126 @@
+#ifndef OVERLAP_ADD_H_
+#define OVERLAP_ADD_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(__AVX__) || defined(__SSE__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Overlap-add of fixed-size output segments that start hopSize samples apart, for any hop up to the segment size
+// (segmentSize/2 for 50% overlap, segmentSize/4 for 75% and so on).
+// Each segment is weighted by a synthesis window and summed into an accumulator that holds the samples of the hops it spans.
+// Once all the segments overlapping a hop were added, the hop is complete and can be played from getHop().
+// The window is normalized so that the overlapping windows sum to one at every sample (COLA), whatever the hop,
+// except for none, which sums the segments as they are, for models that window their output already.
+// Nothing is allocated after setup(), addSegment() and advance() are safe to call from the audio thread.
+class OverlapAdd
+{
+public:
+    enum Window { none, rectangular, hann, sqrtHann, triangular };
+
+    OverlapAdd() {}
+
+    bool setup(int segmentSize, int hopSize, Window window = none)
+    {
+        if(segmentSize <= 0 || hopSize <= 0 || hopSize > segmentSize)
+        {
+            printf("OverlapAdd: hop size %d must be between 1 and the segment size %d\n", hopSize, segmentSize);
+            return false;
+        }
+        this->segmentSize = segmentSize;
+        this->hopSize = hopSize;
+        accumulator.assign(segmentSize, 0);
+        gains.resize(segmentSize);
+
+        if(window == none)
+        {
+            std::fill(gains.begin(), gains.end(), 1.0f);
+            return true;
+        }
+
+        for(int i=0; i<segmentSize; i++)
+            gains[i] = windowValue(window, i, segmentSize);
+
+        // the overlapping windows sum to a function of period hopSize, which is divided out
+        std::vector<float> sums(hopSize, 0);
+        for(int i=0; i<segmentSize; i++)
+            sums[i % hopSize] += gains[i];
+        for(int i=0; i<segmentSize; i++)
+        {
+            float sum = sums[i % hopSize];
+            gains[i] = sum > 1e-6f ? gains[i]/sum : 0;
+        }
+        return true;
+    }
+
+    // zeroes all the pending overlaps, e.g., when the output restarts
+    void reset() { std::fill(accumulator.begin(), accumulator.end(), 0.0f); }
+
+    // adds a segment that starts at the current hop
+    void addSegment(const float *segment) { multiplyAccumulate(accumulator.data(), segment, gains.data(), segmentSize); }
+
+    // hopSize samples, valid until the next call to advance()
+    const float* getHop() const { return accumulator.data(); }
+
+    // moves on to the next hop, once the current one has been played
+    void advance()
+    {
+        float *acc = accumulator.data();
+        memmove(acc, acc + hopSize, (segmentSize-hopSize)*sizeof(float));
+        memset(acc + segmentSize-hopSize, 0, hopSize*sizeof(float));
+    }
+
+    int getSegmentSize() const { return segmentSize; }
+    int getHopSize() const { return hopSize; }
+    const float* getWindow() const { return gains.data(); } // normalized
+
+private:
+    // periodic windows, which overlap-add to a constant at the usual hops
+    static float windowValue(Window window, int i, int size)
+    {
+        float hannValue = 0.5f - 0.5f*cosf(2*M_PI*i/size);
+        switch(window)
+        {
+            case hann:
+                return hannValue;
+            case sqrtHann:
+                return sqrtf(hannValue);
+            case triangular:
+                return 1 - fabsf(2.0f*i/size - 1);
+            default:
+                return 1;
+        }
+    }
+
+    // dst[i] += src[i]*gains[i]
+    static void multiplyAccumulate(float *dst, const float *src, const float *gains, int size)
+    {
+        int i = 0;
+#if defined(__AVX__)
+        for(; i+8<=size; i+=8)
+            _mm256_storeu_ps(dst+i, _mm256_add_ps(_mm256_loadu_ps(dst+i), _mm256_mul_ps(_mm256_loadu_ps(src+i), _mm256_loadu_ps(gains+i))));
+#elif defined(__SSE__)
+        for(; i+4<=size; i+=4)
+            _mm_storeu_ps(dst+i, _mm_add_ps(_mm_loadu_ps(dst+i), _mm_mul_ps(_mm_loadu_ps(src+i), _mm_loadu_ps(gains+i))));
+#elif defined(__ARM_NEON)
+        for(; i+4<=size; i+=4)
+            vst1q_f32(dst+i, vmlaq_f32(vld1q_f32(dst+i), vld1q_f32(src+i), vld1q_f32(gains+i)));
+#endif
+        for(; i<size; i++)
+            dst[i] += src[i]*gains[i];
+    }
+
+    int segmentSize = 0;
+    int hopSize = 0;
+    std::vector<float> accumulator; // segmentSize samples, starting from the current hop
+    std::vector<float> gains; // normalized synthesis window
+};
+
+#endif /* OVERLAP_ADD_H_ */
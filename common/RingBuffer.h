@@ -0,0 +1,87 @@
+#ifndef RING_BUFFER_H_
+#define RING_BUFFER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// Power-of-2 ring of samples that hands out contiguous windows, for models that read a sliding window of their input.
+// Every sample is written twice, at its position and one capacity further, so any window of up to capacity samples
+// starting anywhere in the ring is contiguous in memory and can be read without a wrap branch.
+// Indices run freely and are only masked when accessing the storage, so there is no modulo on the per-sample path.
+// If threadSafe is true, a producer thread can push() while a consumer thread reads windows and advances,
+// push() then refuses samples that would overwrite the ones not yet released by advance().
+// Otherwise, the ring is meant for a single thread and push() overwrites the oldest samples.
+template<typename T, bool threadSafe = false>
+class RingBuffer
+{
+public:
+    RingBuffer() {}
+
+    // capacity is rounded up to a power of 2 and bounds the window length,
+    // delay zeros are in the ring already, i.e., the first window starts delay samples before the first push()
+    bool setup(int capacity, int delay = 0)
+    {
+        if(capacity <= 0 || delay < 0 || delay > capacity)
+            return false;
+        int size = 1;
+        while(size < capacity)
+            size <<= 1;
+        buffer.assign(2*size, T());
+        mask = size-1;
+        readIndex.store(0);
+        writeIndex.store(delay);
+        return true;
+    }
+
+    // producer
+    bool push(T value)
+    {
+        uint64_t w = writeIndex.load(std::memory_order_relaxed);
+        if(threadSafe && w - readIndex.load(std::memory_order_acquire) > mask)
+            return false; // full
+        uint64_t i = w & mask;
+        buffer[i] = value;
+        buffer[i + mask+1] = value;
+        writeIndex.store(w+1, threadSafe ? std::memory_order_release : std::memory_order_relaxed);
+        return true;
+    }
+
+    // number of samples pushed since the read position
+    int available() const
+    {
+        return writeIndex.load(threadSafe ? std::memory_order_acquire : std::memory_order_relaxed) - readIndex.load(std::memory_order_relaxed);
+    }
+
+    // consumer, contiguous window of up to capacity samples starting at the read position
+    const T* window() const { return buffer.data() + (readIndex.load(std::memory_order_relaxed) & mask); }
+
+    // consumer, moves the read position forward, releasing the oldest samples
+    void advance(int count)
+    {
+        readIndex.store(readIndex.load(std::memory_order_relaxed) + count, threadSafe ? std::memory_order_release : std::memory_order_relaxed);
+    }
+
+    // contiguous window of the last length samples pushed, regardless of the read position
+    const T* latest(int length) const
+    {
+        return buffer.data() + ((writeIndex.load(threadSafe ? std::memory_order_acquire : std::memory_order_relaxed) - length) & mask);
+    }
+
+    int getCapacity() const { return mask+1; }
+
+    // frees the storage, setup() must be called again before the ring is used
+    void release()
+    {
+        std::vector<T>().swap(buffer);
+        mask = 0;
+    }
+
+private:
+    std::vector<T> buffer; // two copies of the ring, back to back
+    uint64_t mask = 0;
+    std::atomic<uint64_t> writeIndex{0};
+    std::atomic<uint64_t> readIndex{0};
+};
+
+#endif /* RING_BUFFER_H_ */
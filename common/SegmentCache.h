@@ -0,0 +1,158 @@
+#ifndef SEGMENT_CACHE_H_
+#define SEGMENT_CACHE_H_
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Decoded LTS segments, keyed by the latent frames of the two sources and the interpolation, quantized to interpolationSteps.
+// Once the latent files have looped, segments that were decoded already are served from memory instead of running the decoder again,
+// which only holds if the decoder is deterministic, i.e., it decodes mu rather than sampling around it.
+// Memory is bounded by the budget given to setup(), where all the slots are allocated;
+// when full, the least recently used segment is evicted, so find() and insert() are safe to call from the audio thread.
+class SegmentCache
+{
+public:
+    SegmentCache() {}
+
+    bool setup(int segmentSize, size_t budgetBytes, int interpolationSteps = 1000)
+    {
+        this->segmentSize = segmentSize;
+        this->interpolationSteps = interpolationSteps;
+        int numSlots = budgetBytes/(segmentSize*sizeof(float));
+        if(numSlots < 1)
+        {
+            printf("SegmentCache: a budget of %zu bytes does not hold a single segment\n", budgetBytes);
+            return false;
+        }
+        segments.assign((size_t)numSlots*segmentSize, 0);
+        slots.assign(numSlots, Slot());
+        int numBuckets = 1;
+        while(numBuckets < 2*numSlots)
+            numBuckets <<= 1;
+        buckets.assign(numBuckets, -1);
+
+        // all the slots start in the LRU list, empty ones are the first to be reused
+        for(int i=0; i<numSlots; i++)
+        {
+            slots[i].older = i+1 < numSlots ? i+1 : -1;
+            slots[i].newer = i-1;
+        }
+        newest = 0;
+        oldest = numSlots-1;
+        hits = 0;
+        misses = 0;
+        return true;
+    }
+
+    // the interpolation that segments are decoded with, so that a segment does not depend on where its quantization step was hit
+    float quantize(float interpolation) const { return quantizedStep(interpolation)/(float)interpolationSteps; }
+
+    // the cached segment, or nullptr; valid until the next insert()
+    const float* find(int frame0, int frame1, float interpolation)
+    {
+        int slot = lookup(makeKey(frame0, frame1, interpolation));
+        if(slot < 0)
+        {
+            misses++;
+            return nullptr;
+        }
+        hits++;
+        touch(slot);
+        return segments.data() + (size_t)slot*segmentSize;
+    }
+
+    // copies a decoded segment into the cache, in place of the least recently used one
+    void insert(int frame0, int frame1, float interpolation, const float *segment)
+    {
+        uint64_t key = makeKey(frame0, frame1, interpolation);
+        int slot = lookup(key);
+        if(slot < 0)
+        {
+            slot = oldest;
+            if(slots[slot].used)
+                unlink(slot);
+            slots[slot].key = key;
+            slots[slot].used = true;
+            int &head = buckets[bucket(key)];
+            slots[slot].next = head;
+            head = slot;
+        }
+        memcpy(segments.data() + (size_t)slot*segmentSize, segment, segmentSize*sizeof(float));
+        touch(slot);
+    }
+
+    uint64_t getHits() const { return hits; }
+    uint64_t getMisses() const { return misses; }
+    size_t getCapacity() const { return slots.size(); }
+
+private:
+    struct Slot
+    {
+        uint64_t key = 0;
+        bool used = false;
+        int next = -1; // in the bucket chain
+        int newer = -1; // in the LRU list
+        int older = -1;
+    };
+
+    int quantizedStep(float interpolation) const { return (int)lrintf(interpolation*interpolationSteps); }
+
+    uint64_t makeKey(int frame0, int frame1, float interpolation) const
+    {
+        return (uint64_t)(frame0 & 0xfffff) << 40 | (uint64_t)(frame1 & 0xfffff) << 20 | (quantizedStep(interpolation) & 0xfffff);
+    }
+
+    size_t bucket(uint64_t key) const { return (key * 0x9e3779b97f4a7c15ull) >> 32 & (buckets.size()-1); }
+
+    int lookup(uint64_t key) const
+    {
+        for(int slot = buckets[bucket(key)]; slot >= 0; slot = slots[slot].next)
+            if(slots[slot].key == key)
+                return slot;
+        return -1;
+    }
+
+    // removes a slot from its bucket chain
+    void unlink(int slot)
+    {
+        int *link = &buckets[bucket(slots[slot].key)];
+        while(*link != slot)
+            link = &slots[*link].next;
+        *link = slots[slot].next;
+        slots[slot].used = false;
+    }
+
+    // moves a slot to the most recently used end of the LRU list
+    void touch(int slot)
+    {
+        if(slot == newest)
+            return;
+        Slot &s = slots[slot];
+        // detach, the slot is not the newest so it has a newer neighbour
+        slots[s.newer].older = s.older;
+        if(s.older >= 0)
+            slots[s.older].newer = s.newer;
+        else
+            oldest = s.newer;
+        // attach in front
+        s.newer = -1;
+        s.older = newest;
+        slots[newest].newer = slot;
+        newest = slot;
+    }
+
+    int segmentSize = 0;
+    int interpolationSteps = 1000;
+    std::vector<float> segments; // one segment per slot
+    std::vector<Slot> slots;
+    std::vector<int> buckets; // first slot of each chain, -1 if empty
+    int newest = -1;
+    int oldest = -1;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+#endif /* SEGMENT_CACHE_H_ */
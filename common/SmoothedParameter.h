@@ -0,0 +1,157 @@
+#ifndef SMOOTHED_PARAMETER_H_
+#define SMOOTHED_PARAMETER_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Linear ramp towards a target, advanced by blocks of samples from the audio thread.
+class ParameterRamp
+{
+public:
+    void setup(float value, int rampSamples)
+    {
+        this->value = value;
+        target = value;
+        this->rampSamples = rampSamples > 0 ? rampSamples : 1;
+        remaining = 0;
+    }
+
+    // a new target restarts the ramp from the current value
+    void setTarget(float newTarget)
+    {
+        if(newTarget == target)
+            return;
+        target = newTarget;
+        remaining = rampSamples;
+        step = (target - value)/rampSamples;
+    }
+
+    // advances by a block of samples and returns the value at its end
+    float process(int samples)
+    {
+        if(remaining > samples)
+        {
+            value += step*samples;
+            remaining -= samples;
+        }
+        else
+        {
+            value = target;
+            remaining = 0;
+        }
+        return value;
+    }
+
+    float getValue() const { return value; }
+    bool isRamping() const { return remaining > 0; }
+
+private:
+    float value = 0;
+    float target = 0;
+    float step = 0;
+    int rampSamples = 1;
+    int remaining = 0;
+};
+
+// A control value set from any thread, e.g., a GUI or control thread, and read by the audio thread.
+// set() is a single atomic store, so neither side ever waits; the audio thread picks up the latest value at each block
+// and ramps towards it, so jumps in the control do not produce zipper noise.
+class SmoothedParameter
+{
+public:
+    SmoothedParameter() {}
+
+    void setup(float initialValue, float sampleRate, float rampTime_ms = 20)
+    {
+        target.store(initialValue);
+        ramp.setup(initialValue, rampTime_ms*0.001f*sampleRate);
+    }
+
+    // any thread
+    void set(float value) { target.store(value, std::memory_order_relaxed); }
+
+    // audio thread, advances by a block of samples and returns the value at its end
+    float process(int samples)
+    {
+        ramp.setTarget(target.load(std::memory_order_relaxed));
+        return ramp.process(samples);
+    }
+
+    float getValue() const { return ramp.getValue(); }
+
+private:
+    std::atomic<float> target{0};
+    ParameterRamp ramp;
+};
+
+// N control values that change together, e.g., the conditioning of a model, set from a single control thread.
+// The values go through a triple buffer: the writer fills its own copy and publishes it by swapping it with the middle one,
+// the audio thread swaps the middle one with its own only when a new set was published.
+// Both swaps are a single atomic exchange, so no lock is taken and the audio thread never sees half of an update.
+// Each value is then ramped separately.
+template<int N>
+class SmoothedParameterSet
+{
+public:
+    SmoothedParameterSet() {}
+
+    void setup(const std::array<float, N> &initialValues, float sampleRate, float rampTime_ms = 20)
+    {
+        for(auto &buffer : buffers)
+            buffer = initialValues;
+        pending = initialValues;
+        writeIndex = 0;
+        middle.store(1);
+        readIndex = 2;
+        for(int i=0; i<N; i++)
+            ramps[i].setup(initialValues[i], rampTime_ms*0.001f*sampleRate);
+        for(int i=0; i<N; i++)
+            values[i] = initialValues[i];
+    }
+
+    // control thread, changes one value and publishes the whole set
+    void set(int index, float value)
+    {
+        pending[index] = value;
+        publish(pending);
+    }
+
+    // control thread
+    void publish(const std::array<float, N> &newValues)
+    {
+        pending = newValues;
+        buffers[writeIndex] = newValues;
+        writeIndex = middle.exchange(writeIndex | fresh, std::memory_order_acq_rel) & indexMask;
+    }
+
+    // audio thread, advances by a block of samples and returns the values at its end
+    const float* process(int samples)
+    {
+        if(middle.load(std::memory_order_relaxed) & fresh)
+        {
+            readIndex = middle.exchange(readIndex, std::memory_order_acq_rel) & indexMask;
+            for(int i=0; i<N; i++)
+                ramps[i].setTarget(buffers[readIndex][i]);
+        }
+        for(int i=0; i<N; i++)
+            values[i] = ramps[i].process(samples);
+        return values;
+    }
+
+    const float* getValues() const { return values; }
+
+private:
+    static const uint8_t indexMask = 3;
+    static const uint8_t fresh = 4; // set when the middle buffer holds a set not read yet
+
+    std::array<float, N> buffers[3];
+    std::array<float, N> pending; // writer's latest values, for set()
+    uint8_t writeIndex = 0; // writer only
+    std::atomic<uint8_t> middle{1};
+    uint8_t readIndex = 2; // audio thread only
+    ParameterRamp ramps[N];
+    float values[N] = {0};
+};
+
+#endif /* SMOOTHED_PARAMETER_H_ */
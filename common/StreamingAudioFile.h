@@ -0,0 +1,250 @@
+#ifndef STREAMING_AUDIO_FILE_H_
+#define STREAMING_AUDIO_FILE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RingBuffer.h"
+
+// Looping mono source that streams a WAV file instead of loading it whole, for sample libraries that are minutes long.
+// A background I/O thread decodes the file chunk by chunk, ahead of the read position, into a bounded ring;
+// at the end of the file it seeks back to the start, so the audio thread sees an endless stream, as with a wrapped read pointer.
+// Startup time and resident memory depend on the ring size, not on the length of the file.
+// As AudioFileUtilities::loadMono(), only the first channel is read. PCM 8, 16, 24 and 32 bits and 32-bit float are supported.
+class StreamingAudioFile
+{
+public:
+    StreamingAudioFile() {}
+    ~StreamingAudioFile() { cleanup(); }
+
+    // bufferSize is in samples, rounded up to a power of 2, and bounds the length of read(),
+    // the ring is filled before setup() returns
+    bool setup(std::string path, int bufferSize = 1<<16, int chunkFrames = 4096, int pollInterval_ms = 2)
+    {
+        cleanup();
+        this->path = path;
+        file = fopen(path.c_str(), "rb");
+        if(!file)
+        {
+            printf("StreamingAudioFile: unable to open '%s'\n", path.c_str());
+            return false;
+        }
+        if(!parseHeader())
+        {
+            printf("StreamingAudioFile: '%s' is not a supported WAV file\n", path.c_str());
+            fclose(file);
+            file = nullptr;
+            return false;
+        }
+
+        ring.setup(bufferSize);
+        chunk.resize((size_t)chunkFrames*frameBytes);
+        decoded.resize(chunkFrames);
+        decodedCount = 0;
+        decodedPos = 0;
+        framesLeft = numFrames;
+        underruns = 0;
+        this->pollInterval_ms = pollInterval_ms;
+
+        // prefill, before the I/O thread takes over
+        while(fill())
+            ;
+        running = true;
+        reader = std::thread(&StreamingAudioFile::loop, this);
+        return true;
+    }
+
+    // audio thread, copies count samples from the read position and moves it forward by advance samples,
+    // so consecutive reads can overlap, e.g., a segment per hop
+    // if the I/O thread fell behind, the missing samples are zeros and false is returned
+    bool read(float *dest, int count, int advance)
+    {
+        int available = ring.available();
+        const float *window = ring.window();
+        if(available >= count)
+        {
+            std::copy(window, window + count, dest);
+            ring.advance(advance);
+            return true;
+        }
+        std::copy(window, window + available, dest);
+        std::fill(dest + available, dest + count, 0.0f);
+        ring.advance(std::min(advance, available));
+        underruns++;
+        return false;
+    }
+
+    // samples that can be read without underrun
+    int getAvailable() const { return ring.available(); }
+    size_t getNumFrames() const { return numFrames; }
+    int getSampleRate() const { return sampleRate; }
+    int getCapacity() const { return ring.getCapacity(); }
+    uint64_t getUnderruns() const { return underruns; }
+
+    // audio thread, for a source that will not be read anymore, e.g., once all its segments are encoded:
+    // the I/O thread closes the file, frees the ring and exits on its own, so the caller does not wait for it
+    // read() must not be called afterwards; cleanup() still joins the thread
+    void release() { running = false; }
+
+    void cleanup()
+    {
+        if(reader.joinable())
+        {
+            running = false;
+            reader.join(); // the I/O thread closes the file on its way out
+            if(underruns > 0)
+                printf("StreamingAudioFile: %llu underruns on '%s'\n", (unsigned long long)underruns, path.c_str());
+        }
+    }
+
+private:
+    void loop()
+    {
+        while(running)
+        {
+            if(!fill())
+                std::this_thread::sleep_for(std::chrono::milliseconds(pollInterval_ms));
+        }
+
+        // stopped by release() or cleanup(), nothing is read from the file or the ring anymore
+        fclose(file);
+        file = nullptr;
+        ring.release();
+        std::vector<unsigned char>().swap(chunk);
+        std::vector<float>().swap(decoded);
+    }
+
+    // pushes decoded samples until the ring is full, decoding the next chunk when needed; returns false when full
+    bool fill()
+    {
+        if(decodedPos == decodedCount && !decodeChunk())
+            return false;
+        while(decodedPos < decodedCount)
+        {
+            if(!ring.push(decoded[decodedPos]))
+                return false;
+            decodedPos++;
+        }
+        return true;
+    }
+
+    bool decodeChunk()
+    {
+        if(framesLeft == 0)
+        {
+            fseek(file, dataOffset, SEEK_SET); // loop
+            framesLeft = numFrames;
+        }
+        size_t frames = std::min(framesLeft, decoded.size());
+        frames = fread(chunk.data(), frameBytes, frames, file);
+        if(frames == 0)
+        {
+            // truncated data chunk, loop from what was read
+            framesLeft = 0;
+            return false;
+        }
+        framesLeft -= frames;
+        for(size_t i=0; i<frames; i++)
+            decoded[i] = decodeSample(chunk.data() + i*frameBytes);
+        decodedCount = frames;
+        decodedPos = 0;
+        return true;
+    }
+
+    float decodeSample(const unsigned char *s) const
+    {
+        switch(sampleBytes)
+        {
+            case 1: return (s[0] - 128) / 128.0f;
+            case 2: return (int16_t)(s[0] | s[1] << 8) / 32768.0f;
+            case 3: return (int32_t)((uint32_t)s[0] << 8 | (uint32_t)s[1] << 16 | (uint32_t)s[2] << 24) / 2147483648.0f;
+            default:
+            {
+                uint32_t bits = (uint32_t)s[0] | (uint32_t)s[1] << 8 | (uint32_t)s[2] << 16 | (uint32_t)s[3] << 24;
+                if(isFloat)
+                {
+                    float value;
+                    memcpy(&value, &bits, sizeof(value));
+                    return value;
+                }
+                return (int32_t)bits / 2147483648.0f;
+            }
+        }
+    }
+
+    static uint32_t le32(const unsigned char *b) { return (uint32_t)b[0] | (uint32_t)b[1] << 8 | (uint32_t)b[2] << 16 | (uint32_t)b[3] << 24; }
+    static uint16_t le16(const unsigned char *b) { return b[0] | b[1] << 8; }
+
+    // finds the fmt and data chunks
+    bool parseHeader()
+    {
+        unsigned char riff[12];
+        if(fread(riff, 1, 12, file) != 12 || memcmp(riff, "RIFF", 4) || memcmp(riff+8, "WAVE", 4))
+            return false;
+        bool haveFormat = false;
+        unsigned char header[8];
+        while(fread(header, 1, 8, file) == 8)
+        {
+            uint32_t size = le32(header+4);
+            long start = ftell(file);
+            if(!memcmp(header, "fmt ", 4))
+            {
+                unsigned char fmt[40] = {0};
+                if(size < 16 || fread(fmt, 1, std::min<uint32_t>(size, sizeof(fmt)), file) < 16)
+                    return false;
+                int format = le16(fmt);
+                if(format == 0xFFFE && size >= 26)
+                    format = le16(fmt+24); // extensible, the subformat GUID starts with the format code
+                int channels = le16(fmt+2);
+                sampleRate = le32(fmt+4);
+                int bits = le16(fmt+14);
+                isFloat = format == 3;
+                if((format != 1 && !isFloat) || (isFloat && bits != 32) || bits < 8 || bits > 32 || bits % 8 || channels < 1)
+                    return false;
+                sampleBytes = bits/8;
+                frameBytes = sampleBytes*channels;
+                haveFormat = true;
+            }
+            else if(!memcmp(header, "data", 4))
+            {
+                if(!haveFormat)
+                    return false;
+                dataOffset = start;
+                numFrames = size/frameBytes;
+                return numFrames > 0;
+            }
+            fseek(file, start + size + (size & 1), SEEK_SET); // chunks are padded to an even size
+        }
+        return false;
+    }
+
+    std::string path;
+    FILE *file = nullptr;
+    long dataOffset = 0;
+    size_t numFrames = 0;
+    int sampleRate = 0;
+    int sampleBytes = 2;
+    int frameBytes = 2;
+    bool isFloat = false;
+
+    RingBuffer<float, true> ring; // decoded samples, pushed by the I/O thread
+    // I/O thread only, and setup() before it starts
+    std::vector<unsigned char> chunk;
+    std::vector<float> decoded;
+    size_t decodedCount = 0;
+    size_t decodedPos = 0;
+    size_t framesLeft = 0;
+
+    uint64_t underruns = 0; // audio thread only
+    int pollInterval_ms = 2;
+    std::atomic<bool> running{false};
+    std::thread reader;
+};
+
+#endif /* STREAMING_AUDIO_FILE_H_ */
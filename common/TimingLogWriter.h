@@ -0,0 +1,162 @@
+#ifndef TIMING_LOG_WRITER_H_
+#define TIMING_LOG_WRITER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Binary timing log, little-endian:
+// - a TimingLogHeader
+// - packed uint32_t records, one per timed call, in nanoseconds (saturated at UINT32_MAX)
+// tools/read_timing_log.py converts it back to text or numpy.
+struct TimingLogHeader
+{
+    char magic[8];          // "LDSPTLOG"
+    uint32_t version;
+    uint32_t headerSize;    // sizeof(TimingLogHeader), records start right after
+    char model[64];         // zero terminated
+    uint32_t sampleRate;
+    uint32_t periodFrames;
+    uint32_t outputSize;    // samples generated by each timed call
+    uint32_t clockSource;   // one of TimingLogWriter::ClockSource
+    uint32_t recordBytes;   // size of each record
+    uint32_t reserved[3];
+};
+static_assert(sizeof(TimingLogHeader) == 112, "TimingLogHeader must stay packed");
+
+// Streams timing records to a binary file with constant memory, for tests of any duration.
+// push() is called from the audio thread and only writes into a preallocated single-producer/single-consumer ring,
+// while a background thread periodically drains the ring to the file.
+// If the flusher cannot keep up, records are dropped and counted rather than blocking the audio thread.
+class TimingLogWriter
+{
+public:
+    enum ClockSource { steadyClock = 1 };
+
+    TimingLogWriter() {}
+    ~TimingLogWriter() { cleanup(); }
+
+    // ringSize is rounded up to a power of 2
+    bool setup(std::string path, std::string modelName, int sampleRate, int periodFrames, int outputSize,
+               int ringSize = 1<<16, int flushInterval_ms = 20)
+    {
+        cleanup();
+
+        file = fopen(path.c_str(), "wb");
+        if(!file)
+        {
+            printf("TimingLogWriter: unable to open '%s'\n", path.c_str());
+            return false;
+        }
+
+        TimingLogHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, "LDSPTLOG", 8);
+        header.version = 1;
+        header.headerSize = sizeof(TimingLogHeader);
+        strncpy(header.model, modelName.c_str(), sizeof(header.model)-1);
+        header.sampleRate = sampleRate;
+        header.periodFrames = periodFrames;
+        header.outputSize = outputSize;
+        header.clockSource = steadyClock;
+        header.recordBytes = sizeof(uint32_t);
+        fwrite(&header, sizeof(header), 1, file);
+
+        int size = 1;
+        while(size < ringSize)
+            size <<= 1;
+        ring.assign(size, 0);
+        mask = size-1;
+        writeIndex.store(0);
+        readIndex.store(0);
+        dropped.store(0);
+        written = 0;
+
+        this->flushInterval_ms = flushInterval_ms;
+        running = true;
+        flusher = std::thread(&TimingLogWriter::loop, this);
+        return true;
+    }
+
+    // audio thread
+    void push(uint64_t ns)
+    {
+        uint64_t w = writeIndex.load(std::memory_order_relaxed);
+#ifdef LDSP_HOST_RUNNER
+        // offline runs go faster than real time, wait for the flusher rather than dropping records
+        while(w - readIndex.load(std::memory_order_acquire) > mask)
+            std::this_thread::yield();
+#endif
+        if(w - readIndex.load(std::memory_order_acquire) > mask)
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        ring[w & mask] = ns > UINT32_MAX ? UINT32_MAX : (uint32_t)ns;
+        writeIndex.store(w+1, std::memory_order_release);
+    }
+
+    uint64_t getWritten() const { return written; }
+    uint64_t getDropped() const { return dropped.load(); }
+
+    // stops the flusher, drains what is left and closes the file
+    void cleanup()
+    {
+        if(!flusher.joinable())
+            return;
+        running = false;
+        flusher.join();
+        drain();
+        fclose(file);
+        file = nullptr;
+        if(getDropped() > 0)
+            printf("TimingLogWriter: %llu records dropped\n", (unsigned long long)getDropped());
+    }
+
+private:
+    void loop()
+    {
+        while(running)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(flushInterval_ms));
+            drain();
+        }
+    }
+
+    void drain()
+    {
+        uint64_t r = readIndex.load(std::memory_order_relaxed);
+        uint64_t w = writeIndex.load(std::memory_order_acquire);
+        while(r != w)
+        {
+            // write the contiguous part up to the end of the ring, then the wrapped part
+            uint64_t start = r & mask;
+            uint64_t count = w - r;
+            if(start + count > ring.size())
+                count = ring.size() - start;
+            fwrite(ring.data() + start, sizeof(uint32_t), count, file);
+            r += count;
+            written += count;
+            readIndex.store(r, std::memory_order_release);
+        }
+        fflush(file);
+    }
+
+    FILE *file = nullptr;
+    std::vector<uint32_t> ring;
+    uint64_t mask = 0;
+    std::atomic<uint64_t> writeIndex{0};
+    std::atomic<uint64_t> readIndex{0};
+    std::atomic<uint64_t> dropped{0};
+    uint64_t written = 0; // only accessed by the flusher, and by cleanup() once the flusher has stopped
+    int flushInterval_ms = 20;
+    std::atomic<bool> running{false};
+    std::thread flusher;
+};
+
+#endif /* TIMING_LOG_WRITER_H_ */
@@ -0,0 +1,44 @@
+#ifndef LDSP_H_
+#define LDSP_H_
+
+// Host-side replacement of the LDSP core header, see host/main.cpp.
+// It only provides what the projects in this repo use: the audio part of the context,
+// audioRead()/audioWrite() and LDSP_requestStop().
+
+// lets shared code tell offline runs from device runs,
+// e.g., to wait for worker threads instead of dropping their results when rendering faster than real time
+#define LDSP_HOST_RUNNER 1
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct LDSPcontext
+{
+    const float *audioIn;       // interleaved
+    float *audioOut;            // interleaved
+    uint32_t audioFrames;
+    uint32_t audioInChannels;
+    uint32_t audioOutChannels;
+    float audioSampleRate;
+    const char *projectName;
+};
+
+static inline float audioRead(LDSPcontext *context, int frame, int channel)
+{
+    return context->audioIn[frame*context->audioInChannels + channel];
+}
+
+static inline void audioWrite(LDSPcontext *context, int frame, int channel, float value)
+{
+    context->audioOut[frame*context->audioOutChannels + channel] = value;
+}
+
+void LDSP_requestStop();
+
+bool setup(LDSPcontext *context, void *userData);
+void render(LDSPcontext *context, void *userData);
+void cleanup(LDSPcontext *context, void *userData);
+
+#endif /* LDSP_H_ */
@@ -0,0 +1,122 @@
+#ifndef WAV_FILE_H_
+#define WAV_FILE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Minimal RIFF/WAVE reader and writer for the host runner.
+// Reads 16, 24 and 32 bit PCM and 32 bit float files, writes 32 bit float files.
+namespace WavFile
+{
+    // interleaved samples in [-1, 1], returns false if the file cannot be read
+    inline bool read(const std::string &path, std::vector<float> &samples, int &channels, int &sampleRate)
+    {
+        FILE *file = fopen(path.c_str(), "rb");
+        if(!file)
+            return false;
+
+        char riff[12];
+        if(fread(riff, 1, 12, file) != 12 || memcmp(riff, "RIFF", 4) != 0 || memcmp(riff+8, "WAVE", 4) != 0)
+        {
+            fclose(file);
+            return false;
+        }
+
+        uint16_t format = 0, bits = 0;
+        channels = 0;
+        sampleRate = 0;
+        char chunkId[4];
+        uint32_t chunkSize;
+        while(fread(chunkId, 1, 4, file) == 4 && fread(&chunkSize, 4, 1, file) == 1)
+        {
+            if(memcmp(chunkId, "fmt ", 4) == 0)
+            {
+                std::vector<uint8_t> fmt(chunkSize);
+                if(fread(fmt.data(), 1, chunkSize, file) != chunkSize || chunkSize < 16)
+                    break;
+                memcpy(&format, &fmt[0], 2);
+                uint16_t ch;
+                memcpy(&ch, &fmt[2], 2);
+                uint32_t rate;
+                memcpy(&rate, &fmt[4], 4);
+                memcpy(&bits, &fmt[14], 2);
+                if(format == 0xFFFE && chunkSize >= 26) // WAVE_FORMAT_EXTENSIBLE, the actual format is in the sub-format GUID
+                    memcpy(&format, &fmt[24], 2);
+                // reject the unsupported formats here, before bits is used as the size of a sample
+                if(!((format == 3 && bits == 32) || (format == 1 && (bits == 16 || bits == 24 || bits == 32))) || ch < 1)
+                    break;
+                channels = ch;
+                sampleRate = rate;
+            }
+            else if(memcmp(chunkId, "data", 4) == 0 && channels > 0)
+            {
+                std::vector<uint8_t> data(chunkSize);
+                size_t size = fread(data.data(), 1, chunkSize, file);
+                int bytes = bits/8;
+                size_t count = size / bytes;
+                samples.resize(count);
+                for(size_t i=0; i<count; i++)
+                {
+                    const uint8_t *p = &data[i*bytes];
+                    if(format == 3 && bits == 32)
+                        memcpy(&samples[i], p, 4);
+                    else if(format == 1 && bits == 16)
+                        samples[i] = (int16_t)(p[0] | (p[1]<<8)) / 32768.0f;
+                    else if(format == 1 && bits == 24)
+                        samples[i] = (int32_t)((p[0]<<8) | (p[1]<<16) | ((uint32_t)p[2]<<24)) / 2147483648.0f;
+                    else if(format == 1 && bits == 32)
+                        samples[i] = (int32_t)(p[0] | (p[1]<<8) | (p[2]<<16) | ((uint32_t)p[3]<<24)) / 2147483648.0f;
+                    else
+                    {
+                        fclose(file);
+                        return false;
+                    }
+                }
+                fclose(file);
+                return true;
+            }
+            else
+                fseek(file, chunkSize + (chunkSize & 1), SEEK_CUR);
+        }
+        fclose(file);
+        return false;
+    }
+
+    inline bool write(const std::string &path, const std::vector<float> &samples, int channels, int sampleRate)
+    {
+        FILE *file = fopen(path.c_str(), "wb");
+        if(!file)
+            return false;
+
+        uint32_t dataSize = samples.size()*sizeof(float);
+        uint32_t riffSize = 36 + dataSize;
+        uint16_t format = 3; // IEEE float
+        uint16_t ch = channels;
+        uint32_t rate = sampleRate;
+        uint32_t byteRate = sampleRate*channels*sizeof(float);
+        uint16_t blockAlign = channels*sizeof(float);
+        uint16_t bits = 32;
+        uint32_t fmtSize = 16;
+
+        fwrite("RIFF", 1, 4, file);
+        fwrite(&riffSize, 4, 1, file);
+        fwrite("WAVEfmt ", 1, 8, file);
+        fwrite(&fmtSize, 4, 1, file);
+        fwrite(&format, 2, 1, file);
+        fwrite(&ch, 2, 1, file);
+        fwrite(&rate, 4, 1, file);
+        fwrite(&byteRate, 4, 1, file);
+        fwrite(&blockAlign, 2, 1, file);
+        fwrite(&bits, 2, 1, file);
+        fwrite("data", 1, 4, file);
+        fwrite(&dataSize, 4, 1, file);
+        fwrite(samples.data(), sizeof(float), samples.size(), file);
+        fclose(file);
+        return true;
+    }
+}
+
+#endif /* WAV_FILE_H_ */
@@ -0,0 +1,28 @@
+#ifndef AUDIO_FILE_H_
+#define AUDIO_FILE_H_
+
+// Host-side replacement of the LDSP AudioFile library, limited to what the projects in this repo use
+
+#include <string>
+#include <vector>
+#include "../../WavFile.h"
+
+namespace AudioFileUtilities
+{
+    // first channel of the file, empty if the file cannot be read
+    inline std::vector<float> loadMono(const std::string &file)
+    {
+        std::vector<float> samples;
+        int channels, sampleRate;
+        if(!WavFile::read(file, samples, channels, sampleRate))
+            return {};
+        if(channels == 1)
+            return samples;
+        std::vector<float> mono(samples.size()/channels);
+        for(size_t i=0; i<mono.size(); i++)
+            mono[i] = samples[i*channels];
+        return mono;
+    }
+}
+
+#endif /* AUDIO_FILE_H_ */
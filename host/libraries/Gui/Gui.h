@@ -0,0 +1,14 @@
+#ifndef GUI_H_
+#define GUI_H_
+
+// Host-side replacement of the LDSP Gui library: there is no browser to connect to, so it does nothing
+
+#include <string>
+
+class Gui
+{
+public:
+    int setup(std::string projectName) { return 0; }
+};
+
+#endif /* GUI_H_ */
@@ -0,0 +1,28 @@
+#ifndef GUI_CONTROLLER_H_
+#define GUI_CONTROLLER_H_
+
+// Host-side replacement of the LDSP GuiController library: sliders never move and always return their default value
+
+#include <string>
+#include <vector>
+
+class Gui;
+
+class GuiController
+{
+public:
+    int setup(Gui *gui, std::string name) { return 0; }
+
+    int addSlider(std::string name, float defaultValue, float min, float max, float step)
+    {
+        sliders.push_back(defaultValue);
+        return sliders.size()-1;
+    }
+
+    float getSliderValue(int slider) { return sliders[slider]; }
+
+private:
+    std::vector<float> sliders;
+};
+
+#endif /* GUI_CONTROLLER_H_ */
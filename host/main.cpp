@@ -0,0 +1,172 @@
+/*
+    Offline host runner: drives a project's setup()/render()/cleanup() as fast as possible, without a device or an audio driver.
+    Input comes from a WAV file (looped if shorter than the requested duration) or from deterministic white noise,
+    output can be saved to a WAV file. The run ends when the project calls LDSP_requestStop(), or after --seconds of audio.
+    If setup() fails, the runner exits without calling cleanup(), so renders do not have to clean up after a partial setup.
+    See host/CMakeLists.txt for how to build a project with it.
+*/
+
+#include "LDSP.h"
+#include "WavFile.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <unistd.h>
+
+static std::atomic<bool> stopRequested{false};
+
+void LDSP_requestStop()
+{
+    stopRequested = true;
+}
+
+static void usage(const char *name)
+{
+    printf("usage: %s [options]\n"
+           "  --input <file.wav>   input audio, first channels are used (default: white noise)\n"
+           "  --output <file.wav>  save output audio\n"
+           "  --rate <Hz>          sample rate (default: 48000, or the rate of the input file)\n"
+           "  --period <frames>    frames per render() call (default: 256)\n"
+           "  --seconds <s>        stop after this much audio, if the project has not stopped already (default: 60)\n"
+           "  --project-dir <dir>  change to this directory before setup(), for projects that load files from their folder\n",
+           name);
+}
+
+int main(int argc, char *argv[])
+{
+    std::string inputPath, outputPath, projectDir;
+    int sampleRate = 0;
+    int periodFrames = 256;
+    double seconds = 60;
+
+    for(int i=1; i<argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i+1 < argc;
+        if(arg == "--input" && hasValue)
+            inputPath = argv[++i];
+        else if(arg == "--output" && hasValue)
+            outputPath = argv[++i];
+        else if(arg == "--rate" && hasValue && atoi(argv[i+1]) > 0)
+            sampleRate = atoi(argv[++i]);
+        else if(arg == "--period" && hasValue && atoi(argv[i+1]) > 0) // the period count below divides by it, and the buffers are sized from it
+            periodFrames = atoi(argv[++i]);
+        else if(arg == "--seconds" && hasValue)
+            seconds = atof(argv[++i]);
+        else if(arg == "--project-dir" && hasValue)
+            projectDir = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    const int inChannels = 2;
+    const int outChannels = 2;
+
+    // input, interleaved with inChannels
+    std::vector<float> input;
+    if(!inputPath.empty())
+    {
+        std::vector<float> fileSamples;
+        int fileChannels, fileRate;
+        if(!WavFile::read(inputPath, fileSamples, fileChannels, fileRate))
+        {
+            printf("unable to read input file '%s'\n", inputPath.c_str());
+            return 1;
+        }
+        if(sampleRate == 0)
+            sampleRate = fileRate;
+        else if(sampleRate != fileRate)
+            printf("Warning! Input file sample rate (%d) differs from the requested one (%d), no resampling is done\n", fileRate, sampleRate);
+
+        size_t frames = fileSamples.size()/fileChannels;
+        input.resize(frames*inChannels);
+        for(size_t n=0; n<frames; n++)
+            for(int ch=0; ch<inChannels; ch++)
+                input[n*inChannels + ch] = fileSamples[n*fileChannels + (ch < fileChannels ? ch : fileChannels-1)];
+    }
+    if(sampleRate == 0)
+        sampleRate = 48000;
+    if(input.empty())
+    {
+        std::mt19937 generator(1234);
+        std::uniform_real_distribution<float> noise(-0.5f, 0.5f);
+        input.resize((size_t)sampleRate*inChannels);
+        for(float &sample : input)
+            sample = noise(generator);
+    }
+    size_t inputFrames = input.size()/inChannels;
+
+    // output path stays relative to the directory the runner was launched from
+    char cwd[4096];
+    if(!outputPath.empty() && outputPath[0] != '/' && getcwd(cwd, sizeof(cwd)))
+        outputPath = std::string(cwd)+"/"+outputPath;
+    if(!projectDir.empty() && chdir(projectDir.c_str()) != 0)
+    {
+        printf("unable to change directory to '%s'\n", projectDir.c_str());
+        return 1;
+    }
+
+    std::vector<float> audioIn(periodFrames*inChannels);
+    std::vector<float> audioOut(periodFrames*outChannels);
+    std::vector<float> output;
+
+    LDSPcontext context;
+    context.audioIn = audioIn.data();
+    context.audioOut = audioOut.data();
+    context.audioFrames = periodFrames;
+    context.audioInChannels = inChannels;
+    context.audioOutChannels = outChannels;
+    context.audioSampleRate = sampleRate;
+    context.projectName = "host";
+
+    auto setupStart = std::chrono::steady_clock::now();
+    if(!setup(&context, nullptr))
+    {
+        printf("setup() failed\n");
+        return 1; // renders are not written to clean up after a partial setup()
+    }
+    auto renderStart = std::chrono::steady_clock::now();
+
+    long long maxPeriods = (long long)(seconds*sampleRate/periodFrames);
+    long long periods = 0;
+    size_t readFrame = 0;
+    while(!stopRequested && periods < maxPeriods)
+    {
+        for(int n=0; n<periodFrames; n++)
+        {
+            memcpy(&audioIn[n*inChannels], &input[readFrame*inChannels], inChannels*sizeof(float));
+            if(++readFrame >= inputFrames)
+                readFrame = 0;
+        }
+        std::fill(audioOut.begin(), audioOut.end(), 0.0f);
+
+        render(&context, nullptr);
+        periods++;
+
+        if(!outputPath.empty())
+            output.insert(output.end(), audioOut.begin(), audioOut.end());
+    }
+    auto renderEnd = std::chrono::steady_clock::now();
+
+    cleanup(&context, nullptr);
+
+    double setupTime = std::chrono::duration<double>(renderStart - setupStart).count();
+    double renderTime = std::chrono::duration<double>(renderEnd - renderStart).count();
+    double audioTime = (double)periods*periodFrames/sampleRate;
+    printf("setup %.3f s, %lld periods of %d frames (%.2f s of audio at %d Hz) rendered in %.3f s, %.1fx real time\n",
+           setupTime, periods, periodFrames, audioTime, sampleRate, renderTime, renderTime > 0 ? audioTime/renderTime : 0);
+
+    if(!outputPath.empty() && !WavFile::write(outputPath, output, outChannels, sampleRate))
+    {
+        printf("unable to write output file '%s'\n", outputPath.c_str());
+        return 1;
+    }
+
+    return 0;
+}
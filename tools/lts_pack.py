@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Packs raw mu/logvar .lts dumps into a single versioned .lts container, or prints the header of a container.
+
+usage: lts_pack.py pack <mu.lts> <logvar.lts> <packed.lts> [--latent-dim 256] [--hop N] [--windowed] [--dtype float32|float16|int8]
+       lts_pack.py info <packed.lts>
+
+The container is read by common/LatentFile.h, see LatentFileHeader there for the layout.
+float16 halves and int8 quarters the size of the latent data, int8 uses a scale and offset per frame and stream.
+Renders can load the packed file in place of the mu file, the logvar file is then ignored.
+"""
+import argparse
+import struct
+import zlib
+
+import numpy as np
+
+MAGIC = b'LDSPLTS\0'
+VERSION = 1
+HEADER = struct.Struct('<8sIIIIIIIII20x')  # same layout as LatentFileHeader, 64 bytes
+DTYPES = {'float32': 0, 'float16': 1, 'int8': 2}
+FLAG_WINDOWED = 1
+
+
+def align(size, alignment=64):
+    return (size + alignment - 1) // alignment * alignment
+
+
+def quantize(frames):
+    """Per-frame affine int8 quantization, returns (scale, offset, q) so that frames ~= offset + scale*q."""
+    low = frames.min(axis=1, keepdims=True)
+    high = frames.max(axis=1, keepdims=True)
+    scale = (high - low) / 254
+    scale[scale == 0] = 1
+    offset = (high + low) / 2
+    q = np.clip(np.round((frames - offset) / scale), -127, 127).astype(np.int8)
+    return scale[:, 0].astype(np.float32), offset[:, 0].astype(np.float32), q
+
+
+def pack(args):
+    mu = np.fromfile(args.mu, dtype='<f4')
+    logvar = np.fromfile(args.logvar, dtype='<f4')
+    dim = args.latent_dim
+    if mu.size != logvar.size or mu.size == 0 or mu.size % dim:
+        raise SystemExit(f'{args.mu} and {args.logvar} must hold the same whole number of {dim}-dimensional frames')
+    mu = mu.reshape(-1, dim)
+    logvar = logvar.reshape(-1, dim)
+    frames = mu.shape[0]
+
+    if args.dtype == 'float32':
+        body = np.concatenate([mu, logvar], axis=1).astype('<f4').view(np.uint8)
+    elif args.dtype == 'float16':
+        body = np.concatenate([mu, logvar], axis=1).astype('<f2').view(np.uint8)
+    else:
+        mu_scale, mu_offset, mu_q = quantize(mu)
+        logvar_scale, logvar_offset, logvar_q = quantize(logvar)
+        params = np.stack([mu_scale, mu_offset, logvar_scale, logvar_offset], axis=1).astype('<f4').view(np.uint8)
+        body = np.concatenate([params, mu_q.view(np.uint8), logvar_q.view(np.uint8)], axis=1)
+
+    stride = align(body.shape[1])
+    records = np.zeros((frames, stride), dtype=np.uint8)
+    records[:, :body.shape[1]] = body
+    payload = records.tobytes()
+
+    flags = FLAG_WINDOWED if args.windowed else 0
+    header = HEADER.pack(MAGIC, VERSION, HEADER.size, dim, frames, args.hop, flags, DTYPES[args.dtype], stride,
+                         zlib.crc32(payload) & 0xffffffff)
+    with open(args.packed, 'wb') as f:
+        f.write(header)
+        f.write(payload)
+
+    if args.dtype != 'float32':
+        restored = unpack_frames(header + payload)
+        error = max(np.max(np.abs(restored[0] - mu)), np.max(np.abs(restored[1] - logvar)))
+        print(f'max abs {args.dtype} error {error:.2e}')
+    print(f'{args.packed}: {frames} frames, {len(header) + len(payload)} bytes '
+          f'({(len(header) + len(payload)) / (mu.nbytes + logvar.nbytes) * 100:.0f}% of the raw files)')
+
+
+def read_header(data):
+    fields = HEADER.unpack_from(data)
+    if fields[0] != MAGIC:
+        raise SystemExit('not a packed .lts container')
+    keys = ['magic', 'version', 'header_size', 'latent_dim', 'frames', 'hop', 'flags', 'dtype', 'frame_stride', 'checksum']
+    return dict(zip(keys, fields))
+
+
+def unpack_frames(data):
+    header = read_header(data)
+    dim, frames, stride = header['latent_dim'], header['frames'], header['frame_stride']
+    records = np.frombuffer(data, dtype=np.uint8, offset=header['header_size'], count=frames * stride).reshape(frames, stride)
+    if header['dtype'] == DTYPES['float32']:
+        values = records[:, :8 * dim].copy().view('<f4')
+    elif header['dtype'] == DTYPES['float16']:
+        values = records[:, :4 * dim].copy().view('<f2').astype(np.float32)
+    else:
+        params = records[:, :16].copy().view('<f4')
+        q = records[:, 16:16 + 2 * dim].copy().view(np.int8).astype(np.float32)
+        values = np.concatenate([params[:, 1:2] + params[:, 0:1] * q[:, :dim], params[:, 3:4] + params[:, 2:3] * q[:, dim:]], axis=1)
+    return values[:, :dim], values[:, dim:]
+
+
+def info(args):
+    with open(args.packed, 'rb') as f:
+        data = f.read()
+    header = read_header(data)
+    payload = data[header['header_size']:header['header_size'] + header['frames'] * header['frame_stride']]
+    dtype = {v: k for k, v in DTYPES.items()}.get(header['dtype'], 'unknown')
+    valid = (zlib.crc32(payload) & 0xffffffff) == header['checksum']
+    print(f"version {header['version']}, {header['frames']} frames of {header['latent_dim']} values, {dtype}, "
+          f"hop {header['hop']}, {'windowed' if header['flags'] & FLAG_WINDOWED else 'not windowed'}, "
+          f"frame stride {header['frame_stride']} bytes, checksum {'ok' if valid else 'MISMATCH'}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest='command', required=True)
+    p = commands.add_parser('pack')
+    p.add_argument('mu')
+    p.add_argument('logvar')
+    p.add_argument('packed')
+    p.add_argument('--latent-dim', type=int, default=256)
+    p.add_argument('--hop', type=int, default=0, help='audio samples between consecutive frames, 0 if unknown')
+    p.add_argument('--windowed', action='store_true')
+    p.add_argument('--dtype', choices=DTYPES, default='float32')
+    i = commands.add_parser('info')
+    i.add_argument('packed')
+    args = parser.parse_args()
+    if args.command == 'pack':
+        pack(args)
+    else:
+        info(args)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,656 @@
+#!/usr/bin/env python3
+"""Compiles a small ONNX model with static shapes into a C++ translation unit, ahead of time.
+
+usage: onnx_to_cpp.py <model.onnx> [--name <ClassName>] [--out-dir <dir>] [--check] [--cxx c++]
+
+Writes <ClassName>.h and <ClassName>.cpp (default name: <Model>Generated, in the folder of the model) with a single entry point,
+  static void <ClassName>::run(const float *<input>, ..., float *<output>, ...);
+inputs and outputs in the order of the graph, as contiguous row-major arrays, and their sizes as <name>Size constants.
+LDSP builds every .cpp of a project folder, so the render only has to include the header.
+
+The graph is specialized for its exact shapes, e.g., as ED.onnx and topline.onnx:
+  - shapes and constant subgraphs are resolved once here, by running the model in ONNX Runtime with every tensor as an output,
+  - weights become static const arrays, laid out for the loops that read them, intermediate tensors static buffers,
+  - reshaping nodes (Squeeze, Unsqueeze, Reshape, Flatten, Identity) and contiguous Slices are pointer aliases and cost nothing,
+  - the bias Add and the activation that follow a Gemm, MatMul or Conv are fused into its loops, alpha and beta into its weights,
+  - all the loop bounds are constants, so the compiler unrolls and vectorizes them.
+Supported operators: Gemm, MatMul (constant B), Conv (1D), LSTM (forward, default activations), Add, Sub, Mul, Div,
+Sigmoid, Tanh, Relu, Slice, Concat, Transpose and the reshaping ones. Anything else is reported and nothing is written.
+Dynamic dimensions are fixed to 1. The generated run() is not reentrant, as the intermediate buffers are static.
+
+--check generates a test program that runs the generated code on random inputs and compares it with the outputs of ONNX Runtime,
+then builds it with --cxx and runs it, reporting the error and the time per run; the files are written only if it passes.
+"""
+import argparse
+import os
+import re
+import subprocess
+import tempfile
+import time
+
+import numpy as np
+import onnx
+import onnxruntime as ort
+from onnx import helper
+
+ALIAS_OPS = ('Squeeze', 'Unsqueeze', 'Reshape', 'Flatten', 'Identity')
+ACTIVATIONS = {
+    'Sigmoid': '1.0f/(1.0f + std::exp(-{}))',
+    'Tanh': 'std::tanh({})',
+    'Relu': 'std::max({}, 0.0f)',
+}
+BINARY_OPS = {'Add': '+', 'Sub': '-', 'Mul': '*', 'Div': '/'}
+CHECK_CASES = 8
+
+
+def literal(value):
+    value = float(value)
+    if not np.isfinite(value):
+        raise SystemExit('non-finite constant, not supported')
+    text = f'{np.float32(value):.9g}'
+    if '.' not in text and 'e' not in text:
+        text += '.0'
+    return text + 'f'
+
+
+def array_literal(values, per_line=8):
+    values = np.asarray(values, dtype=np.float32).ravel()
+    lines = [', '.join(literal(v) for v in values[i:i + per_line]) for i in range(0, len(values), per_line)]
+    return '{\n    ' + ',\n    '.join(lines) + '\n}'
+
+
+def identifier(name):
+    name = re.sub(r'\W', '_', name)
+    return name if not name[0].isdigit() else '_' + name
+
+
+def attributes(node):
+    return {a.name: helper.get_attribute_value(a) for a in node.attribute}
+
+
+def resolve_tensors(model):
+    """Runs the model once on random inputs with every tensor as an output, returns the values of all the tensors by name;
+    those of the constant tensors do not depend on the inputs, and all of them give the static shapes."""
+    for value in list(model.graph.input) + list(model.graph.output):
+        for dim in value.type.tensor_type.shape.dim:
+            if not dim.dim_value:
+                dim.dim_value = 1
+    exposed = onnx.ModelProto()
+    exposed.CopyFrom(model)
+    known = {o.name for o in exposed.graph.output}
+    for node in exposed.graph.node:
+        for name in node.output:
+            if name and name not in known:
+                exposed.graph.output.append(onnx.ValueInfoProto(name=name))
+                known.add(name)
+    options = ort.SessionOptions()
+    options.graph_optimization_level = ort.GraphOptimizationLevel.ORT_DISABLE_ALL
+    session = ort.InferenceSession(exposed.SerializeToString(), options, providers=['CPUExecutionProvider'])
+    rng = np.random.default_rng(0)
+    feeds = {i.name: rng.uniform(-1, 1, [d if isinstance(d, int) else 1 for d in i.shape]).astype(np.float32) for i in session.get_inputs()}
+    values = dict(zip([o.name for o in session.get_outputs()], session.run(None, feeds)))
+    values.update(feeds)
+    for initializer in model.graph.initializer:
+        values[initializer.name] = onnx.numpy_helper.to_array(initializer)
+    return values
+
+
+class Ref:
+    """Where a runtime tensor lives: a buffer (parameter or static array) and an offset in it."""
+    def __init__(self, buffer, offset=0):
+        self.buffer = buffer
+        self.offset = offset
+
+    def __str__(self):
+        return self.buffer if self.offset == 0 else f'({self.buffer} + {self.offset})'
+
+
+class Generator:
+    def __init__(self, model, name):
+        self.model = model
+        self.graph = model.graph
+        self.name = name
+        self.values = resolve_tensors(model)
+        self.inputs = [i.name for i in self.graph.input if i.name not in {t.name for t in self.graph.initializer}]
+        self.outputs = [o.name for o in self.graph.output]
+        self.consumers = {}
+        for node in self.graph.node:
+            for name in node.input:
+                self.consumers.setdefault(name, []).append(node)
+        self.producers = {out: node for node in self.graph.node for out in node.output}
+
+        # constants: initializers and every tensor computed from constants only
+        self.constants = {t.name for t in self.graph.initializer}
+        for node in self.graph.node:
+            if node.op_type == 'Shape' or all(not i or i in self.constants for i in node.input):
+                self.constants.update(o for o in node.output if o)
+
+        self.refs = {name: Ref(identifier(name)) for name in self.inputs}
+        self.designated = self.designate_outputs()
+        self.declarations = []
+        self.body = []
+        self.done = set()
+        self.count = 0
+
+    def shape(self, name):
+        return list(self.values[name].shape)
+
+    def size(self, name):
+        return int(np.prod(self.shape(name), dtype=np.int64))
+
+    def constant(self, name):
+        return self.values[name]
+
+    def is_graph_output(self, name):
+        return name in self.outputs
+
+    def designate_outputs(self):
+        """Computed tensors that are written straight into an output parameter, looking through the reshaping nodes."""
+        designated = {}
+        for output in self.outputs:
+            tensor = output
+            while tensor in self.producers and self.producers[tensor].op_type in ALIAS_OPS and self.producers[tensor].input[0] not in self.constants:
+                tensor = self.producers[tensor].input[0]
+            if tensor not in self.constants and tensor not in self.inputs and tensor not in designated:
+                designated[tensor] = identifier(output)
+        return designated
+
+    # buffers
+
+    def new_name(self, prefix):
+        self.count += 1
+        return f'{prefix}{self.count}'
+
+    def buffer(self, name):
+        """Ref of a tensor computed by the node being emitted."""
+        if name in self.designated:
+            ref = Ref(self.designated[name])
+        else:
+            buffer = self.new_name('t')
+            self.declarations.append(f'alignas(16) static float {buffer}[{max(self.size(name), 1)}]; // {name} {self.shape(name)}')
+            ref = Ref(buffer)
+        self.refs[name] = ref
+        return ref
+
+    def const_array(self, values, comment, dtype='float'):
+        buffer = self.new_name('c' if dtype == 'float' else 'g')
+        values = np.asarray(values).ravel()
+        if dtype == 'float':
+            self.declarations.append(f'alignas(16) static const float {buffer}[{len(values)}] = {array_literal(values)}; // {comment}')
+        else:
+            self.declarations.append(f'static const int {buffer}[{len(values)}] = {{{", ".join(str(int(v)) for v in values)}}}; // {comment}')
+        return buffer
+
+    def operand(self, name):
+        """Expression of an input of a compute node, constants become static arrays."""
+        if name in self.refs:
+            return str(self.refs[name])
+        if name in self.constants:
+            ref = Ref(self.const_array(self.constant(name), name))
+            self.refs[name] = ref
+            return str(ref)
+        raise SystemExit(f'tensor {name} used before being computed')
+
+    def emit(self, *lines):
+        self.body.extend(lines)
+
+    # fusion
+
+    def sole_consumer(self, name, op_types):
+        consumers = self.consumers.get(name, [])
+        if len(consumers) == 1 and consumers[0].op_type in op_types and not self.is_graph_output(name):
+            return consumers[0]
+        return None
+
+    def fuse_epilogue(self, node):
+        """Looks for an Add of a constant and an activation after node, which are then computed in its loops;
+        returns the constant to add (or None, broadcast to the output shape), the activation (or None) and the tensor to write."""
+        out = node.output[0]
+        bias, activation = None, None
+        add = self.sole_consumer(out, ('Add',))
+        if add is not None:
+            other = add.input[1] if add.input[0] == out else add.input[0]
+            if other in self.constants and self.shape(add.output[0]) == self.shape(out):
+                bias = np.broadcast_to(self.constant(other), self.shape(out)).astype(np.float32)
+                self.done.add(add.output[0])
+                out = add.output[0]
+        act = self.sole_consumer(out, ACTIVATIONS)
+        if act is not None:
+            activation = act.op_type
+            self.done.add(act.output[0])
+            out = act.output[0]
+        return bias, activation, out
+
+    # operators
+
+    def emit_dense(self, node, a_name, weights, bias, label):
+        """out[m, n] = act(sum_k a[m, k] W[k, n] + bias[m, n]), weights given as [K, N]."""
+        k_size, n_size = weights.shape
+        m_size = self.size(a_name) // k_size
+        fused_bias, activation, out = self.fuse_epilogue(node)
+        if fused_bias is not None:
+            fused_bias = fused_bias.reshape(m_size, n_size)
+            bias = fused_bias if bias is None else bias + fused_bias
+        out_ref = self.buffer(out)
+        a = self.operand(a_name)
+        w = self.const_array(weights, f'{label} weights [{k_size}, {n_size}]')
+        rows_equal = bias is not None and np.all(bias == bias[0:1])
+        b = self.const_array(bias[0] if rows_equal else bias, f'{label} bias') if bias is not None else None
+        fused = (['Add'] if fused_bias is not None else []) + ([activation] if activation else [])
+        self.emit(f'    // {label} [{m_size}, {k_size}] x [{k_size}, {n_size}]' + (f', fused {" and ".join(fused)}' if fused else ''))
+        indent = '    '
+        if m_size > 1:
+            self.emit(f'    for(int m=0; m<{m_size}; m++)', '    {')
+            indent = '        '
+            a_row, y, b_row = f'{a} + m*{k_size}', f'{out_ref} + m*{n_size}', (f'{b}' if rows_equal else f'{b} + m*{n_size}')
+        else:
+            a_row, y, b_row = a, str(out_ref), b
+        # local accumulators, which the compiler knows are not aliased by the input and output pointers
+        self.emit(f'{indent}{{',
+                  f'{indent}    const float *a = {a_row};',
+                  f'{indent}    float *y = {y};',
+                  f'{indent}    float acc[{n_size}];',
+                  f'{indent}    for(int n=0; n<{n_size}; n++)',
+                  f'{indent}        acc[n] = {b_row + "[n]" if b is not None else "0.0f"};',
+                  f'{indent}    for(int k=0; k<{k_size}; k++)',
+                  f'{indent}    {{',
+                  f'{indent}        const float ak = a[k];',
+                  f'{indent}        for(int n=0; n<{n_size}; n++)',
+                  f'{indent}            acc[n] += ak*{w}[k*{n_size} + n];',
+                  f'{indent}    }}',
+                  f'{indent}    for(int n=0; n<{n_size}; n++)',
+                  f'{indent}        y[n] = {ACTIVATIONS[activation].format("acc[n]") if activation else "acc[n]"};',
+                  f'{indent}}}')
+        if m_size > 1:
+            self.emit('    }')
+
+    def op_Gemm(self, node):
+        attrs = attributes(node)
+        if attrs.get('transA', 0) or node.input[1] not in self.constants:
+            raise SystemExit(f'Gemm {node.name}: only A x constant B is supported')
+        weights = self.constant(node.input[1]).astype(np.float32)
+        weights = (weights.T if attrs.get('transB', 0) else weights) * attrs.get('alpha', 1.0)
+        bias = None
+        if len(node.input) > 2 and node.input[2]:
+            if node.input[2] not in self.constants:
+                raise SystemExit(f'Gemm {node.name}: only a constant C is supported')
+            rows = self.size(node.input[0]) // weights.shape[0]
+            bias = np.broadcast_to(self.constant(node.input[2]), [rows, weights.shape[1]]).astype(np.float32) * attrs.get('beta', 1.0)
+        self.emit_dense(node, node.input[0], weights, bias, f'Gemm {node.name}')
+
+    def op_MatMul(self, node):
+        if node.input[1] not in self.constants or self.constant(node.input[1]).ndim != 2:
+            raise SystemExit(f'MatMul {node.name}: only A x constant 2D B is supported')
+        self.emit_dense(node, node.input[0], self.constant(node.input[1]).astype(np.float32), None, f'MatMul {node.name}')
+
+    def op_Conv(self, node):
+        attrs = attributes(node)
+        x_shape, w = self.shape(node.input[0]), self.constant(node.input[1]).astype(np.float32)
+        if len(x_shape) != 3 or attrs.get('group', 1) != 1 or node.input[1] not in self.constants:
+            raise SystemExit(f'Conv {node.name}: only 1D convolutions with constant weights and a single group are supported')
+        batch, channels, length = x_shape
+        out_channels, _, kernel = w.shape
+        stride, dilation = attrs.get('strides', [1])[0], attrs.get('dilations', [1])[0]
+        out_length = self.shape(node.output[0])[2]
+        auto_pad = attrs.get('auto_pad', b'NOTSET').decode()
+        if auto_pad in ('SAME_UPPER', 'SAME_LOWER'):
+            total = max((out_length - 1)*stride + (kernel - 1)*dilation + 1 - length, 0)
+            pad_begin = total//2 if auto_pad == 'SAME_UPPER' else total - total//2
+        else:
+            pad_begin = attrs.get('pads', [0, 0])[0] if auto_pad != 'VALID' else 0
+        padded_length = max(pad_begin + length, (out_length - 1)*stride + (kernel - 1)*dilation + 1)
+        bias = self.constant(node.input[2]).astype(np.float32) if len(node.input) > 2 and node.input[2] else None
+        fused_bias, activation, out = self.fuse_epilogue(node)
+        label = f'Conv {node.name}'
+
+        out_ref = self.buffer(out)
+        x = self.operand(node.input[0])
+        padded = self.new_name('p')
+        self.declarations.append(f'alignas(16) static float {padded}[{batch*channels*padded_length}] = {{0}}; // {label} zero-padded input, the padding is never written')
+        weights = self.const_array(w, f'{label} weights [{out_channels}, {channels}, {kernel}]')
+        initial = np.zeros([batch, out_channels, out_length], dtype=np.float32)
+        if bias is not None:
+            initial += bias.reshape(1, out_channels, 1)
+        if fused_bias is not None:
+            initial += fused_bias
+        start = self.const_array(initial, f'{label} bias') if np.any(initial) else None
+        self.emit(f'    // {label}, {channels} -> {out_channels} channels, kernel {kernel}, {length} -> {out_length} steps'
+                  + (f', fused {" and ".join((["Add"] if fused_bias is not None else []) + ([activation] if activation else []))}'
+                     if fused_bias is not None or activation else ''),
+                  '    {',
+                  f'        for(int c=0; c<{batch*channels}; c++)',
+                  f'            std::copy({x} + c*{length}, {x} + (c+1)*{length}, {padded} + c*{padded_length} + {pad_begin});',
+                  f'        float acc[{batch*out_channels*out_length}];',
+                  f'        for(int i=0; i<{batch*out_channels*out_length}; i++)',
+                  f'            acc[i] = {start + "[i]" if start else "0.0f"};',
+                  f'        for(int b=0; b<{batch}; b++)',
+                  f'        {{',
+                  f'            for(int o=0; o<{out_channels}; o++)',
+                  f'            {{',
+                  f'                for(int c=0; c<{channels}; c++)',
+                  f'                {{',
+                  f'                    for(int k=0; k<{kernel}; k++)',
+                  f'                    {{',
+                  f'                        const float w = {weights}[(o*{channels} + c)*{kernel} + k];',
+                  f'                        const float *x = {padded} + (b*{channels} + c)*{padded_length} + k*{dilation};',
+                  f'                        float *yo = acc + (b*{out_channels} + o)*{out_length};',
+                  f'                        for(int t=0; t<{out_length}; t++)',
+                  f'                            yo[t] += w*x[t*{stride}];',
+                  f'                    }}',
+                  f'                }}',
+                  f'            }}',
+                  f'        }}')
+        self.emit(f'        for(int i=0; i<{batch*out_channels*out_length}; i++)',
+                  f'            {out_ref}[i] = {ACTIVATIONS[activation].format("acc[i]") if activation else "acc[i]"};',
+                  '    }')
+
+    def op_LSTM(self, node):
+        attrs = attributes(node)
+        if attrs.get('direction', b'forward') != b'forward' or attrs.get('input_forget', 0) or 'clip' in attrs or attrs.get('layout', 0) \
+                or attrs.get('activations', [b'Sigmoid', b'Tanh', b'Tanh']) != [b'Sigmoid', b'Tanh', b'Tanh']:
+            raise SystemExit(f'LSTM {node.name}: only forward LSTMs with the default activations are supported')
+        inputs = list(node.input) + [''] * (8 - len(node.input))
+        if inputs[4] or inputs[7] or any(i and i not in self.constants for i in inputs[1:4]):
+            raise SystemExit(f'LSTM {node.name}: sequence lengths, peepholes and non-constant weights are not supported')
+        steps, batch, features = self.shape(inputs[0])
+        hidden = attrs['hidden_size']
+        w = self.constant(inputs[1]).astype(np.float32)[0]  # [4H, I], gates i, o, f, c
+        r = self.constant(inputs[2]).astype(np.float32)[0]  # [4H, H]
+        b = self.constant(inputs[3]).astype(np.float32)[0] if inputs[3] else np.zeros(8*hidden, dtype=np.float32)
+        label = f'LSTM {node.name}'
+
+        x = self.operand(inputs[0])
+        initial_h = self.operand(inputs[5]) if inputs[5] else None
+        initial_c = self.operand(inputs[6]) if inputs[6] else None
+        outputs = list(node.output) + [''] * (3 - len(node.output))
+        y = self.buffer(outputs[0]) if outputs[0] else None
+        y_h = self.buffer(outputs[1]) if outputs[1] else None
+        y_c = self.buffer(outputs[2]) if outputs[2] else None
+        wt = self.const_array(w.T, f'{label} input weights [{features}, {4*hidden}]')
+        rt = self.const_array(r.T, f'{label} recurrent weights [{hidden}, {4*hidden}]')
+        bias = self.const_array(b[:4*hidden] + b[4*hidden:], f'{label} input and recurrent biases, summed')
+        state_h, state_c, gates = self.new_name('h'), self.new_name('s'), 'gates'
+        self.declarations.append(f'alignas(16) static float {state_h}[{batch*hidden}]; // {label} hidden state')
+        self.declarations.append(f'alignas(16) static float {state_c}[{batch*hidden}]; // {label} cell state')
+        H = hidden
+        self.emit(f'    // {label}, {steps} steps of {batch}x{features} -> {hidden}',
+                  '    {',
+                  f'        for(int i=0; i<{batch*H}; i++)',
+                  '        {',
+                  f'            {state_h}[i] = {initial_h + "[i]" if initial_h else "0.0f"};',
+                  f'            {state_c}[i] = {initial_c + "[i]" if initial_c else "0.0f"};',
+                  '        }',
+                  f'        for(int t=0; t<{steps}; t++)',
+                  '        {',
+                  f'            for(int b=0; b<{batch}; b++)',
+                  '            {',
+                  f'                const float *x = {x} + (t*{batch} + b)*{features};',
+                  f'                float *h = {state_h} + b*{H};',
+                  f'                float *c = {state_c} + b*{H};',
+                  f'                float {gates}[{4*H}];',
+                  f'                for(int g=0; g<{4*H}; g++)',
+                  f'                    {gates}[g] = {bias}[g];',
+                  f'                for(int k=0; k<{features}; k++)',
+                  '                {',
+                  '                    const float xk = x[k];',
+                  f'                    for(int g=0; g<{4*H}; g++)',
+                  f'                        {gates}[g] += xk*{wt}[k*{4*H} + g];',
+                  '                }',
+                  f'                for(int k=0; k<{H}; k++)',
+                  '                {',
+                  '                    const float hk = h[k];',
+                  f'                    for(int g=0; g<{4*H}; g++)',
+                  f'                        {gates}[g] += hk*{rt}[k*{4*H} + g];',
+                  '                }',
+                  f'                for(int j=0; j<{H}; j++)',
+                  '                {',
+                  f'                    float i = 1.0f/(1.0f + std::exp(-{gates}[j]));',
+                  f'                    float o = 1.0f/(1.0f + std::exp(-{gates}[{H} + j]));',
+                  f'                    float f = 1.0f/(1.0f + std::exp(-{gates}[{2*H} + j]));',
+                  f'                    c[j] = f*c[j] + i*std::tanh({gates}[{3*H} + j]);',
+                  '                    h[j] = o*std::tanh(c[j]);',
+                  '                }')
+        if y is not None:
+            self.emit(f'                std::copy(h, h + {H}, {y} + (t*{batch} + b)*{H});')
+        self.emit('            }', '        }')
+        if y_h is not None:
+            self.emit(f'        std::copy({state_h}, {state_h} + {batch*H}, {y_h});')
+        if y_c is not None:
+            self.emit(f'        std::copy({state_c}, {state_c} + {batch*H}, {y_c});')
+        self.emit('    }')
+
+    def op_elementwise(self, node):
+        if node.op_type in ACTIVATIONS:
+            out = self.buffer(node.output[0])
+            x = self.operand(node.input[0])
+            self.emit(f'    // {node.op_type} {node.name}',
+                      f'    for(int i=0; i<{self.size(node.output[0])}; i++)',
+                      f'        {out}[i] = {ACTIVATIONS[node.op_type].format(f"{x}[i]")};')
+            return
+        out_shape = self.shape(node.output[0])
+        operands = []
+        for name in node.input[:2]:
+            shape = [1]*(len(out_shape) - len(self.shape(name))) + self.shape(name)
+            strides = np.cumprod([1] + shape[::-1][:-1])[::-1]
+            operands.append((self.operand(name), [0 if s == 1 and o != 1 else int(st) for s, o, st in zip(shape, out_shape, strides)], shape == out_shape))
+        out = self.buffer(node.output[0])
+        op = BINARY_OPS[node.op_type]
+        self.emit(f'    // {node.op_type} {node.name}')
+        if all(same for _, _, same in operands):
+            self.emit(f'    for(int i=0; i<{self.size(node.output[0])}; i++)',
+                      f'        {out}[i] = {operands[0][0]}[i] {op} {operands[1][0]}[i];')
+            return
+        # broadcasting, a loop per dimension with constant strides
+        indent = '    '
+        for d, size in enumerate(out_shape):
+            self.emit(f'{indent}for(int i{d}=0; i{d}<{size}; i{d}++)')
+            indent += '    '
+        out_strides = np.cumprod([1] + out_shape[::-1][:-1])[::-1]
+        index = lambda strides: ' + '.join(f'i{d}*{s}' for d, s in enumerate(strides) if s) or '0'
+        self.emit(f'{indent}{out}[{index(out_strides)}] = {operands[0][0]}[{index(operands[0][1])}] {op} {operands[1][0]}[{index(operands[1][1])}];')
+
+    @staticmethod
+    def is_range(index):
+        return len(index) > 0 and np.array_equal(index, np.arange(index[0], index[0] + len(index)))
+
+    def gather(self, out_name, parts, label):
+        """Data-independent copies, out[destination[i]] = source[index[i]] for each (source, index, destination) part;
+        a single contiguous part is an alias, contiguous parts are plain copies, the others go through index tables."""
+        parts = [(name, np.asarray(index).ravel(), np.asarray(destination).ravel()) for name, index, destination in parts]
+        if len(parts) == 1 and self.is_range(parts[0][1]) and parts[0][0] in self.refs and out_name not in self.designated:
+            source = self.refs[parts[0][0]]
+            self.refs[out_name] = Ref(source.buffer, source.offset + int(parts[0][1][0]))
+            return
+        out = self.buffer(out_name)
+        self.emit(f'    // {label}')
+        for name, index, destination in parts:
+            x = self.operand(name)
+            if self.is_range(index) and self.is_range(destination):
+                self.emit(f'    std::copy({x} + {index[0]}, {x} + {index[0] + len(index)}, {out} + {destination[0]});')
+                continue
+            source = f'{x}[{self.const_array(index, f"{label} source indices", "int")}[i]]'
+            if self.is_range(destination):
+                target = f'{out}[{destination[0]} + i]'
+            else:
+                target = f'{out}[{self.const_array(destination, f"{label} destination indices", "int")}[i]]'
+            self.emit(f'    for(int i=0; i<{len(index)}; i++)', f'        {target} = {source};')
+
+    def op_Slice(self, node):
+        starts, ends = self.constant(node.input[1]), self.constant(node.input[2])
+        shape = self.shape(node.input[0])
+        axes = self.constant(node.input[3]) if len(node.input) > 3 and node.input[3] else np.arange(len(starts))
+        steps = self.constant(node.input[4]) if len(node.input) > 4 and node.input[4] else np.ones(len(starts), dtype=np.int64)
+        slices = [slice(None)]*len(shape)
+        for start, end, axis, step in zip(starts, ends, axes, steps):
+            slices[int(axis)] = slice(int(start), int(max(min(end, 2**62), -2**62)), int(step))
+        index = np.arange(self.size(node.input[0])).reshape(shape)[tuple(slices)]
+        self.gather(node.output[0], [(node.input[0], index, np.arange(index.size))], f'Slice {node.name}')
+
+    def op_Transpose(self, node):
+        shape = self.shape(node.input[0])
+        perm = attributes(node).get('perm', list(range(len(shape)))[::-1])
+        index = np.arange(self.size(node.input[0])).reshape(shape).transpose(perm)
+        self.gather(node.output[0], [(node.input[0], index, np.arange(index.size))], f'Transpose {node.name}')
+
+    def op_Concat(self, node):
+        axis = attributes(node)['axis']
+        out_shape = self.shape(node.output[0])
+        positions = np.arange(int(np.prod(out_shape))).reshape(out_shape)
+        parts, offset = [], 0
+        for name in node.input:
+            shape = self.shape(name)
+            region = [slice(None)]*len(shape)
+            region[axis] = slice(offset, offset + shape[axis])
+            offset += shape[axis]
+            parts.append((name, np.arange(self.size(name)), positions[tuple(region)]))
+        self.gather(node.output[0], parts, f'Concat {node.name}')
+
+    def generate(self):
+        for node in self.graph.node:
+            if node.output[0] in self.done or all(o in self.constants for o in node.output if o):
+                continue
+            if node.op_type in ALIAS_OPS:
+                self.operand(node.input[0])
+                self.refs[node.output[0]] = self.refs[node.input[0]]
+            elif node.op_type in ACTIVATIONS or node.op_type in BINARY_OPS:
+                self.op_elementwise(node)
+            elif hasattr(self, 'op_' + node.op_type):
+                getattr(self, 'op_' + node.op_type)(node)
+            else:
+                raise SystemExit(f'{node.op_type} ({node.name}) is not supported')
+            for name in node.output:
+                if name and name in self.values and self.values[name].dtype != np.float32:
+                    raise SystemExit(f'{node.op_type} ({node.name}): only float tensors can be computed at run time')
+
+        # outputs not written in place, e.g., aliases of an input
+        for output in self.outputs:
+            param = identifier(output)
+            if output in self.constants:
+                values = self.const_array(self.constant(output), output)
+                self.emit(f'    std::copy({values}, {values} + {self.size(output)}, {param});')
+            elif str(self.refs[output]) != param:
+                self.emit(f'    std::copy({self.refs[output]}, {self.refs[output]} + {self.size(output)}, {param});')
+
+    def sizes(self):
+        return [(identifier(name), self.size(name), self.shape(name)) for name in self.inputs + self.outputs]
+
+    def header(self, source_name):
+        guard = re.sub(r'(?<=[a-z0-9])(?=[A-Z])|(?<=[A-Z])(?=[A-Z][a-z])', '_', self.name).upper() + '_H_'
+        params = ', '.join([f'const float *{identifier(n)}' for n in self.inputs] + [f'float *{identifier(n)}' for n in self.outputs])
+        lines = [f'#ifndef {guard}', f'#define {guard}', '',
+                 f'// {source_name} compiled ahead of time by tools/onnx_to_cpp.py, do not edit, regenerate it instead',
+                 '// inputs:  ' + ', '.join(f'{identifier(n)} {self.shape(n)}' for n in self.inputs),
+                 '// outputs: ' + ', '.join(f'{identifier(n)} {self.shape(n)}' for n in self.outputs),
+                 f'class {self.name}', '{', 'public:']
+        lines += [f'    static const int {name}Size = {size};' for name, size, _ in self.sizes()]
+        lines += ['',
+                  '    // not reentrant, the intermediate tensors are static buffers of the translation unit',
+                  f'    static void run({params});',
+                  '};', '', f'#endif /* {guard} */', '']
+        return '\n'.join(lines)
+
+    def source(self, source_name):
+        params = ', '.join([f'const float *{identifier(n)}' for n in self.inputs] + [f'float *{identifier(n)}' for n in self.outputs])
+        lines = [f'// {source_name} compiled ahead of time by tools/onnx_to_cpp.py, do not edit, regenerate it instead', '',
+                 f'#include "{self.name}.h"', '#include <algorithm>', '#include <cmath>', '']
+        lines += self.declarations
+        lines += ['', f'void {self.name}::run({params})', '{'] + self.body + ['}', '']
+        return '\n'.join(lines)
+
+
+def check_source(generator, cases, expected):
+    lines = [f'// check of {generator.name} against ONNX Runtime, generated by tools/onnx_to_cpp.py', '',
+             f'#include "{generator.name}.h"', '#include <chrono>', '#include <cmath>', '#include <cstdio>', '']
+    for name in generator.inputs:
+        lines.append(f'static const float input_{identifier(name)}[{CHECK_CASES}][{generator.size(name)}] = {array_literal(cases[name])};')
+    for name in generator.outputs:
+        lines.append(f'static const float expected_{identifier(name)}[{CHECK_CASES}][{generator.size(name)}] = {array_literal(expected[name])};')
+        lines.append(f'static float output_{identifier(name)}[{generator.size(name)}];')
+    args = ', '.join([f'input_{identifier(n)}[c]' for n in generator.inputs] + [f'output_{identifier(n)}' for n in generator.outputs])
+    lines += ['', 'int main()', '{', '    double maxError = 0;', '    double maxValue = 0;',
+              f'    for(int c=0; c<{CHECK_CASES}; c++)', '    {', f'        {generator.name}::run({args});']
+    for name in generator.outputs:
+        n = identifier(name)
+        lines += [f'        for(int i=0; i<{generator.size(name)}; i++)', '        {',
+                  f'            maxError = std::fmax(maxError, std::fabs(output_{n}[i] - expected_{n}[c][i]));',
+                  f'            maxValue = std::fmax(maxValue, std::fabs(expected_{n}[c][i]));', '        }']
+    lines += ['    }', '', '    const int runs = 100000;', '    auto start = std::chrono::steady_clock::now();',
+              '    for(int r=0; r<runs; r++)', '    {', f'        const int c = r % {CHECK_CASES};', f'        {generator.name}::run({args});', '    }',
+              '    double time_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count()/runs;',
+              f'    printf("%g %g %g\\n", maxError, maxValue, time_ns);', '    return 0;', '}', '']
+    return '\n'.join(lines)
+
+
+def check(generator, model, header, source, cxx, tolerance):
+    rng = np.random.default_rng(1)
+    session = ort.InferenceSession(model.SerializeToString(), providers=['CPUExecutionProvider'])
+    cases = {name: rng.uniform(-1, 1, [CHECK_CASES] + generator.shape(name)).astype(np.float32) for name in generator.inputs}
+    expected = {name: [] for name in generator.outputs}
+    for c in range(CHECK_CASES):
+        results = session.run(generator.outputs, {name: cases[name][c] for name in generator.inputs})
+        for name, result in zip(generator.outputs, results):
+            expected[name].append(result)
+    expected = {name: np.stack(values) for name, values in expected.items()}
+
+    with tempfile.TemporaryDirectory() as tmp:
+        for name, text in ((f'{generator.name}.h', header), (f'{generator.name}.cpp', source), ('check.cpp', check_source(generator, cases, expected))):
+            with open(os.path.join(tmp, name), 'w') as f:
+                f.write(text)
+        executable = os.path.join(tmp, 'check')
+        build = [cxx, '-O2', '-std=c++17', '-o', executable, os.path.join(tmp, 'check.cpp'), os.path.join(tmp, f'{generator.name}.cpp')]
+        result = subprocess.run(build, capture_output=True, text=True)
+        if result.returncode:
+            raise SystemExit(f'check: the generated code does not build:\n{result.stderr}')
+        max_error, max_value, time_ns = map(float, subprocess.run([executable], capture_output=True, text=True, check=True).stdout.split())
+
+    # time of a single run in ONNX Runtime, single-threaded as in common/OrtModelRT.h, including the Python call
+    options = ort.SessionOptions()
+    options.intra_op_num_threads = 1
+    options.inter_op_num_threads = 1
+    session = ort.InferenceSession(model.SerializeToString(), options, providers=['CPUExecutionProvider'])
+    feeds = {name: cases[name][0] for name in generator.inputs}
+    for _ in range(100):
+        session.run(None, feeds)
+    runs = 2000
+    start = time.perf_counter()
+    for _ in range(runs):
+        session.run(None, feeds)
+    ort_ns = (time.perf_counter() - start) / runs * 1e9
+
+    print(f'check: max abs error {max_error:.3g} (outputs up to {max_value:.3g}) over {CHECK_CASES} random cases')
+    print(f'check: generated {time_ns:.1f} ns per run, ONNX Runtime {ort_ns:.0f} ns per run from Python')
+    if max_error > tolerance:
+        raise SystemExit(f'check failed, tolerance {tolerance}, nothing written')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('model')
+    parser.add_argument('--name', help='class and file name (default: <Model>Generated)')
+    parser.add_argument('--out-dir', help='default: the folder of the model')
+    parser.add_argument('--check', action='store_true', help='build and run the generated test against ONNX Runtime before writing')
+    parser.add_argument('--cxx', default=os.environ.get('CXX', 'c++'), help='compiler for --check')
+    parser.add_argument('--tolerance', type=float, default=1e-4, help='max abs error of --check')
+    args = parser.parse_args()
+
+    stem = os.path.splitext(os.path.basename(args.model))[0]
+    name = args.name or stem[0].upper() + stem[1:] + 'Generated'
+    out_dir = args.out_dir or os.path.dirname(os.path.abspath(args.model))
+    model = onnx.load(args.model)
+
+    generator = Generator(model, name)
+    generator.generate()
+    header = generator.header(os.path.basename(args.model))
+    source = generator.source(os.path.basename(args.model))
+    if args.check:
+        check(generator, model, header, source, args.cxx, args.tolerance)
+
+    for file_name, text in ((f'{name}.h', header), (f'{name}.cpp', source)):
+        with open(os.path.join(out_dir, file_name), 'w') as f:
+            f.write(text)
+    print(f'wrote {os.path.join(out_dir, name)}.h/.cpp: {len(generator.declarations)} static arrays, '
+          f'{len(generator.body)} lines of run()')
+
+
+if __name__ == '__main__':
+    main()
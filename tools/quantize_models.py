@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""Quantizes a project model to int8 and qualifies it against the float model before saving it.
+
+usage: quantize_models.py <source.onnx> [<destination.onnx>] [--mode dynamic|static] [--signal file.wav] [--seconds 1]
+                          [--driver name] [--min-snr 30] [--min-speedup 1] [--force]
+
+The destination defaults to <source>_int8.onnx, which the renders load when their quantizedModel flag is set.
+  dynamic  int8 weights, activations quantized on the fly at every run, no calibration needed.
+  static   int8 weights and activations (QDQ), with activation ranges calibrated on a separate calibration signal.
+The test signal is the white noise of the host runner (host/main.cpp) unless a WAV file is given, e.g., one of the LTS sounds;
+it drives the model as the render that loads the quantized model does (call shapes, windows, hops, recurrent state, conditioning),
+see DRIVERS, which are picked by model name, or with --driver when a render calls the same model in another way,
+e.g., GuitarLSTM is called once per sample as in GuitarLSTM_Timing, GuitarLSTM_block times the blockInference of GuitarLSTM_Test.
+The static calibration never sees the scored signal: it is white noise of another seed, or the --seconds of the WAV file
+that follow the scored ones, so the qualification is measured on held-out input.
+Qualification runs the float and the quantized model side by side on the same calls and reports the error of the quantized output
+(SNR and error-to-signal ratio, ESR) and the speedup, with single-threaded sessions as in common/OrtModelRT.h.
+The model is saved only if it reaches --min-snr and --min-speedup, unless --force is given.
+"""
+import argparse
+import os
+import tempfile
+import time
+import wave
+
+import numpy as np
+import onnx
+import onnxruntime as ort
+from onnxruntime.quantization import CalibrationDataReader, QuantFormat, QuantType, quantize_dynamic, quantize_static
+from onnxruntime.quantization.shape_inference import quant_pre_process
+
+BLOCK = 256  # frames per call of the block models, as a host runner period
+
+
+def white_noise(seconds, rate=48000, seed=1234):
+    """Same distribution as the default input of host/main.cpp, which uses the default seed."""
+    return np.random.default_rng(seed).uniform(-0.5, 0.5, int(seconds*rate)).astype(np.float32)
+
+
+def read_wav(path, seconds, offset=0):
+    with wave.open(path, 'rb') as f:
+        width, channels, rate = f.getsampwidth(), f.getnchannels(), f.getframerate()
+        f.setpos(min(f.getnframes(), int(offset*rate)))
+        frames = f.readframes(min(f.getnframes() - f.tell(), int(seconds*rate)))
+    if width == 2:
+        samples = np.frombuffer(frames, dtype='<i2') / 32768.0
+    elif width == 4:
+        samples = np.frombuffer(frames, dtype='<i4') / 2147483648.0
+    else:
+        raise SystemExit(f'{path}: only 16 and 32-bit PCM are supported')
+    return samples[::channels].astype(np.float32)  # first channel, as loadMono()
+
+
+def windows(signal, length, hop):
+    """Sliding windows over the signal, starting with length-hop zeros as the renders' ring buffers do."""
+    padded = np.concatenate([np.zeros(length - hop, dtype=np.float32), signal])
+    count = (len(padded) - length) // hop + 1
+    return np.stack([padded[i*hop:i*hop + length] for i in range(count)])
+
+
+def blocks(signal, size):
+    count = len(signal) // size
+    return signal[:count*size].reshape(count, size)
+
+
+# a driver turns the test signal into the calls a render makes: (feeds of each call, recurrent states as (input, output) pairs)
+
+def drive_per_sample(model, signal, rng):
+    name = model.graph.input[0].name
+    return [{name: np.array([[x]], dtype=np.float32)} for x in signal], []
+
+
+def drive_block(model, signal, rng):
+    name = model.graph.input[0].name
+    return [{name: b.reshape(-1, 1)} for b in blocks(signal, BLOCK)], []
+
+
+def drive_topline(model, signal, rng):
+    name = model.graph.input[0].name
+    return [{name: w[None, :]} for w in windows(signal, 16, 16)], []
+
+
+def drive_ed(model, signal, rng):
+    cond = rng.uniform(0, 1, [1, 3]).astype(np.float32)
+    return [{'samples': w[None, :], 'cond': cond} for w in windows(signal, 32, 16)], []
+
+
+def drive_guitarlstm(model, signal, rng):
+    """One [1, 5, 1] window per sample, as GuitarLSTM_Timing."""
+    name = model.graph.input[0].name
+    return [{name: w.reshape(1, 5, 1)} for w in windows(signal, 5, 1)], []
+
+
+def drive_guitarlstm_block(model, signal, rng):
+    """The windows of a whole period in one [BLOCK, 5, 1] call, as the blockInference of GuitarLSTM_Test."""
+    name = model.graph.input[0].name
+    return [{name: b.reshape(-1, 5, 1)} for b in np.split(windows(signal, 5, 1)[:len(signal)//BLOCK*BLOCK], len(signal)//BLOCK)], []
+
+
+def drive_autoguitaramp_block(model, signal, rng):
+    return [{'samples': np.stack([b, np.full_like(b, 0.5)], axis=1)} for b in blocks(signal, BLOCK)], [('state_h_in', 'state_h_out'), ('state_c_in', 'state_c_out')]
+
+
+def drive_rawvae(model, signal, rng):
+    """LTS models: audio segments for the inputs as long as the output, latent frames for the others, then the interpolation."""
+    segment = model.graph.output[0].type.tensor_type.shape.dim[-1].dim_value
+    segments = blocks(signal, segment)
+    calls = []
+    for s in segments:
+        feeds = {}
+        for i, tensor in enumerate(model.graph.input):
+            shape = [d.dim_value if d.dim_value > 0 else 1 for d in tensor.type.tensor_type.shape.dim]
+            if i == len(model.graph.input) - 1 and int(np.prod(shape)) == 1:
+                feeds[tensor.name] = np.full(shape, 0.5, dtype=np.float32)
+            elif shape[-1] == segment:
+                feeds[tensor.name] = s.reshape(shape)
+            else:
+                feeds[tensor.name] = rng.normal(0, 1, shape).astype(np.float32)
+        calls.append(feeds)
+    return calls, []
+
+
+DRIVERS = {
+    'baseline': drive_per_sample,
+    'baseline_block': drive_block,
+    'topline': drive_topline,
+    'ED': drive_ed,
+    'GuitarLSTM': drive_guitarlstm,
+    'GuitarLSTM_block': drive_guitarlstm_block,
+    'AutoGuitarAmp_block': drive_autoguitaramp_block,
+    'rawvae': drive_rawvae,
+}
+
+
+def find_driver(path, name=None):
+    if name:
+        if name not in DRIVERS:
+            raise SystemExit(f'unknown driver {name}, known drivers: {", ".join(DRIVERS)}')
+        return DRIVERS[name]
+    stem = os.path.splitext(os.path.basename(path))[0]
+    if stem == 'AutoGuitarAmp':
+        raise SystemExit('AutoGuitarAmp.onnx cannot run as exported, quantize AutoGuitarAmp_block.onnx instead (see make_model_variants.py)')
+    if 'rawvae' in stem:
+        return DRIVERS['rawvae']
+    if stem not in DRIVERS:
+        raise SystemExit(f'no driver for {stem}, known models: {", ".join(DRIVERS)}')
+    return DRIVERS[stem]
+
+
+def make_session(model_bytes):
+    options = ort.SessionOptions()
+    options.intra_op_num_threads = 1
+    options.inter_op_num_threads = 1
+    options.execution_mode = ort.ExecutionMode.ORT_SEQUENTIAL
+    options.add_session_config_entry('session.intra_op.allow_spinning', '0')
+    return ort.InferenceSession(model_bytes, options, providers=['CPUExecutionProvider'])
+
+
+def run(session, calls, states):
+    """Runs the calls in order carrying the states, returns the first output of every call, the feeds as run and the mean time per call."""
+    inputs = {i.name: i for i in session.get_inputs()}
+    state = {name: np.zeros([d if isinstance(d, int) else 1 for d in inputs[name].shape], dtype=np.float32) for name, _ in states}
+    output_names = [o.name for o in session.get_outputs()]
+    outputs, fed, elapsed = [], [], 0.0
+    for feeds in calls:
+        feeds = dict(feeds, **state)
+        start = time.perf_counter()
+        results = session.run(None, feeds)
+        elapsed += time.perf_counter() - start
+        results = dict(zip(output_names, results))
+        state = {name: results[out] for name, out in states}
+        outputs.append(results[output_names[0]].ravel())
+        fed.append(feeds)
+    return np.concatenate(outputs), fed, elapsed / len(calls)
+
+
+class FeedReader(CalibrationDataReader):
+    def __init__(self, feeds, max_calls=1024):
+        step = max(1, len(feeds) // max_calls)
+        self.feeds = iter(feeds[::step])
+
+    def get_next(self):
+        return next(self.feeds, None)
+
+
+def test_signals(args):
+    """The signal that is scored and the one the static calibration runs on, which do not overlap."""
+    if args.signal:
+        signal = read_wav(args.signal, args.seconds)
+        calibration = read_wav(args.signal, args.seconds, offset=args.seconds)
+        if args.mode == 'static' and len(calibration) == 0:
+            raise SystemExit(f'{args.signal} is not longer than --seconds, no held-out part is left to calibrate on')
+        return signal, calibration
+    return white_noise(args.seconds), white_noise(args.seconds, seed=4321)
+
+
+def quantize(source, mode, feeds):
+    with tempfile.TemporaryDirectory() as tmp:
+        destination = os.path.join(tmp, 'quantized.onnx')
+        if mode == 'dynamic':
+            quantize_dynamic(source, destination, weight_type=QuantType.QInt8)
+        else:
+            prepared = os.path.join(tmp, 'prepared.onnx')
+            quant_pre_process(source, prepared, skip_symbolic_shape=True)
+            quantize_static(prepared, destination, FeedReader(feeds), quant_format=QuantFormat.QDQ,
+                            activation_type=QuantType.QInt8, weight_type=QuantType.QInt8, per_channel=True)
+        return onnx.load(destination)
+
+
+def qualify(reference, quantized):
+    error = quantized - reference
+    signal_energy = np.sum(reference**2)
+    error_energy = np.sum(error**2)
+    esr = error_energy / max(signal_energy, 1e-20)
+    snr = 10*np.log10(max(signal_energy, 1e-20) / max(error_energy, 1e-20))
+    return snr, esr
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('source')
+    parser.add_argument('destination', nargs='?')
+    parser.add_argument('--mode', choices=('dynamic', 'static'), default='dynamic')
+    parser.add_argument('--signal', help='WAV file, first channel (default: white noise of the host runner)')
+    parser.add_argument('--seconds', type=float, default=1, help='length of the test signal, and of the calibration signal')
+    parser.add_argument('--driver', help=f'how the render calls the model, instead of the one picked by name: {", ".join(DRIVERS)}')
+    parser.add_argument('--min-snr', type=float, default=30, help='dB')
+    parser.add_argument('--min-speedup', type=float, default=1)
+    parser.add_argument('--force', action='store_true', help='save even if not qualified')
+    args = parser.parse_args()
+    destination = args.destination or os.path.splitext(args.source)[0] + '_int8.onnx'
+
+    model = onnx.load(args.source)
+    signal, calibration_signal = test_signals(args)
+    driver = find_driver(args.source, args.driver)
+    calls, states = driver(model, signal, np.random.default_rng(0))
+
+    float_session = make_session(model.SerializeToString())
+    reference, _, float_time = run(float_session, calls, states)
+    calibration_feeds = None
+    if args.mode == 'static':
+        # the calibration calls are run through the float model too, so that they carry the recurrent states it produces
+        calibration_calls, _ = driver(model, calibration_signal, np.random.default_rng(1))
+        _, calibration_feeds, _ = run(float_session, calibration_calls, states)
+    quantized_model = quantize(args.source, args.mode, calibration_feeds)
+    output, _, int8_time = run(make_session(quantized_model.SerializeToString()), calls, states)
+
+    snr, esr = qualify(reference, output)
+    speedup = float_time / int8_time
+    size = os.path.getsize(args.source), len(quantized_model.SerializeToString())
+    print(f'{os.path.basename(args.source)}, {args.mode} int8, {len(calls)} calls:')
+    print(f'  SNR {snr:.1f} dB, ESR {esr:.2e}')
+    print(f'  float {float_time*1e6:.1f} us, int8 {int8_time*1e6:.1f} us per call, speedup {speedup:.2f}x')
+    print(f'  size {size[0]} -> {size[1]} bytes')
+
+    approved = snr >= args.min_snr and speedup >= args.min_speedup
+    if not approved and not args.force:
+        raise SystemExit(f'not qualified (min SNR {args.min_snr} dB, min speedup {args.min_speedup}x), not saved')
+    onnx.save(quantized_model, destination)
+    print(f'{"qualified" if approved else "not qualified, forced"}, saved {destination}')
+
+
+if __name__ == '__main__':
+    main()
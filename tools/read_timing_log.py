@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+"""Reads the binary timing logs written by common/TimingLogWriter.h.
+
+usage: read_timing_log.py <log.tlog> [--txt out.txt]
+
+Prints the header and summary statistics; --txt also dumps the records one per line, in nanoseconds.
+"""
+import argparse
+import struct
+import sys
+
+import numpy as np
+
+HEADER_FORMAT = '<8sII64sIIIII12x'
+CLOCK_SOURCES = {1: 'steady_clock'}
+
+
+def read_timing_log(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    header_size = struct.calcsize(HEADER_FORMAT)
+    magic, version, size, model, rate, period, output_size, clock, record_bytes = struct.unpack_from(HEADER_FORMAT, data)
+    if magic != b'LDSPTLOG' or size != header_size or record_bytes != 4:
+        sys.exit(f'{path} is not a version {version} timing log')
+    header = {
+        'version': version,
+        'model': model.split(b'\0')[0].decode(),
+        'sampleRate': rate,
+        'periodFrames': period,
+        'outputSize': output_size,
+        'clockSource': CLOCK_SOURCES.get(clock, clock),
+    }
+    records = np.frombuffer(data, dtype='<u4', offset=size)
+    return header, records
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('log')
+    parser.add_argument('--txt', help='dump records as text, one per line')
+    args = parser.parse_args()
+
+    header, records = read_timing_log(args.log)
+    print(header)
+    if len(records):
+        percentiles = np.percentile(records, [50, 90, 99, 99.9])
+        print(f'{len(records)} records [ns] min {records.min()} | p50 {percentiles[0]:.0f} | p90 {percentiles[1]:.0f} | '
+              f'p99 {percentiles[2]:.0f} | p99.9 {percentiles[3]:.0f} | max {records.max()} | '
+              f'mean {records.mean():.1f} | jitter {records.std():.1f}')
+    if args.txt:
+        np.savetxt(args.txt, records, fmt='%d')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,1373 @@
+// topline.onnx compiled ahead of time by tools/onnx_to_cpp.py, do not edit, regenerate it instead
+
+#include "ToplineGenerated.h"
+#include <algorithm>
+#include <cmath>
+
+alignas(16) static float t1[320]; // /denseIn/Gemm_output_0 [1, 320]
+alignas(16) static const float c2[5120] = {
+    -0.228721797f, -0.0316919386f, 0.0280685425f, -0.0293529928f, 0.132921726f, -0.0750731826f, -0.199201941f, 0.108589441f,
+    0.186011255f, -0.161725909f, 0.0308866799f, -0.146279007f, -0.0614072084f, 0.170014083f, -0.11499238f, 0.0773529112f,
+    0.0454351902f, -0.174481004f, -0.00239568949f, 0.219628572f, -0.0917383134f, 0.108451217f, 0.0210294425f, 0.177507937f,
+    0.000823616982f, 0.147550136f, -0.0886428058f, 0.248947114f, 0.103604019f, -0.0180091858f, 0.15484938f, -0.214260131f,
+    -0.109690815f, -0.0948876441f, -0.133753359f, 0.0562789142f, -0.158316761f, 0.195125759f, 0.134307653f, 0.164163023f,
+    -0.00282913446f, 0.141710013f, -0.0281651616f, 0.136609644f, 0.0433434844f, -0.0707342327f, -0.129585892f, -0.208887368f,
+    -0.118521273f, 0.138044059f, 0.0152381063f, 0.116843253f, 0.238884628f, -0.227059394f, 0.00922840834f, -0.0809092224f,
+    -0.0611424148f, 0.0293781459f, -0.100129455f, -0.133399576f, 0.0906874835f, -0.200976133f, 0.148164481f, 0.127051264f,
+    -0.161355048f, 0.148259103f, 0.101371199f, -0.04580158f, -0.0680209696f, -0.161107332f, -0.193778783f, -0.225080729f,
+    0.0412961543f, 0.0226341486f, 0.167033881f, 0.070150435f, 0.156743199f, 0.146348625f, -0.130471945f, 0.241503417f,
+    0.0153364241f, 0.103965223f, -0.241563857f, 0.0461854935f, -0.193277657f, 0.0533340573f, -0.0198755562f, -0.0800044537f,
+    -0.17418927f, -0.112070858f, -0.167635679f, 0.193883985f, -0.0883803368f, 0.136368632f, 0.0571113229f, 0.234541327f,
+    -0.0433513522f, 0.0530640185f, 0.0630092621f, 0.0983550549f, 0.0282034576f, 0.15308103f, -0.0370125771f, 0.21781677f,
+    0.0982747674f, -0.133285731f, -0.191604137f, 0.248213291f, 0.121867925f, -0.12027359f, -0.156411767f, -0.0987214148f,
+    0.0403641462f, 0.173019171f, 0.0241906643f, 0.224332631f, 0.105544299f, -0.176064819f, 0.227209061f, -0.219215751f,
+    -0.102883309f, -0.0180812776f, -0.163990557f, -0.181179345f, -0.1498954f, 0.0117140412f, -0.211336285f, -0.2181952f,
+    -0.157724917f, 0.223624647f, 0.0822962821f, -0.0362336338f, 0.145392776f, 0.0852780342f, 0.111561209f, -0.127740771f,
+    -0.0962899923f, 0.167108774f, 0.106681079f, -0.184452176f, -0.157233179f, -0.206863403f, 0.16062957f, 0.133013636f,
+    0.121082932f, -0.217482418f, -0.113815129f, 0.109891325f, 0.103982091f, -0.0118913651f, 0.202689528f, 0.183923841f,
+    -0.106318921f, 0.0369553566f, -0.20271197f, -0.0920460522f, -0.109289885f, -0.13132444f, -0.0147776008f, 0.158608586f,
+    0.0683245361f, -0.227894306f, -0.0908764005f, 0.14426133f, -0.186988592f, -0.0135382116f, -0.215979874f, -0.0579974353f,
+    0.0225673318f, -0.131977111f, 0.12236461f, 0.163527131f, -0.203185529f, -0.139796168f, 0.0876098871f, -0.0528972447f,
+    0.112127662f, -0.0620017648f, -0.139249951f, -0.037124157f, -0.0710446537f, 0.117615879f, -0.10375604f, 0.229070961f,
+    -0.119648367f, -0.136589259f, 0.232001007f, 0.0131200254f, -0.0883260369f, 0.045922488f, -0.0556713641f, 0.020406723f,
+    -0.199232548f, 0.142301232f, -0.00402468443f, -0.141773731f, -0.191795528f, 0.198614687f, -0.0868040919f, -0.00821536779f,
+    0.205055356f, 0.219381362f, -0.006270051f, 0.17456165f, 0.00339847803f, 0.11523816f, 0.146922588f, -0.132459998f,
+    0.181397498f, 0.214274049f, -0.0851642787f, -0.109860003f, 0.0270189047f, 0.0175747275f, -0.186709583f, -0.179798216f,
+    -0.113809526f, -0.10499233f, 0.0682935715f, 0.194574416f, 0.158255577f, 0.225355923f, -0.167904764f, -0.0296651125f,
+    -0.240493268f, 0.0695055425f, 0.0538658798f, 0.236752391f, -0.171138972f, 0.0382015407f, 0.159686148f, 0.0785529912f,
+    -0.18868196f, 0.172401935f, 0.223549217f, 0.194595724f, -0.114385545f, 0.188682199f, -0.0965175927f, -0.044927001f,
+    0.0884405375f, 0.0909976959f, -0.184787333f, -0.168940276f, -0.157579124f, 0.0477600098f, 0.00134554505f, 0.037227422f,
+    0.0142425895f, 0.151318967f, -0.0651528239f, 0.164135486f, 0.221350372f, -0.220151305f, -0.0407010317f, 0.125074387f,
+    0.19546631f, 0.222412527f, 0.22106865f, -0.138227969f, 0.18908149f, -0.0261287391f, 0.142648488f, 0.121840268f,
+    0.04571262f, 0.0810373724f, -0.0597318709f, 0.0361437798f, -0.138665169f, 0.09854877f, 0.210507691f, 0.0576746762f,
+    0.231658667f, -0.140131116f, -0.13557449f, -0.189730644f, 0.00317156315f, 0.198856324f, 0.152034342f, 0.0291262567f,
+    -0.196090549f, 0.0259259641f, 0.128507137f, -0.104474992f, -0.167912185f, 0.111458629f, -0.0475925207f, -0.207757115f,
+    -0.217004627f, -0.0267046094f, 0.214568734f, -0.0330885649f, -0.0990941823f, 0.229991704f, -0.163460463f, -0.18481639f,
+    0.224696815f, -0.237909973f, 0.154585898f, 0.0770600438f, 0.125368774f, -0.202758044f, 0.162251264f, 0.207271785f,
+    0.104127079f, 0.220491886f, -0.1696859f, -0.195197076f, -0.202201992f, -0.0378238559f, 0.0257375538f, -0.173064679f,
+    0.0481198132f, 0.033729732f, 0.17649287f, -0.223894417f, -0.0982003212f, 0.0995298326f, -0.179791957f, -0.186012566f,
+    -0.00683864951f, -0.138573796f, 0.140716374f, -0.150574327f, -0.0776993632f, 0.136602998f, 0.186876535f, 0.115816861f,
+    0.0189604163f, 0.208751917f, 0.238575757f, 0.128211528f, -0.197523981f, 0.0701870024f, -0.154056042f, 0.190051675f,
+    -0.0368695259f, -0.141104609f, 0.103446722f, -0.170885265f, 0.237861007f, -0.134078592f, -0.133375674f, 0.063080579f,
+    0.0440886617f, 0.106390148f, 0.0233945549f, 0.0482438207f, -0.205964953f, -0.0609349608f, 0.199410498f, 0.202095628f,
+    0.23831743f, -0.176619709f, 0.0102658868f, -0.111022651f, 0.16235593f, -0.164890081f, 0.209687173f, 0.0418636501f,
+    -0.241617292f, -0.144107938f, 0.224547863f, -0.0317538977f, 0.0857866406f, 0.0300335586f, -0.107474387f, 0.131796807f,
+    -0.112076402f, 0.219068855f, 0.16127786f, -0.029859066f, 0.077974081f, -0.13281396f, 0.184624165f, 0.212067693f,
+    0.0272301137f, -0.10097155f, 0.247373343f, -0.0727994144f, 0.0583342016f, 0.0421087742f, 0.0482141376f, 0.00943112373f,
+    -0.146693945f, 0.105365664f, -0.219605446f, -0.0153042078f, -0.0345765352f, 0.0676198602f, 0.0486815572f, -0.14299345f,
+    -0.131162494f, -0.221315593f, -0.165893108f, 0.0520673394f, 0.0833711326f, -0.0669358671f, -0.0963073969f, -0.0357107222f,
+    -0.202549398f, 0.248771578f, 0.189946562f, -0.0894862413f, 0.1564143f, -0.12875405f, 0.130574048f, 0.0234391987f,
+    -0.00366806984f, -0.0700447261f, 0.0672711134f, -0.174961627f, 0.105229795f, 0.103389293f, -0.0589811206f, 0.139138967f,
+    -0.246885657f, 0.0709472895f, -0.0456880629f, 0.0596689582f, -0.075334996f, -0.0660558045f, -0.0917716026f, -0.155007631f,
+    0.0984795988f, -0.0180466473f, -0.192587644f, -0.189977616f, -0.118390381f, 0.241650462f, 0.150144398f, -0.188543648f,
+    -0.159025222f, 0.117522925f, 0.210790604f, -0.232166946f, -0.0821846426f, 0.0489302278f, 0.00228464603f, -0.0537577569f,
+    -0.0930958986f, -0.0692091882f, 0.137430221f, -0.124594718f, -0.100495636f, -0.0244395435f, 0.0713618696f, -0.193241179f,
+    -0.132579029f, 0.191890538f, -0.16312471f, 0.070052743f, -0.147749811f, -0.00828045607f, 0.135405213f, -0.0143709779f,
+    0.241899073f, -0.140418798f, 0.138542354f, -0.0638960898f, -0.208096772f, -0.171781659f, -0.157566935f, 0.0583737195f,
+    -0.238819659f, -0.160473078f, 0.240920633f, -0.153753012f, -0.0858109593f, -0.107890904f, -0.22854501f, 0.244888604f,
+    0.0233096778f, -0.199025452f, 0.113065422f, 0.173537225f, 0.0259903967f, -0.0911242664f, -0.0483543575f, 0.0310985148f,
+    0.190316021f, 0.163705289f, -0.206205785f, -0.0943256319f, 0.114565283f, -0.0983656943f, -0.13934198f, -0.00682505965f,
+    0.0301583409f, -0.122522563f, -0.14123553f, 0.241809726f, 0.0237852931f, -0.128163874f, -0.060076952f, 0.0335847437f,
+    0.0752908289f, 0.0257091224f, 0.059084475f, 0.161087036f, -0.0518515706f, 0.084506005f, 0.11245355f, -0.149041802f,
+    0.0845604539f, -0.201432526f, -0.1783925f, 0.0710022748f, 0.16825369f, -0.0373524725f, -0.165765584f, -0.247132272f,
+    0.159414709f, -0.0242238939f, 0.195536137f, 0.148518026f, 0.0780571699f, 0.0786569118f, 0.183963895f, -0.0151976347f,
+    -0.238050908f, 0.147791296f, -0.131718248f, 0.228139788f, -0.00410825014f, -0.212344736f, -0.0314579308f, 0.164028972f,
+    0.165014744f, -0.184556067f, 0.231735975f, 0.0162940323f, 0.0942138135f, 0.0137932003f, 0.187822998f, 0.0769316852f,
+    0.00367811322f, -0.144421756f, -0.0884803236f, -0.101887316f, 0.0329670906f, 0.154143691f, -0.249884039f, 0.0985514224f,
+    0.065525949f, 0.0944010317f, -0.133568674f, 0.0377988219f, -0.0614628494f, 0.112667292f, 0.0608286858f, -0.174749196f,
+    -0.230773151f, 0.107044816f, 0.197692186f, 0.126707464f, 0.195052117f, 0.117281139f, 0.232043087f, -0.061368078f,
+    0.234444201f, -0.0907281935f, 0.0613571107f, 0.0994875729f, -0.228471339f, 0.153305709f, -0.165239245f, 0.24193275f,
+    -0.0129562318f, -0.158804417f, -0.0604035258f, -0.0225147605f, -0.0567599833f, -0.131532133f, -0.0339609981f, 0.113655835f,
+    -0.223947138f, 0.121985555f, 0.0588872731f, 0.193952709f, 0.0593456328f, 0.138544142f, 0.0651282668f, -0.154591829f,
+    -0.0636744499f, 0.239770502f, -0.126262277f, 0.123773694f, -0.109080464f, -0.074865371f, -0.068325609f, 0.0275510252f,
+    0.188677371f, 0.0512258708f, 0.244480491f, 0.0482138693f, 0.231583327f, -0.00640121102f, 0.106567413f, -0.135137945f,
+    -0.128974587f, 0.0676605403f, 0.10574314f, -0.11464712f, -0.0658066273f, -0.176503778f, 0.212589502f, 0.193252802f,
+    -0.0369396508f, 0.195246786f, -0.214254886f, -0.0908765197f, 0.0751019716f, -0.122627825f, -0.230026633f, 0.0570621192f,
+    0.0303962827f, -0.188456118f, 0.171957731f, -0.154434443f, 0.00418192148f, 0.164684981f, -0.0606356561f, -0.0840758085f,
+    -0.203926861f, -0.11551851f, 0.220531881f, -0.166741014f, 0.0346852243f, 0.123978317f, 0.174016476f, -0.175540179f,
+    0.163489014f, 0.13902095f, -0.14842543f, -0.184327573f, 0.230643034f, 0.0294912755f, 0.0290866196f, -0.0146339238f,
+    -0.198317915f, 0.183406383f, 0.103448302f, -0.030412674f, -0.149851263f, 0.122548044f, -0.0774526596f, -0.214937121f,
+    0.0767554641f, 0.0424294174f, 0.229320258f, -0.190989226f, 0.0797603726f, -0.229273081f, -0.106163293f, 0.113093168f,
+    0.164379746f, -0.206415623f, -0.155970931f, -0.154401898f, -0.196586251f, -0.0600050986f, 0.0547866225f, 0.124028951f,
+    0.142859161f, -0.00799253583f, -0.133475065f, 0.0535601676f, 0.223389059f, -0.122059703f, -0.0378169119f, 0.196506381f,
+    0.0692429543f, 0.0769027472f, 0.231924802f, -0.181178629f, 0.141571015f, 0.243778288f, -0.148366839f, 0.118296921f,
+    -0.0250867903f, -0.0920895934f, 0.00298351049f, -0.0107314289f, 0.0404451489f, 0.0993249714f, -0.0983517468f, 0.246199489f,
+    -0.0272518396f, 0.0951662958f, 0.00849792361f, 0.0339992642f, -0.195162326f, 0.112004906f, 0.0394684672f, 0.168168485f,
+    0.113288432f, -0.0795837641f, 0.248111248f, -0.241102457f, 0.05414024f, 0.0150720477f, 0.136785388f, 0.138524354f,
+    -0.130111307f, -0.0142907798f, -0.148387223f, -0.0838930309f, -0.100717604f, 0.0535209477f, -0.153795153f, 0.220310718f,
+    0.1573219f, -0.162111253f, 0.196764499f, 0.174766004f, 0.0551918447f, -0.0772137046f, -0.230674803f, -0.127207845f,
+    0.190081567f, -0.0704644024f, 0.0946374238f, 0.113456845f, -0.0574341416f, 0.0196054876f, -0.200379729f, 0.0177869499f,
+    0.104538828f, -0.0801669359f, -0.159552157f, 0.076928407f, -0.0532018542f, -0.218708366f, 0.0990222991f, -0.144532055f,
+    0.122298479f, 0.242791802f, -0.0733209252f, -0.238660514f, 0.2328794f, 0.0394874811f, -0.123251081f, -0.179683536f,
+    -0.0564800799f, 0.0455076098f, -0.0716414452f, 0.0386869907f, -0.221281588f, 0.178655982f, 0.05300951f, 0.0741730928f,
+    -0.085475117f, 0.0645997226f, -0.175272316f, 0.168306768f, 0.0897767544f, -0.243025839f, 0.160988033f, -0.203100264f,
+    -0.168085486f, -0.0699918568f, -0.214942694f, 0.00722762942f, 0.222503036f, 0.0144655108f, 0.231527507f, 0.0485980213f,
+    -0.245696098f, 0.154203266f, 0.030516535f, -0.166360617f, -0.0394098759f, -0.217443764f, 0.226293743f, -0.187615424f,
+    0.0440303981f, 0.21528253f, -0.0411811173f, -0.114566714f, 0.21232447f, -0.0523632467f, -0.18603453f, -0.151181132f,
+    0.0830514431f, -0.153488606f, -0.0762067139f, -0.123663872f, -0.16050601f, 0.0558119118f, 0.172157347f, 0.190732211f,
+    -0.167395145f, -0.00769415498f, -0.200904518f, 0.0628126264f, -0.216856807f, -0.0524283946f, -0.19424957f, -0.111419171f,
+    0.00852233171f, -0.145114839f, -0.107224762f, -0.20537892f, -0.0965921581f, 0.120203793f, 0.0387935936f, 0.0900779366f,
+    -0.0614259243f, -0.109515727f, -0.217058331f, -0.0188779533f, 0.0267034769f, -0.0331468284f, -0.127436966f, -0.0128246844f,
+    -0.0684678257f, -0.00211161375f, -0.145143181f, 0.239654303f, -0.24761644f, -0.104444742f, -0.146761298f, -0.0280742347f,
+    0.0269191861f, -0.0426444113f, -0.140431225f, -0.148144335f, -0.231421202f, 0.249166459f, 0.249276042f, -0.108392864f,
+    -0.14808476f, 0.0740105212f, 0.211069852f, -0.0478624403f, 0.182930052f, 0.0165599585f, 0.136110783f, -0.204019606f,
+    0.2234914f, 0.213089585f, -0.166028529f, -0.00730323792f, 0.16563952f, 0.237275481f, -0.166464269f, -0.218348175f,
+    -0.176647633f, -0.180318326f, -0.148723215f, 0.219837189f, 0.156508356f, 0.117841899f, -0.0600292385f, -0.0691596866f,
+    0.231482834f, 0.078412503f, 0.205977052f, 0.184378803f, 0.0250176787f, 0.202787578f, 0.0710790455f, 0.0244603157f,
+    -0.00224655867f, -0.0831409097f, 0.221380293f, -0.0385078192f, 0.0297476053f, -0.0876783729f, 0.0895090699f, 0.181833595f,
+    -0.0124229193f, -0.151934922f, 0.247483671f, -0.121130854f, -0.228823423f, 0.184811592f, -0.228212774f, 0.105931282f,
+    0.201544404f, 0.212965518f, -0.0374236703f, 0.216636926f, 0.0902578533f, -0.087996453f, -0.105701655f, -0.134631604f,
+    0.103581637f, -0.0646133125f, 0.0613564849f, 0.0117333233f, -0.0620357096f, -0.0773026347f, -0.134393424f, -0.0162361562f,
+    0.119747281f, 0.0440797806f, -0.111026585f, -0.215119094f, 0.239600837f, -0.217852741f, -0.119025379f, -0.0771901906f,
+    -0.0901473463f, 0.0124517679f, 0.123964965f, 0.185679853f, 0.0811037123f, -0.195725501f, -0.150783122f, 0.17382291f,
+    0.0573814511f, -0.163474232f, 0.0073774457f, -0.00561720133f, 0.108436227f, -0.0527105033f, -0.179970086f, 0.0173252821f,
+    -0.0226182342f, -0.0497912467f, -0.0451485515f, -0.0791131556f, 0.243571252f, 0.132951885f, 0.0605732203f, 0.110264927f,
+    -0.170612574f, -0.0194811523f, 0.147896528f, 0.119816244f, -0.00842022896f, -0.215772927f, -0.105461389f, 0.0226390362f,
+    -0.125032902f, -0.136229426f, 0.0267195106f, 0.0922895968f, 0.070489645f, -0.0797557235f, -0.199395448f, 0.0566866398f,
+    0.0594390929f, 0.0334481597f, 0.146210164f, -0.183724225f, 0.21160537f, -0.244323432f, 0.0325497091f, 0.0655939877f,
+    -0.0776914656f, -0.233828545f, -0.0350235403f, -0.137311578f, 0.18987295f, 0.0805165768f, 0.00544771552f, 0.0402517021f,
+    0.151921093f, 0.117688745f, -0.0932094455f, 0.0592905581f, 0.139986724f, 0.232200116f, 0.0206302702f, -0.0289226174f,
+    0.192536503f, -0.0261579752f, 0.0557918251f, -0.114247113f, 0.0883111358f, 0.132922888f, -0.175735682f, -0.165185213f,
+    -0.181594759f, 0.168510735f, 0.146111041f, 0.18729347f, 0.210244119f, 0.1809012f, -0.186296046f, -0.214300007f,
+    0.00148925185f, 0.0632822812f, 0.0836703777f, 0.0522192717f, 0.23934707f, 0.22664988f, -0.245750904f, 0.205263793f,
+    0.245175064f, 0.248835415f, 0.12397483f, 0.224107713f, 0.240304083f, -0.0317649543f, -0.249191821f, -0.0133390427f,
+    0.142335713f, 0.146084517f, 0.105178624f, -0.150241673f, 0.144625723f, 0.140127778f, 0.065358758f, -0.0791694522f,
+    -0.0492791533f, -0.0677670538f, -0.146268487f, -0.0825449526f, 0.184621304f, -0.233106166f, 0.200798333f, 0.174529374f,
+    0.24614346f, -0.237356871f, 0.176707834f, -0.167986751f, -0.184277058f, -0.0897884965f, -0.179913104f, 0.0303229094f,
+    0.0556683242f, 0.191846102f, -0.0546274483f, -0.111064672f, 0.0957850516f, -0.0676216185f, -0.220547915f, -0.0468998849f,
+    0.11368081f, 0.210468829f, 0.233948171f, 0.0807310939f, 0.0289376676f, 0.134550422f, 0.229934454f, 0.117467046f,
+    0.19819361f, -0.150261432f, 0.0251293778f, -0.212622613f, -0.196727514f, -0.15079838f, -0.202780992f, -0.0999203622f,
+    -0.142208338f, 0.0826886892f, -0.0512408912f, -0.0307407379f, -0.191895604f, 0.0709943175f, 0.154188186f, -0.219917715f,
+    -0.0696011782f, 0.114715666f, -0.126694322f, -0.0305483341f, 0.068202883f, -0.132442981f, 0.2228131f, 0.110751748f,
+    -0.135527492f, 0.246078968f, -0.0038664937f, 0.172876418f, -0.124605477f, 0.140774012f, -0.0966266096f, 0.00545594096f,
+    0.155979574f, -0.185801655f, -0.143608153f, 0.0780618787f, -0.1459952f, -0.206642032f, 0.163455993f, -0.0909652412f,
+    0.0953626633f, -0.226245672f, 0.195908755f, -0.0146374702f, 0.137190968f, -0.20928517f, 0.0640104711f, 0.147398621f,
+    -0.042296648f, -0.246893287f, 0.169145137f, -0.0684090555f, -0.172904819f, 0.00621029735f, 0.0458954573f, -0.0208372772f,
+    -0.0735907555f, 0.192424715f, 0.215886623f, -0.133070529f, 0.196802348f, 0.00427821279f, -0.00242480636f, -0.220815241f,
+    0.0495567024f, 0.101131916f, 0.0256168544f, 0.223998964f, 0.204607069f, 0.0676712096f, 0.0925439f, 0.0670080483f,
+    -0.0866863728f, -0.0431081951f, 0.00972941518f, 0.0518915951f, 0.11095351f, -0.0591265857f, -0.159220666f, -0.0815855563f,
+    0.029015094f, 0.117588371f, 0.086520642f, 0.0715607405f, -0.0437327623f, -0.0283763707f, -0.058591485f, 0.00762394071f,
+    -0.0922815204f, 0.0737323165f, -0.0240264237f, -0.172585934f, 0.0129724741f, -0.169990271f, 0.208270043f, 0.0585937202f,
+    -0.134406835f, 0.0794765353f, 0.194348484f, 0.0527865589f, 0.0794610977f, 0.24468568f, -0.135372251f, 0.110614687f,
+    -0.163973689f, -0.100026608f, 0.0263611078f, 0.205046356f, -0.0789767802f, -0.204954445f, 0.114198565f, 0.197416276f,
+    0.232099712f, 0.232393593f, 0.0487629771f, 0.0511602163f, -0.0857309699f, 0.238429368f, 0.247352272f, -0.236238956f,
+    0.181775838f, -0.208229631f, 0.0498527288f, -0.0216884017f, -0.243267238f, 0.144328862f, -0.111026287f, -0.107848048f,
+    0.0410030484f, 0.106471092f, -0.145584852f, 0.110592663f, 0.0266415775f, -0.0379253328f, 0.158447206f, 0.233644277f,
+    0.0577565432f, 0.0771040022f, 0.0398598015f, 0.106019408f, 0.145082682f, 0.0931464732f, -0.224438488f, 0.0901337266f,
+    -0.0840350091f, -0.133134425f, -0.171213478f, -0.0380626917f, 0.0437530279f, 0.126306564f, -0.137864172f, 0.00299140811f,
+    -0.2414428f, -0.0868999362f, 0.136352509f, -0.188318491f, -0.0580889881f, -0.178271294f, -0.0907813907f, 0.20085448f,
+    0.0842046142f, 0.0595405996f, 0.0372081697f, 0.149986386f, 0.0852651298f, -0.0828196704f, -0.0980618298f, -0.10572055f,
+    0.0333391726f, 0.0393036902f, -0.199176043f, 0.0688676834f, -0.189728916f, -0.236611187f, -0.0472361147f, -0.235050619f,
+    -0.0827692151f, -0.226875037f, -0.12760374f, -0.116164684f, 0.00724256039f, 0.229476243f, -0.154840916f, -0.170390755f,
+    -0.0963879526f, -0.0993378758f, -0.221140563f, 0.0852921009f, 0.123204023f, -0.0540321171f, -0.129506022f, -0.177467436f,
+    0.0935232639f, 0.109924316f, -0.101136684f, -0.0269945264f, 0.115819752f, -0.134259015f, -0.160593629f, 0.2118195f,
+    0.0720457137f, -0.0881557167f, -0.169009715f, 0.185071111f, 0.0940660834f, -0.0450537801f, -0.0809372962f, -0.120407581f,
+    0.0914644897f, 0.174372613f, -0.171191812f, 0.136307508f, 0.0844688118f, 0.155606538f, 0.0891982615f, 0.0912290812f,
+    0.000209003687f, 0.168911248f, 0.233398378f, 0.23902604f, 0.0470893085f, -0.172397286f, -0.146976233f, 0.0447012186f,
+    -0.105140805f, -0.0951120853f, -0.0316458344f, 0.0017811358f, -0.0702215731f, -0.0667265654f, -0.0818000734f, -0.0575667918f,
+    0.0806320608f, -0.0280447602f, -0.0616193712f, -0.0589392185f, -0.0679576695f, 0.148358047f, 0.185365111f, 0.10482794f,
+    0.0581368506f, 0.126774609f, 0.0544675589f, -0.100886405f, -0.138155937f, 0.0966944396f, -0.244679004f, 0.115699828f,
+    -0.0365698934f, 0.194527537f, 0.0692338943f, 0.0699179769f, 0.0295672417f, 0.109028757f, -0.138630748f, 0.0416694283f,
+    -0.224892527f, 0.240927607f, 0.244595855f, -0.0598586202f, -0.021838218f, 0.0384373367f, 0.161512494f, 0.0892112851f,
+    -0.0120354593f, 0.00950354338f, 0.0140857697f, 0.158229679f, -0.229552507f, -0.036744386f, 0.13303861f, -0.0733194351f,
+    -0.119872987f, 0.17301783f, -0.190427274f, 0.153455704f, -0.0263921916f, -0.151410401f, -0.191038311f, 0.161066175f,
+    -0.162103534f, -0.0923580527f, -0.160777211f, -0.133763641f, 0.0653865933f, -0.0913731754f, -0.173046827f, -0.130367339f,
+    -0.145298541f, -0.0868150294f, -0.133826554f, 0.00670775771f, 0.217327476f, -0.0135944188f, -0.0829340816f, -0.22663936f,
+    0.222277015f, -0.142530739f, -0.236537457f, -0.182190508f, -0.223097771f, 0.12473923f, 0.18171972f, 0.142656863f,
+    -0.12351194f, -0.0747335255f, -0.22276181f, 0.19821462f, -0.246594399f, 0.240516961f, -0.132892191f, 0.0309104025f,
+    0.0470479727f, 0.180807561f, -0.217129946f, 0.0820833743f, 0.098020345f, -0.101936787f, -0.123217285f, 0.185178339f,
+    -0.0857200027f, 0.101790279f, 0.156038016f, 0.079000324f, -0.228113234f, -0.0825733542f, 0.065703541f, 0.0963071287f,
+    -0.0998224616f, 0.0454121828f, -0.20406571f, -0.108021855f, -0.024346292f, -0.0720302761f, -0.121448487f, 0.137414098f,
+    0.148604184f, -0.158801645f, 0.179395884f, 0.136724353f, -0.0443473458f, 0.206807464f, 0.204130173f, -0.0202278197f,
+    0.00940740108f, 0.0607998371f, 0.076476723f, 0.226692468f, -0.0362226963f, 0.114193261f, -0.0160284936f, 0.0724975169f,
+    0.209305346f, -0.00789833069f, -0.144486368f, -0.201938421f, -0.23471579f, 0.163475782f, -0.178111076f, 0.0717781186f,
+    0.228456974f, 0.104514718f, 0.121544838f, -0.222882897f, -0.249238312f, -0.161031783f, -0.143801808f, -0.0498188734f,
+    0.0201251507f, -0.0634021461f, -0.0352125168f, 0.0612694025f, 0.238196015f, 0.230931163f, -0.181980193f, -0.14459148f,
+    0.195800751f, -0.0730809867f, -0.0501777232f, 0.109935969f, 0.152838886f, -0.0949162543f, -0.150107354f, -0.118228763f,
+    0.210380465f, -0.124998897f, -0.0938795209f, 0.0384722352f, 0.00509980321f, -0.0501653552f, 0.0161622167f, -0.120966405f,
+    -0.18954733f, -0.177600652f, 0.0252082348f, -0.170808196f, -0.200078398f, -0.215436339f, 0.141807199f, 0.2278952f,
+    -0.226325542f, 0.0694895685f, 0.0056168437f, 0.0359803736f, -0.228574961f, 0.17882508f, -0.103233308f, 0.178654522f,
+    0.132938921f, 0.211725682f, -0.129504591f, 0.201674193f, -0.149878442f, 0.192702651f, 0.0696243644f, 0.134243309f,
+    0.139419645f, -0.051451385f, -0.189717025f, -0.0131573081f, -0.224163473f, -0.180279106f, -0.0606622696f, 0.0684568882f,
+    0.105355263f, 0.0366229713f, -0.112627536f, -0.219796091f, -0.0498853028f, -0.0277177989f, -0.153472245f, 0.179858297f,
+    -0.113414824f, -0.0342683196f, 0.163799703f, -0.212025166f, -0.0291867554f, -0.0721000433f, -0.0305705667f, 0.0721327364f,
+    -0.153882802f, 0.245353818f, 0.00914087892f, 0.127299607f, 0.0912209153f, 0.0414443016f, 0.19150129f, -0.180851728f,
+    0.0835451186f, 0.102288246f, -0.180753171f, 0.0133779049f, 0.162395388f, 0.233354926f, -0.0220885575f, -0.2243931f,
+    0.182297379f, -0.107271403f, -0.140183508f, -0.089192152f, 0.0565107763f, -0.215744376f, 0.139146328f, 0.0820797682f,
+    -0.0934124291f, -0.215818852f, 0.0987543762f, 0.058867991f, 0.143351346f, -0.101662606f, -0.206492633f, -0.108722925f,
+    -0.132335186f, -0.170828223f, 0.117389202f, -0.229540259f, 0.108611196f, 0.08154127f, -0.0484355688f, -0.177838653f,
+    0.143993467f, -0.184006959f, -0.0613414347f, 0.144372612f, 0.203662366f, -0.088553369f, 0.212051332f, -0.224981487f,
+    0.0446567833f, 0.149021626f, -0.0916191638f, -0.207131386f, -0.221716911f, 0.174809426f, -0.0391789377f, 0.00864011049f,
+    -0.113274217f, -0.0861444771f, -0.185632557f, -0.202522278f, 0.0430168211f, 0.193439484f, 0.15355888f, 0.241078526f,
+    0.00919640064f, 0.115706801f, -0.210392565f, -0.119200677f, -0.0741046369f, -0.13784501f, -0.221143007f, -0.0772022307f,
+    -0.088391602f, -0.0640963316f, 0.0914152265f, -0.184362531f, -0.0759169757f, -0.180058479f, 0.218267679f, -0.237684548f,
+    0.0619178712f, 0.0479255319f, 0.214692444f, -0.0621114075f, 0.113682419f, 0.088570714f, 0.149424195f, -0.208844423f,
+    0.234001786f, -0.00415539742f, -0.180705041f, -0.0977165401f, -0.206453413f, -0.248493135f, -0.00820305943f, 0.0810818374f,
+    0.0191319585f, 0.162473649f, 0.219246835f, -0.242239833f, -0.197195858f, 0.0425088108f, -0.243690401f, 0.000283151865f,
+    -0.015815407f, 0.0727424026f, 0.0713350773f, 0.160512596f, 0.177119255f, -0.197030813f, -0.0755324066f, -0.0135694146f,
+    -0.114680499f, -0.142626464f, -0.142685652f, -0.226571023f, 0.233597338f, -0.138578773f, 0.187211454f, 0.162752062f,
+    0.227302939f, 0.078818202f, -0.0117656887f, -0.154094815f, -0.0806763768f, -0.112632662f, -0.00633433461f, -0.0728887022f,
+    0.196198881f, -0.14467299f, 0.215795517f, -0.107649565f, -0.0952554047f, 0.0594005585f, -0.111901104f, 0.0361762345f,
+    -0.113592744f, -0.0714687407f, 0.0968820155f, 0.184629083f, -0.0294982195f, 0.0704914331f, 0.156050384f, 0.19663626f,
+    0.032787621f, 0.0850229263f, 0.208223343f, -0.232473761f, 0.102253228f, 0.166580826f, 0.0328840613f, 0.171688765f,
+    -0.0374033451f, 0.168302417f, -0.105615199f, -0.0974840522f, -0.19980517f, 0.159186333f, 0.00158083439f, 0.0725442469f,
+    -0.245255172f, -0.0850396454f, 0.148557484f, 0.10366568f, -0.201778352f, 0.133667082f, -0.165264726f, 0.0172151625f,
+    0.00728496909f, -0.194451451f, 0.123441815f, -0.196217954f, 0.166435182f, -0.168425739f, 0.179298192f, 0.0705084801f,
+    0.157563031f, 0.0315693319f, -0.0308698714f, -0.0722174942f, -0.123735845f, 0.0900803804f, -0.0520549119f, -0.0884553194f,
+    0.126366675f, 0.159496516f, 0.143069774f, -0.0684167743f, -0.229715347f, -0.191218674f, 0.13731125f, 0.203188479f,
+    -0.145763516f, -0.0228897035f, 0.249383986f, -0.0602313876f, -0.0523497164f, 0.150425524f, -0.0168523192f, 0.18916291f,
+    0.209656566f, 0.243276298f, 0.236234695f, 0.167115808f, -0.113301545f, 0.195385575f, 0.0688506961f, 0.229964942f,
+    0.045984149f, -0.0682189167f, 0.0456550419f, -0.00416296721f, -0.0435569882f, 0.0533836782f, 0.133054584f, 0.117060274f,
+    0.208326399f, 0.158798516f, 0.0587522089f, -0.030225724f, -0.0444893539f, 0.0316436291f, 0.0608379543f, -0.205877662f,
+    -0.236164182f, -0.0131563842f, -0.000592797995f, -0.0355459154f, -0.0513082147f, 0.0157669485f, -0.226149827f, -0.218133032f,
+    -0.0709966123f, -0.0812513232f, -0.0989421606f, -0.00627234578f, -0.231221586f, -0.213074297f, 0.221550524f, 0.0109663308f,
+    -0.0257234871f, -0.128734231f, 0.204049736f, 0.175886601f, -0.0912723839f, -0.130200326f, -0.0654149354f, 0.0622232854f,
+    -0.0962950885f, -0.113350689f, -0.150462031f, 0.15814501f, 0.0510864258f, -0.115172446f, 0.015922755f, 0.221353203f,
+    0.0604487658f, -0.0190575719f, 0.118983895f, 0.13380748f, 0.0755978227f, 0.211885482f, 0.0780230761f, -0.2205019f,
+    0.147235453f, 0.0177899897f, -0.221878499f, 0.112927735f, -0.0828436613f, -0.0770341754f, 0.190661907f, 0.152885824f,
+    -0.130674005f, 0.112936795f, -0.211553216f, 0.181929469f, -0.234643459f, -0.108232588f, 0.169890761f, -0.12547183f,
+    0.0382093787f, -0.0905844867f, 0.113806069f, 0.103523642f, -0.066916883f, 0.0918951035f, 0.18683663f, -0.11978969f,
+    -0.0700724125f, -0.241637737f, -0.110207498f, -0.0296110809f, -0.186788201f, 0.109236091f, -0.211608887f, 0.0456056595f,
+    0.0206926465f, -0.116382509f, -0.0882029533f, 0.164561868f, 0.0412186384f, 0.238291204f, 0.0881387889f, 0.136552155f,
+    0.0946006477f, -0.147216767f, 0.0447061956f, 0.160689801f, 0.165711015f, -0.052415818f, 0.0441278219f, -0.0686965585f,
+    0.171488672f, 0.10908559f, 0.0333133936f, 0.108873188f, 0.00595462322f, -0.115432948f, -0.203362107f, 0.0630153716f,
+    0.11242786f, -0.0939714611f, 0.167413682f, 0.143766075f, 0.0832573771f, 0.015858829f, -0.24832958f, 0.167599559f,
+    0.0151210725f, 0.1396797f, 0.133536279f, -0.168970287f, -0.165519148f, -0.10224998f, -0.065656215f, -0.191110522f,
+    -0.210344851f, 0.120589703f, 0.111047328f, -0.0219207704f, -0.0976193845f, 0.238929659f, -0.189201772f, -0.108056694f,
+    0.0296469331f, -0.0123448372f, 0.221713662f, -0.0168301463f, 0.0644488633f, 0.110079557f, 0.244797617f, -0.0225571096f,
+    -0.208253562f, -0.119663388f, 0.230075419f, -0.107485116f, 0.0224647224f, 0.0228357911f, -0.141609401f, 0.231094569f,
+    -0.0530472398f, -0.148608208f, -0.0259289443f, 0.107819527f, -0.0118245482f, 0.0500466526f, -0.117389292f, -0.10955739f,
+    -0.0814863145f, 0.209505469f, -0.0285475552f, 0.122463077f, 0.124281883f, -0.0908928812f, -0.0441802144f, -0.170428276f,
+    -0.0462889969f, 0.176170349f, 0.121241838f, 0.202668756f, -0.157899082f, 0.178257644f, -0.166001439f, 0.214692324f,
+    0.229796916f, 0.134461164f, -0.140227884f, -0.199702322f, -0.0103462338f, 5.32865524e-05f, -0.0863002539f, 0.0691095889f,
+    -0.0822818577f, 0.0848556757f, -0.161048949f, -0.224732459f, -0.222516388f, 0.0450144708f, 0.231605291f, -0.200310707f,
+    0.0667175949f, 0.0223791301f, 0.192452908f, 0.0547591746f, -0.161238313f, -0.0587647259f, 0.174833953f, -0.00157898664f,
+    0.219304562f, 0.173785806f, 0.0439344943f, -0.0378434062f, 0.0681311786f, 0.0820811093f, -0.0252614617f, -0.0139278769f,
+    0.107767552f, -0.132176101f, -0.00530734658f, 0.239659399f, 0.105185091f, 0.163483143f, 0.0780235529f, -0.196661562f,
+    -0.154891342f, 0.132509708f, -0.186201543f, 0.189981192f, 0.163729668f, 0.223764062f, 0.106031358f, 0.154953271f,
+    0.104019254f, -0.0743902624f, 0.222723603f, 0.230979055f, 0.0857163072f, -0.0493032038f, -0.157866061f, -0.199309587f,
+    -0.169308633f, 0.0870275497f, -0.190076709f, 0.068731606f, -0.225868553f, 0.10252443f, -0.0296850204f, -0.0733363032f,
+    0.138053626f, 0.0763284266f, -0.240078688f, 0.148803651f, -0.0496193469f, -0.0891485512f, 0.207565784f, 0.192008346f,
+    0.0946531594f, -0.089967519f, 0.050349921f, -0.0967416465f, 0.0929313302f, 0.249392539f, -0.0714484453f, -0.201873481f,
+    -0.0506566167f, -0.198430181f, 0.0913172662f, -0.249339402f, -0.0349796712f, -0.220684439f, 0.176522315f, 0.143119305f,
+    0.146082431f, 0.207601756f, -0.160466433f, 0.0992264748f, 0.115060538f, 0.110802203f, -0.159760028f, 0.0613274276f,
+    0.000755369663f, 0.0146485567f, 0.0773611665f, 0.111302137f, 0.201423794f, -0.184516132f, 0.121236682f, 0.157653242f,
+    0.16122213f, -0.237566888f, -0.0415165722f, -0.0886625051f, 0.0848896801f, 0.0642330647f, -0.0497888327f, 0.0681090951f,
+    0.142143548f, 0.200642586f, -0.0829282105f, -0.198022008f, -0.0896163583f, -0.0768669844f, -0.215787262f, -0.175926894f,
+    0.117533624f, -0.223385751f, 0.00382363796f, 0.043770045f, -0.0119662285f, -0.134663075f, 0.15501073f, -0.0234324932f,
+    0.148451418f, 0.119456053f, 0.0698442459f, 0.221213639f, 0.0357920229f, 0.151112378f, -0.104245812f, 0.110279709f,
+    -0.156050891f, -0.12467739f, -0.0801041126f, 0.155124366f, -0.0475231111f, -0.00668418407f, -0.0517131984f, -0.140677452f,
+    -0.0697612166f, 0.0383713245f, -0.101852119f, -0.0174352825f, -0.193321079f, 0.00034737587f, 0.0610454679f, -0.039637506f,
+    -0.0275326967f, -0.211683035f, 0.0769219697f, 0.0728178024f, -0.163889855f, -0.173784435f, -0.118707448f, -0.0437355638f,
+    -0.169161916f, 0.0763479471f, -0.217537969f, -0.163402766f, 0.202453792f, 0.0367961824f, 0.0523533225f, 0.133965641f,
+    0.191123188f, -0.0350941122f, 0.116419852f, 0.168230176f, 0.224396288f, 0.104804248f, 0.0944379568f, -0.174099982f,
+    0.00116175413f, -0.0536366105f, -0.00280550122f, 0.244666606f, 0.138587415f, 0.185812593f, -0.103548765f, 0.105558425f,
+    -0.0969180465f, -0.00800868869f, 0.162199944f, 0.0796055198f, 0.0424517095f, 0.0580559969f, -0.0481565297f, 0.103929132f,
+    0.0860227346f, 0.061783731f, -0.206954032f, -0.121078134f, -0.0852074921f, 0.232414901f, -0.186429173f, 0.138944864f,
+    0.194781363f, 0.240182519f, -0.089253217f, -0.0750153661f, 0.122004896f, 0.118031204f, -0.0479388237f, 0.135025412f,
+    -0.195049345f, -0.138036728f, 0.102598935f, -0.0671352446f, 0.104631543f, 0.178466678f, -0.00532796979f, 0.225145787f,
+    -0.0640393198f, -0.0505520105f, 0.144356936f, 0.0848177075f, -0.200246036f, -0.0306023955f, 0.113721073f, 0.0606756508f,
+    -0.124889523f, 0.0769884586f, 0.00188034773f, -0.0677632689f, -0.0062379241f, 0.0098156929f, -0.147708237f, 0.152367264f,
+    0.0544939935f, 0.133554399f, 0.247122377f, -0.217721999f, -0.168172389f, -0.1871517f, -0.165378571f, 0.01800704f,
+    0.199329138f, -0.0358020663f, -0.186783433f, 0.193372577f, -0.00853204727f, 0.241398305f, 0.162828475f, 0.195835203f,
+    -0.155054361f, 0.051425308f, -0.0486608744f, 0.220305204f, -0.0562173128f, -0.178594559f, 0.149336487f, -0.118602216f,
+    -0.152501196f, 0.0387389362f, 0.0821399391f, -0.0260621905f, -0.0940349102f, -0.0771008432f, -0.176282316f, 0.0053524673f,
+    0.0512281358f, 0.182686925f, -0.184469193f, -0.142316401f, -0.151380211f, 0.140203893f, -0.106584311f, 0.14104417f,
+    0.115765989f, 0.207932711f, 0.239743352f, 0.181981564f, -0.0872099102f, -0.218447626f, 0.183275998f, 0.0767804086f,
+    -0.233258516f, 0.191877365f, 0.0437046587f, -0.234797865f, 0.076590538f, -0.231418699f, -0.131100982f, 0.0716337264f,
+    -0.236078709f, -0.214089483f, 0.171068758f, 0.0338424742f, 0.111179143f, 0.104284406f, -0.0769999027f, -0.0109189153f,
+    -0.000694930553f, 0.162937939f, -0.0555080473f, -0.20217821f, 0.00510233641f, -0.202181846f, 0.0819694996f, 0.230770707f,
+    0.0111997128f, -0.119986087f, -0.198348433f, -0.194995672f, -0.233722627f, -0.0596654415f, -0.136072934f, -0.238610983f,
+    -0.12766546f, 0.175617754f, 0.0225307643f, 0.228018969f, 0.0418011546f, -0.223164707f, 0.0594781041f, 0.0638253093f,
+    -0.0699779689f, 0.00642836094f, 0.216050476f, -0.23323071f, -0.0761323869f, 0.19502911f, 0.0319767296f, 0.0246498883f,
+    0.0857607722f, 0.0386973023f, 0.0668725967f, 0.162184387f, -0.0760605633f, -0.227766931f, -0.00957477093f, 0.0550878346f,
+    0.161202878f, -0.234795779f, -0.102659941f, -0.238423258f, 0.10255143f, 0.126030356f, 0.156191021f, -0.147708118f,
+    0.104608089f, 0.175143212f, -0.0624414682f, -0.0547541976f, 0.0298027992f, 0.230386168f, 0.206286728f, 0.249261081f,
+    0.216927439f, 0.0112818182f, -0.0549978614f, 0.22843048f, -0.173445255f, -0.138956457f, -0.163823158f, -0.0515120029f,
+    -0.129211634f, 0.235409915f, -0.217153728f, 0.175151706f, -0.0716034174f, 0.136130005f, -0.0498168468f, -0.211359262f,
+    -0.168829083f, 0.213035673f, -0.106868416f, 0.0344124436f, -0.240453094f, -0.136617422f, -0.229298472f, 0.0427187979f,
+    0.201075882f, -0.121729344f, 0.000605523586f, -0.164340347f, -0.172376901f, 0.191609412f, 0.0611408353f, 0.142748088f,
+    0.00771030784f, 0.129896045f, 0.0182085931f, -0.236121178f, -0.249334663f, 0.114520699f, -0.0727522075f, 0.235931069f,
+    0.0190853477f, 0.00454500318f, -0.00469610095f, 0.0749792755f, 0.16280055f, -0.171937257f, -0.124448985f, -0.0869115889f,
+    0.104370266f, -0.0490152538f, -0.0727545917f, 0.083871901f, -0.116646856f, 0.0447453856f, -0.213125139f, 0.208765268f,
+    -0.139669776f, 0.0873708725f, 0.00356540084f, -0.0606062412f, -0.0109336972f, 0.222525179f, -0.1792548f, -0.0145474672f,
+    -0.0864844918f, -0.127197951f, 0.112235934f, 0.0695081055f, 0.0715611577f, -0.220036596f, -0.0392325521f, -0.0314371586f,
+    -0.0768328607f, -0.215102881f, 0.035990417f, 0.0519716442f, 0.0284561217f, 0.195527226f, -0.067027986f, 0.129789233f,
+    -0.00158381462f, -0.073222518f, 0.0489727259f, 0.0816293955f, -0.0567446947f, 0.0664415061f, -0.157379627f, -0.223662704f,
+    -0.120487005f, -0.156248033f, -0.0335781574f, 0.240990877f, 0.126552433f, 0.14641881f, -0.16849497f, -0.196708649f,
+    0.193907499f, -0.184656531f, -0.0259902477f, 0.154283553f, -0.187035263f, 0.246044308f, -0.189739972f, -0.102182209f,
+    -0.200249523f, -0.0556257069f, 0.028732419f, -0.172785133f, -0.197371066f, 0.0167355835f, 0.0688195229f, 0.0565941632f,
+    -0.186135173f, 0.0760320425f, -0.00860771537f, 0.133785248f, 0.20552206f, 0.0113230944f, -0.140373707f, -0.033783555f,
+    -0.00670689344f, -0.163774729f, 0.0310506523f, -0.0448602438f, -0.241010487f, -0.0523106158f, -0.203744054f, 0.136756927f,
+    -0.0915274918f, 0.234249651f, -0.0998987257f, -0.0933157504f, 0.0549891889f, -0.189377695f, 0.158563972f, -0.0472368002f,
+    0.130377501f, -0.0468788445f, 0.235631466f, -0.192483902f, -0.165431947f, -0.0148780048f, -0.0440534353f, -0.225028992f,
+    -0.0705887973f, 0.0510099828f, -0.0060261786f, 0.153653383f, -0.209936231f, 3.31997871e-05f, 0.0339954197f, -0.248343647f,
+    0.246155918f, -0.0787810385f, 0.0053076148f, 0.144522548f, 0.146352053f, 0.226690322f, -0.23422727f, -0.197334081f,
+    0.13051191f, 0.179511696f, 0.147281855f, 0.0386553407f, -0.0786679387f, 0.196909189f, 0.160956681f, -0.178080946f,
+    0.0663276315f, 0.177419692f, 0.0530092418f, 0.245146662f, 0.109216094f, 0.204806715f, 0.0466720164f, 0.141224235f,
+    0.0228581131f, -0.203768909f, 0.0504535735f, -0.0526302159f, -0.0280015171f, 0.161636621f, -0.0591679513f, 0.124919355f,
+    -0.0154738724f, -0.157607824f, 0.178940624f, 0.23107031f, 0.0236690938f, 0.0323592424f, 0.202548087f, -0.206476003f,
+    -0.123789728f, -0.1517919f, -0.0547186732f, 0.0645653307f, -0.00607344508f, 0.107115895f, -0.201640815f, 0.0928368866f,
+    -0.20960179f, 0.0565119088f, 0.103629798f, -0.21738559f, 0.169397324f, -0.123784751f, -0.150819808f, 1.53779984e-05f,
+    0.0122947097f, -0.143315315f, -0.198379129f, -0.243997306f, -0.0522174239f, 0.237059891f, 0.22156024f, 0.0910480022f,
+    -0.204061389f, 0.228981227f, -0.243618935f, 0.0885127783f, -0.140242994f, -0.200541407f, -0.150601983f, 0.214009434f,
+    -0.132173181f, 0.190728545f, -0.24847886f, -0.103727221f, -0.2021043f, -0.176306576f, -0.200503528f, -0.237873644f,
+    0.0269979239f, -0.0190243125f, 0.0915482938f, -0.141125977f, 0.182223469f, 0.0896660984f, -0.237748712f, 0.049892813f,
+    -0.0304993093f, -0.0206935108f, 0.118896753f, 0.163229167f, 0.046064198f, -0.242460757f, -0.0772935152f, 0.0650444925f,
+    -0.195567787f, -0.0996193886f, 0.124994397f, 0.0620340705f, 0.00819072127f, 0.19904837f, 0.0470411479f, 0.018776387f,
+    0.238881975f, 0.0151664913f, -0.00626516342f, 0.0394458473f, 0.0561088622f, -0.0770360231f, -0.185660571f, -0.133570492f,
+    -0.226429343f, 0.154162139f, -0.119475245f, -0.234845817f, 0.0529889762f, 0.0607130527f, -0.179949939f, 0.0449799597f,
+    -0.118711948f, -0.13750124f, 0.073151052f, 0.20080924f, -0.243246853f, -0.207642168f, 0.164196193f, 0.176691949f,
+    -0.120128363f, -0.104455352f, 0.0895875096f, -0.233634919f, 0.0492799282f, 0.193918973f, 0.0904923081f, 0.129816145f,
+    -0.0177813768f, 0.017082721f, -0.136316806f, 0.0491728783f, 0.0541998148f, -0.073227495f, -0.00737261772f, -2.17854977e-05f,
+    0.0845807195f, -0.00402677059f, -0.216191143f, -0.161077231f, -0.170040041f, 0.00888830423f, 0.0538275242f, -0.105445385f,
+    0.226778299f, 0.222145975f, 0.185124367f, 0.197295099f, 0.0628817081f, -0.170540005f, 0.206051975f, -0.11883384f,
+    -0.13410911f, -0.20269376f, -0.00373926759f, 0.0706413388f, -0.176845133f, 0.116901159f, -0.0155946612f, -0.16272977f,
+    -0.119466245f, 0.0784097016f, -0.234634757f, 0.0973767042f, 0.0387152135f, -0.0483185351f, -0.0301193595f, 0.122586638f,
+    0.238666743f, 0.214995354f, 0.0406780541f, 0.0185637772f, 0.234394521f, -0.0196067393f, -0.00639179349f, -0.116281062f,
+    -0.155089527f, 0.00729644299f, -0.17837885f, -0.0860450864f, 0.203908384f, 0.214226097f, 0.000753462315f, -0.24118489f,
+    0.116712272f, -0.117676526f, -0.0174842477f, 0.0288939774f, 0.0290153623f, -0.0510961413f, 0.0128264725f, 0.155211359f,
+    -0.0310029984f, -0.0854249299f, 0.142632574f, 0.0958676636f, 0.186700821f, 0.00760671496f, 0.232509315f, 0.0840635002f,
+    0.141902566f, 0.158836037f, 0.0810835958f, 0.0457265079f, 0.0326228142f, 0.149033844f, -0.225900203f, -0.200037301f,
+    -0.091255933f, -0.140304059f, -0.0360588133f, -0.0251277685f, -0.0981913209f, 0.027338773f, 0.0347470343f, -0.222946972f,
+    -0.154426932f, -0.0632060766f, -0.0357654691f, 0.0250668228f, 0.209344596f, -0.0851496756f, -0.181583494f, 0.128166795f,
+    0.134233296f, 0.0325423181f, -0.159047544f, -0.108323157f, -0.236493975f, 0.0496493876f, -0.246967077f, 0.0139757991f,
+    0.0678865016f, -0.248127937f, 0.0710071921f, -0.19006893f, -0.224438459f, -0.142216295f, -0.176942021f, 0.131927013f,
+    0.0668065846f, 0.200018704f, -0.197969347f, -0.106706083f, 0.13660723f, -0.0620742738f, -0.232884139f, 0.184629619f,
+    0.127782822f, -0.154042512f, -0.0678423047f, 0.171851009f, 0.128444731f, -0.204792082f, 0.00203561783f, 0.116020918f,
+    -0.224997848f, 0.0466278493f, 0.0805682242f, 0.122320443f, -0.0766589642f, -0.141926318f, 0.101443261f, -0.137931556f,
+    0.203717738f, -0.157363504f, 0.163081765f, -0.00315707922f, 0.165383101f, 0.0589911342f, 0.177980691f, -0.241476715f,
+    -0.246503025f, -0.15426296f, 0.0224999785f, 0.0376568437f, 0.0352240503f, -0.222218394f, -0.134335995f, -0.0143401623f,
+    0.166035354f, 0.162119895f, 0.136499047f, 0.132676244f, -0.0760964751f, 0.0973322392f, 0.0512651503f, -0.173818052f,
+    -0.0750323236f, 0.146859229f, -0.0068129003f, -0.189034939f, 0.166642755f, -0.157846749f, 0.181924045f, 0.103619576f,
+    0.109402686f, 0.0761576891f, 0.12136507f, 0.222013474f, -0.0968413949f, 0.025400728f, 0.109912276f, -0.183534235f,
+    -0.0695768595f, -0.197236598f, -0.0162160397f, 0.246547878f, 0.200250357f, -0.0690043271f, -0.0604964793f, -0.109312862f,
+    -0.197804481f, -0.0308433175f, -0.0607126951f, -0.0582039952f, -0.198178828f, -0.146563649f, 0.0575810373f, -0.194467008f,
+    0.11725843f, -0.0142450929f, 0.249455929f, 0.178454995f, 0.189169765f, 0.0769928098f, 0.164900273f, 0.18305847f,
+    0.0483285785f, 0.0736498535f, -0.0285388827f, -0.207968831f, -0.0703760386f, -0.153127968f, 0.128192365f, 0.21397987f,
+    0.169652581f, 0.0167655051f, -0.127913386f, 0.248745352f, -0.0485063493f, -0.237420261f, -0.149289459f, -0.21543467f,
+    0.143889755f, 0.241953582f, 0.0801888108f, -0.219700426f, 0.228224605f, -0.116467208f, -0.202824444f, -0.102331489f,
+    0.226467252f, -0.0152667463f, -0.0855473578f, 0.0211836696f, -0.0911987126f, 0.0194983482f, -0.214538455f, -0.0456345379f,
+    0.015781492f, 0.0206716657f, 0.128650606f, -0.224179775f, 0.0478876233f, 0.119884819f, 0.0440537333f, 0.0596174896f,
+    -0.193856865f, -0.0549434423f, -0.0985950232f, 0.147268027f, -0.0337603092f, 0.0739605427f, 0.244780988f, -0.170371622f,
+    0.0467350781f, -0.15225473f, 0.0729492903f, -0.144369751f, -0.028850317f, 0.176921427f, -0.0421757698f, -0.0375615358f,
+    -0.0323738456f, -0.00398853421f, 0.231974036f, 0.0258778632f, -0.172859848f, -0.107259452f, -0.197906137f, 0.193808645f,
+    0.0904690027f, -0.022475183f, -0.190166146f, 0.181697041f, -0.0279458165f, 0.229564428f, -0.205946565f, 0.0604186356f,
+    -0.12143901f, -0.00800386071f, 0.12921676f, 0.0858555734f, 0.0357884467f, -0.0527062714f, 0.00648546219f, 0.11145559f,
+    0.0300450623f, 0.0683557689f, -0.108898222f, -0.0869179666f, -0.00858971477f, 0.131532937f, -0.197589278f, -0.0341964364f,
+    0.141359836f, -0.0772085488f, 0.157331347f, -0.0519287288f, 0.0697888136f, -0.151317984f, 0.225815207f, 0.102557957f,
+    -0.0837667286f, 0.0798555017f, -0.0174758434f, -0.0927271545f, 0.0649579763f, -0.0309946537f, 0.0741043091f, -0.170767695f,
+    -0.0317048132f, -0.00558108091f, -0.0550789833f, -0.220160782f, -0.119167686f, -0.026961118f, 0.0296011269f, 0.0542967021f,
+    0.124028087f, -0.0449676812f, 0.118606299f, 0.230975717f, 0.162300408f, -0.239066064f, 0.244346201f, 0.241595268f,
+    0.0104730427f, -0.0600802302f, -0.137481123f, 0.177389979f, -0.154043317f, -0.212381214f, 0.0268895328f, -0.0682352483f,
+    -0.160551488f, 0.198219776f, 0.0296421051f, 0.00589925051f, -0.219020367f, 0.0701586306f, 0.220527291f, 0.209379733f,
+    -0.0326928198f, 0.215682894f, 0.163810134f, -0.0887771845f, 0.100537688f, -0.0708771348f, -0.162132323f, 0.156660616f,
+    -0.220925212f, -0.184173554f, 0.0496250391f, -0.0496825576f, -0.102972388f, -0.138813466f, -0.047101438f, 0.225650847f,
+    -0.0315997601f, 0.228043675f, -0.0337088406f, -0.134165943f, 0.108771592f, 0.0235973299f, 0.150219947f, 0.0184465051f,
+    -0.184348077f, 0.185281456f, 0.11681959f, 0.12417078f, -0.136689007f, 0.246239036f, -0.100955665f, -0.224243611f,
+    0.173781604f, -0.0915912986f, -0.0933214724f, 0.0164940357f, 0.176457375f, -0.127770543f, 0.228719205f, 0.137844205f,
+    -0.098395437f, 0.0869047642f, -0.143715858f, -0.0341095328f, 0.101744831f, -0.0227256715f, -0.223630905f, -0.154717624f,
+    -0.0312999189f, 0.00203943253f, -0.230955124f, 0.11512351f, 0.175593793f, -0.0715563893f, 0.186233431f, -0.205614418f,
+    -0.176683545f, 0.165916592f, 0.0968452692f, 0.00922876596f, 0.123856306f, 0.0518541038f, -0.0150396526f, -0.151930422f,
+    0.20991084f, -0.143501431f, 0.0542295277f, 0.24420619f, -0.051590234f, -0.18934682f, -0.179561257f, 0.206562251f,
+    0.0527035296f, -0.214983284f, 0.14072746f, -0.0169909298f, 0.175133854f, 0.157808006f, -0.080462873f, 0.19042325f,
+    0.104492307f, 0.0505820513f, -0.0754299164f, 0.0941803455f, -0.103283137f, -0.244182825f, -0.0308900476f, 0.231858283f,
+    -0.12727952f, -0.00562477112f, 0.117747009f, 0.139169097f, 0.145450562f, 0.19255662f, 0.00491431355f, 0.11318025f,
+    0.0755030811f, 0.039385289f, 0.0207870007f, 0.0438471437f, -0.123152226f, 0.215547979f, 0.223790199f, -0.129633576f,
+    -0.240247399f, 0.235822737f, -0.0110710263f, -0.0148290992f, -0.236749023f, 0.113009602f, 0.24765721f, 0.194379181f,
+    -0.189501762f, -0.203225702f, -0.220272511f, 0.246689528f, -0.0927065015f, 0.0881233811f, 0.193677753f, -0.249754071f,
+    -0.0948251188f, 0.0932672322f, -0.0924398005f, -0.01883623f, 0.0252428949f, 0.216919363f, -0.0545292497f, -0.0602257252f,
+    0.108074635f, -0.111732543f, 0.242353678f, 0.0190499425f, -0.181262761f, 0.073197484f, 0.0674250722f, 0.177342743f,
+    0.0651690364f, -0.0481428504f, -0.00313383341f, -0.161266267f, 0.128501803f, -0.186817646f, -0.0773612559f, -0.208238453f,
+    -0.0838229656f, -0.225114256f, 0.144903749f, -0.246621519f, -0.029805094f, -0.106636614f, -0.173615038f, 0.197523624f,
+    -0.0221909285f, 0.120218605f, 0.141149342f, 0.223153651f, 0.112437606f, 0.144669116f, 0.0888254642f, 0.238379449f,
+    0.123702526f, -0.123008519f, -0.0996377468f, -0.020311892f, 0.0158626735f, 0.233962625f, -0.0181956291f, -0.0104361176f,
+    0.127994686f, 0.0313951075f, 0.0193114281f, 0.097705394f, 0.206311166f, 0.00506323576f, 0.211452961f, -0.00499123335f,
+    0.0343367457f, 0.0642710626f, -0.11826992f, 0.0665950179f, -0.207053393f, -0.196187258f, 0.0712015629f, 0.175083578f,
+    0.0636689067f, 0.249205172f, 0.0986265838f, 0.216033399f, 0.0244118869f, 0.0623701215f, 0.0371074378f, 0.0373798609f,
+    0.0274246633f, 0.0744378567f, 0.0586655736f, 0.124314427f, -0.0978532732f, 0.189152032f, -0.0794470012f, 0.1477018f,
+    0.214464158f, 0.199733883f, 0.206860453f, -0.050739646f, -0.0914360583f, 0.0839322805f, -0.076623708f, 0.204416245f,
+    -0.125228852f, 0.101659358f, 0.14750582f, -0.126410067f, 0.177395374f, 0.237386078f, -0.0775793791f, -0.19399634f,
+    -0.0445599556f, 0.180314898f, 0.221613228f, 0.242537111f, 0.240796208f, 0.209988952f, -0.131476343f, -0.0324698091f,
+    0.236191124f, 0.0491814315f, -0.0425417721f, -0.0894489884f, -0.107646972f, -0.159344941f, -0.0813336968f, 0.0647762716f,
+    -0.242697418f, -0.0320004225f, 0.167114437f, 0.000924557447f, 0.242854863f, -0.0342384875f, -0.0514142811f, -0.221134663f,
+    -0.20543316f, 0.0941089094f, 0.224523067f, -0.146722615f, -0.0617718995f, -0.191752642f, -0.0623884201f, 0.0324895978f,
+    -0.052056849f, -0.216255397f, 0.0924217999f, 0.0693898201f, 0.0585693419f, 0.209853023f, 0.0796425641f, -0.0247777104f,
+    0.0253369808f, 0.0323856175f, -0.161621898f, -0.0747924745f, 0.00406301022f, -0.0228288174f, -0.191619873f, 0.0987226665f,
+    -0.103669554f, 0.23771888f, -0.0034827888f, -0.159399539f, -0.213426113f, 0.0875974596f, 0.112991124f, -0.0634416342f,
+    -0.00364807248f, 0.0818067789f, 0.163205683f, -0.143166304f, 0.238823235f, 0.181894213f, -0.101026028f, -0.159006029f,
+    -0.170228153f, 0.0388126373f, -0.11138919f, 0.159579456f, 0.0662641525f, -0.0829766393f, -0.0214464962f, -0.178027928f,
+    0.184700221f, -0.0618382692f, -0.104561001f, -0.0964767337f, -0.0081127882f, -0.0653304458f, -0.226292521f, 0.101283699f,
+    -0.00912162662f, 0.102555126f, 0.141108245f, 0.0602656007f, 0.0877098441f, 0.0247910917f, -0.181724459f, 0.101759046f,
+    -0.0190207362f, -0.218233943f, -0.147076219f, -0.029329747f, 0.219778746f, -0.0721116066f, -0.246281147f, -0.193434209f,
+    0.156655163f, 0.209213763f, 0.237114191f, 0.241506517f, -0.190175772f, -0.0144146681f, -0.211573005f, 0.168929577f,
+    0.247568756f, -0.0726184249f, 0.127024949f, 0.145314127f, -0.0187259018f, 0.0236742496f, 0.240699112f, -0.0488099456f,
+    0.157985896f, -0.0780272782f, -0.136637658f, 0.0879627764f, -0.148396581f, 0.0909150839f, -0.198703557f, 0.0794022083f,
+    -0.0665340424f, 0.157356441f, 0.151783466f, -0.185980052f, 0.238651574f, -0.0867159963f, 0.120755374f, -0.188068509f,
+    0.0906782448f, -0.151189357f, -0.120933056f, -0.220885426f, -0.104749888f, -0.0082642436f, 0.195690274f, 0.209447026f,
+    0.240703166f, 0.152427346f, 0.158343971f, 0.175135165f, 0.218589246f, 0.235586703f, -0.0661707222f, 0.208064198f,
+    0.234782517f, 0.232179582f, -0.11896348f, 0.22980687f, -0.0116236806f, -0.0316679776f, 0.0704684556f, 0.199152797f,
+    0.236839175f, 0.0957734287f, -0.169532388f, 0.246867567f, 0.182777017f, 0.140325069f, -0.124489218f, -0.249862045f,
+    0.233453721f, 0.067371428f, 0.129200786f, -0.00381848216f, 0.209251881f, 0.217333734f, 0.16022867f, -0.132700235f,
+    0.197850883f, -0.0420659781f, -0.100680053f, 0.116199791f, 0.12067005f, -0.171148509f, -0.239765614f, -0.111999363f,
+    -0.0299565494f, -0.166862965f, -0.225027829f, 0.199246645f, 0.126583785f, 0.13215366f, 0.0262560844f, -0.188400745f,
+    0.163004339f, 0.225159913f, 0.0703438222f, -0.15386495f, -0.0300413668f, 0.158504039f, -0.0583183467f, -0.114738077f,
+    -0.158688396f, 0.165208429f, -0.0220414102f, 0.0284075439f, 0.0517041087f, 0.00214806199f, -0.232471973f, -0.0609024763f,
+    -0.247571677f, -0.199931115f, 0.237935543f, -0.249605417f, 0.10415864f, 0.188658774f, -0.108345687f, -0.124178886f,
+    -0.207680821f, -0.0648131967f, -0.177744299f, -0.107467055f, 0.0581174195f, -0.0725612342f, 0.077029407f, -0.164094806f,
+    0.143289387f, -0.117633283f, 0.213290215f, -0.169785589f, 0.0426696837f, -0.177651346f, 0.00848561525f, -0.0393590033f,
+    0.128969431f, -0.0119871199f, 0.0802207887f, -0.17506218f, -0.0363292694f, -0.104153812f, -0.170980513f, -0.164798796f,
+    -0.172956824f, 0.0297833085f, -0.0944623947f, 0.0291374624f, -0.220766127f, -0.14836818f, 0.204382658f, 0.169881701f,
+    0.035345614f, -0.0873026252f, -0.0327544212f, -0.12078011f, 0.0488328636f, 0.203490943f, -0.161726505f, -0.0860774815f,
+    -0.200715721f, 0.19543457f, -0.0492722392f, -0.0301059186f, -0.172096521f, -0.000313967466f, -0.155446291f, 0.0664368272f,
+    0.0976524055f, 0.159880728f, -0.179482847f, 0.0973343849f, -0.0588490069f, 0.0348905325f, -0.173028231f, 0.0241116583f,
+    -0.171654731f, 0.205265641f, -0.234409541f, 0.181153715f, -0.0247314274f, 0.206030011f, -0.144344985f, 0.0107417107f,
+    0.0289528072f, -0.162187636f, 0.0515824258f, 0.0388433039f, 0.167788982f, 0.159239143f, 0.102754176f, -0.0566813946f,
+    0.00458955765f, 0.0919138491f, -0.148115337f, 0.177569449f, -0.104788125f, 0.228165418f, 0.213890851f, 0.0293841064f,
+    -0.118694007f, -0.245452672f, 0.000323057175f, -0.223090112f, 0.139334351f, 0.0840189159f, -0.0676960647f, 0.0660673678f,
+    -0.0587601066f, -0.218957067f, -0.0342726707f, -0.129715443f, -0.124064893f, 0.0039537251f, 0.219668627f, 0.213369519f,
+    0.0939314365f, -0.164368421f, 0.00517392159f, -0.248775333f, 0.226761132f, -0.241399646f, 0.201201946f, 0.0644301474f,
+    -0.185882688f, -0.11251387f, 0.171925277f, 0.246730387f, -0.0350991786f, -0.0383429527f, 0.129482001f, -0.123886436f,
+    0.184300154f, -0.23504743f, 0.214688271f, -0.113588482f, 0.127193511f, -0.0369933248f, -0.0851902366f, -0.0668014884f,
+    -0.152468234f, -0.223108262f, -0.0941163301f, -0.0620371699f, 0.246176571f, 0.0177058876f, 0.156395465f, 0.100729048f,
+    -0.225996405f, -0.0715278983f, -0.114598185f, 0.248725176f, 0.17777586f, -0.248993844f, -0.242242247f, -0.187760085f,
+    0.120590657f, 0.151587993f, -0.222191393f, 0.0756851435f, -0.0686908662f, 0.249681741f, 0.233389884f, -0.223301739f,
+    -0.228401721f, 0.0771452785f, 0.151563466f, -0.00670287013f, -0.154877692f, -0.026481986f, 0.0663915277f, 0.062731266f,
+    0.196537137f, -0.0119998753f, 0.0116935372f, 0.164176017f, 0.0444702506f, -0.0330484509f, -0.114953458f, -0.226158917f,
+    -0.19165501f, 0.114068359f, -0.162877709f, -0.16058892f, 0.053257823f, -0.0866083503f, -0.0561902821f, -0.0599827766f,
+    -0.220665336f, 0.236743301f, -0.0768726468f, -0.0702486932f, 0.196932107f, -0.243091434f, 0.133363485f, -0.0501406491f,
+    -0.0732100904f, -0.0654897094f, 0.152478427f, 0.0090456903f, -0.102616936f, 0.0272054374f, -0.0506799221f, 0.0193324983f,
+    0.0742874444f, -0.0399843156f, 0.144133091f, -0.22731933f, 0.0972538888f, 0.22696808f, 0.0574880838f, -0.0695900917f,
+    0.107584298f, 0.134932846f, -0.0135217905f, 0.0963658392f, 0.142386734f, -0.160201609f, 0.141361535f, -0.0171574354f,
+    -0.106634945f, -0.0594943166f, -0.229694843f, 0.0617185533f, -0.0668366849f, 0.119992018f, -0.140699238f, 0.0486950874f,
+    -0.189765066f, -0.140979737f, 0.0588754416f, -0.219287127f, -0.196515054f, 0.220075011f, 0.160302579f, -0.0345233679f,
+    0.0411222875f, 0.0665151179f, 0.146125346f, 0.0766473413f, -0.0215126872f, 0.061496377f, 0.0942667723f, 0.147323996f,
+    0.16607523f, -0.123954743f, 0.0973040164f, -0.149926752f, 0.110900849f, -0.0133089423f, -0.167332262f, -0.130212605f,
+    0.0885771513f, 0.0207232535f, 0.0550279319f, 0.0827582479f, -0.0528652072f, 0.0475716591f, -0.0219073892f, -0.222472548f,
+    -0.0789239705f, 0.224441826f, -0.150066257f, 0.18095836f, -0.214021921f, 0.185629547f, 0.217622578f, -0.248557359f,
+    -0.0671697557f, -0.0728447139f, 0.232791215f, 0.0378323793f, -0.152965069f, -0.00883176923f, -0.172493309f, -0.129533172f,
+    0.0467002392f, 0.0383009613f, 0.0565647781f, 0.247961104f, 0.13771984f, -0.211620599f, -0.175262809f, -0.0427461565f,
+    0.200285077f, 0.138237327f, -0.19758004f, -0.17698881f, 0.117343247f, 0.0654327571f, 0.0197939575f, -0.0612986684f,
+    0.200861335f, -0.034098208f, 0.120098114f, 0.13516593f, 0.17867592f, -0.152554572f, 0.169870555f, -0.0278498828f,
+    -0.126226783f, 0.0648746192f, 0.187877893f, 0.0154713094f, -0.172678113f, -0.0187618136f, 0.209484458f, -0.00856980681f,
+    -0.0437750816f, -0.0745892227f, 0.242271602f, -0.0572322607f, 0.198108047f, 0.0383377969f, 0.0862908661f, -0.0253231823f,
+    0.0751253664f, 0.194498479f, 0.124668837f, -0.152166516f, 0.0174948573f, 0.116090834f, 0.019998014f, 0.00564980507f,
+    0.085097909f, 0.164241433f, -0.176542789f, -0.126396775f, -0.236045182f, -0.125799924f, 0.138578326f, -0.117728651f,
+    -0.201630294f, -0.0962018073f, -0.0613003373f, 0.185053885f, -0.00784778595f, -0.0874327421f, 0.0471187532f, 0.219581544f,
+    0.0486491323f, 0.0395648479f, 0.124692321f, -0.0620290935f, -0.113854587f, -0.0707562566f, -0.0281167924f, -0.201169848f,
+    -0.212727398f, -0.177081943f, 0.12074554f, 0.214614868f, 0.0380132198f, -0.0907835066f, 0.233303457f, -0.184201747f,
+    0.0400950015f, -0.0995542705f, 0.0369455218f, 0.126079857f, 0.0167143941f, 0.0979970098f, 0.209479243f, -0.0726298094f,
+    -0.23609978f, -0.0283786654f, -0.121742606f, -0.225440085f, 0.229754001f, -0.185973763f, -0.083740294f, -0.106811523f,
+    -0.169482678f, 0.0113866627f, 0.0404490232f, -0.20134896f, 0.186993897f, -0.0345904529f, -0.0602381527f, 0.23626411f,
+    -0.0766510665f, -0.0532406867f, -0.0941333771f, 0.0141154826f, -0.134416908f, 0.0703014135f, 0.11763683f, 0.244924337f,
+    0.113857806f, 0.0927244425f, -0.149628282f, 0.14116624f, 0.204592913f, -0.160399258f, -0.132613361f, 0.049516499f,
+    -0.0842832029f, -0.060251236f, -0.20526427f, -0.247751206f, -0.0833539069f, -0.249780834f, -0.109716564f, -0.232370108f,
+    0.0779299438f, 0.0875231028f, 0.0537662804f, 0.164583653f, 0.247377753f, -0.0468043387f, -0.00258374214f, 0.158600152f,
+    -0.171889454f, -0.0223782957f, -0.131546617f, -0.193848252f, -0.0796198249f, -0.150552362f, -0.225918889f, -0.197900802f,
+    0.0770497322f, -0.0531408191f, 0.101341784f, -0.207993835f, 0.0771778822f, 0.197238833f, -0.233965933f, -0.00121331215f,
+    0.103803098f, 0.147203118f, 0.19755426f, 0.204607725f, -0.239609838f, 0.0721726418f, 0.199115366f, -0.149638534f,
+    0.0713323951f, 0.0347076356f, 0.000474125147f, -0.0243538916f, 0.00908565521f, -0.216570109f, 0.229052663f, 0.208815157f,
+    -0.0103954077f, -0.189200938f, 0.248555094f, -0.0080589056f, 0.0119601786f, 0.200571954f, -0.136790216f, -0.209038585f,
+    0.0855232179f, 0.0945345461f, 0.0242956877f, -0.112643003f, 0.0933559537f, 0.213070542f, 0.0347143412f, 0.113082618f,
+    0.239261001f, 0.171757787f, 0.043340981f, -0.206287771f, 0.117239594f, 0.0219658613f, -0.226210803f, -0.123139501f,
+    -0.0306843519f, -0.248346776f, 0.226491541f, -0.0607984662f, 0.0557727218f, 0.0942805707f, 0.172801733f, 0.0781532228f,
+    0.244599462f, 0.0363594294f, -0.0686837137f, 0.138341784f, -0.246578634f, -0.0675052106f, -0.0390688479f, -0.12730661f,
+    0.185400724f, -0.0161108375f, 0.228000313f, 0.138506919f, -0.237727791f, -0.233594954f, -0.147019207f, -0.0194581747f,
+    0.23322472f, -0.067856282f, -0.0822871327f, -0.0101048648f, -0.175209403f, -0.0313921869f, 0.175625235f, 0.0807879269f,
+    -0.103070349f, -0.134391874f, -0.212856025f, -0.144387126f, 0.241499543f, -0.11634922f, -0.0222500861f, -0.0639041364f,
+    -0.118655115f, -0.196499765f, 0.0106105208f, 0.0200598538f, -0.204246908f, -0.0546015203f, 0.163762659f, -0.179079622f,
+    0.127386332f, -0.173766017f, -0.0950625539f, -0.0570813715f, -0.163073778f, 0.0756987035f, -0.160941362f, -0.0178338289f,
+    -0.169072092f, -0.0393275917f, -0.131636381f, 0.190447181f, -0.036578238f, -0.0639802814f, 0.217881829f, -0.128664702f,
+    0.102114916f, 0.051695168f, -0.0214011073f, 0.193363994f, 0.0658629537f, 0.18846184f, -0.176042736f, -0.00697383285f,
+    -0.00566568971f, -0.129666746f, 0.0516795814f, -0.0916835964f, 0.04759413f, -0.126719117f, -0.109912068f, 0.175605297f,
+    -0.0125959516f, -0.0972648561f, 0.147190988f, 0.134612679f, -0.130535334f, 0.132818818f, -0.121344358f, -0.0720359087f,
+    0.0513194501f, -0.216934443f, 0.0181446373f, -0.0206137002f, 0.0704280734f, -0.159176379f, 0.236498475f, 0.195401996f,
+    0.0720772445f, 0.153766185f, 0.0361939073f, -0.167144477f, 0.244653553f, -0.0390884578f, -0.133105993f, 0.0509686172f,
+    0.0406180024f, -0.209402293f, 0.0985614955f, -0.174756885f, 0.0156950355f, -0.0185598433f, -0.128075927f, -0.167903304f,
+    -0.244397581f, -0.201128125f, -0.0738680363f, -0.161942035f, -0.111469597f, -0.24321425f, 0.217737257f, 0.183936268f,
+    0.197303712f, 0.130662978f, 0.158373147f, -0.15094313f, 0.10486117f, -0.139439583f, 0.136634648f, 0.159213871f,
+    0.160288721f, 0.23262468f, -0.196314037f, -0.0758023262f, -0.241836309f, 0.144923449f, 0.00907632709f, 0.193245023f,
+    0.170154095f, 0.112090915f, 0.239349097f, -0.118818074f, 0.166096091f, -0.167220622f, 0.133876115f, 0.22426945f,
+    0.0348643064f, -0.195632964f, -0.0305603445f, 0.149940342f, -0.166361213f, -0.153963506f, 0.0177878737f, 0.240050226f,
+    -0.154515445f, 0.233626664f, 0.108091682f, -0.249268651f, 0.058013618f, 0.0831835866f, 0.0371662974f, 0.170367867f,
+    0.018394053f, -0.0861884058f, -0.0299146771f, 0.103232741f, -0.052051425f, 0.00216338038f, 0.0857702494f, 0.240899444f,
+    -0.0130184293f, -0.087018311f, -0.184972733f, -0.0597731173f, 0.0874918103f, 0.235907465f, -0.112871647f, -0.19537434f,
+    0.200194359f, 0.202904552f, 0.177768439f, -0.108351499f, 0.0879694223f, -0.057839185f, 0.104192078f, -0.041413486f,
+    -0.227388591f, 0.214074105f, 0.133684397f, -0.0549592078f, -0.0882588625f, -0.0640177131f, 0.085708946f, 0.0114386082f,
+    0.0856824815f, 0.116392434f, 0.194442779f, -0.17023322f, -0.14207387f, -0.024587512f, 0.102697611f, 0.244337052f,
+    -0.161006957f, 0.156345963f, 0.133653313f, -0.117670685f, 0.0753933191f, 0.132574946f, 0.18760702f, 0.00230875611f,
+    -0.189452738f, 0.182539493f, -0.144494474f, -0.0709637403f, -0.0222252309f, -0.239182562f, -0.0631625056f, 0.140765488f,
+    0.183604479f, -0.233008295f, 0.217496336f, 0.191166312f, -0.157172769f, 0.0208192468f, 0.243641078f, 0.146055967f,
+    -0.0509842038f, -0.205873162f, 0.00262841582f, 0.0933848023f, 0.0192787349f, 0.0224015713f, 0.0465815365f, -0.196923882f,
+    0.180665582f, -0.0328306854f, 0.0645671785f, 0.0776564479f, -0.247159451f, -0.142770857f, 0.199892312f, 0.230821699f,
+    -0.189683139f, -0.0966598988f, 0.0637179315f, -0.173821688f, -0.133358598f, 0.233944923f, 0.182654083f, -0.172421992f,
+    -0.117304444f, -0.0626328886f, -0.0180015266f, -0.223062634f, -0.0927610993f, 0.202419907f, -0.219596744f, 0.21286276f,
+    -0.214117706f, 0.183791935f, 0.206881464f, 0.0733000934f, -0.220438927f, 0.0376100242f, -0.148169935f, 0.100262314f,
+    0.136022121f, -0.245808095f, -0.03402403f, 0.177729309f, -0.149684042f, -0.0752872825f, 0.127440512f, -0.00833043456f,
+    -0.0802296698f, -0.140050113f, 0.109546006f, -0.145251095f, 0.2119627f, 0.00582000613f, -0.216227472f, -0.0212328434f,
+    0.0636234283f, 0.0673110187f, 0.00619584322f, -0.210844934f, 0.0738839209f, -0.197297513f, -0.0302385986f, -0.108962893f,
+    -0.0866318345f, -0.107416779f, -0.119003475f, 0.142334968f, 0.144686997f, -0.0153367221f, 0.111093223f, -0.156088144f,
+    0.186954051f, -0.222254634f, 0.181272238f, -0.14945066f, -0.0771313012f, 0.0243674219f, -0.111180097f, 0.0650991499f,
+    -0.148142904f, 0.0370167196f, -0.00878152251f, -0.0577656627f, -0.127937257f, 0.0842477381f, -0.143994212f, 0.154535115f,
+    0.129345179f, 0.145192325f, 0.062238425f, -0.0864650309f, -0.0373396873f, 0.155787647f, 0.00893771648f, 0.0904639065f,
+    0.185980588f, -0.144074082f, 0.0191953182f, -0.0693103671f, -0.0580624938f, 0.0807892084f, -0.233701348f, 0.0196292996f,
+    0.13095209f, -0.0492195785f, -0.0716052949f, -0.18031323f, -0.13078323f, -0.125414878f, -0.0564454198f, -0.0453956127f,
+    0.0363380611f, -0.0846384168f, 0.0771131217f, -0.103287488f, -0.138355106f, 0.0822644532f, -0.0964682996f, -0.223110348f,
+    0.0947609544f, -0.176571071f, -0.230857372f, 0.0492845178f, -0.235196233f, 0.23216185f, 0.00925603509f, -0.167512029f,
+    0.196243942f, 0.0597695112f, -0.201140702f, 0.146145672f, 0.162878335f, 0.156203628f, 0.211095244f, -0.226263493f,
+    0.227712452f, 0.0902035832f, 0.131666273f, 0.0416169763f, 0.22008279f, 0.0182515979f, -0.0893712044f, 0.196517617f,
+    -0.0771949887f, -0.140999407f, 0.0128520727f, 0.223313183f, 0.246013016f, 0.175540924f, 0.229376316f, 0.0158659816f,
+    0.0479274094f, -0.186910152f, 0.0776355565f, -0.223812282f, -0.202473223f, 0.156406343f, 0.124496251f, -0.0844937861f,
+    -0.183139116f, -0.218065411f, 0.204841197f, -0.202750623f, -0.104113817f, -0.0183469057f, -0.241015881f, 0.142671853f,
+    -0.0585812032f, -0.235790223f, 0.0558221042f, 0.0490943193f, 0.16757974f, 0.11092329f, -0.154627025f, -0.188811719f,
+    0.186087608f, 0.175087929f, -0.0807301402f, -0.083126843f, 0.0965003371f, -0.141118228f, 0.207262665f, -0.067789048f,
+    -0.0840375423f, 0.0745114088f, 0.211233377f, 0.163120925f, 0.234948277f, 0.0411469936f, -0.0585871935f, 0.162717253f,
+    -0.21366179f, 0.117421031f, -0.220573485f, 0.0538344681f, -0.00668221712f, -0.0830955505f, 0.0604467988f, 0.0743941069f,
+    0.0523554981f, 0.117339522f, -0.0526554883f, 0.145125955f, -0.155401349f, -0.20513761f, 0.217066199f, 0.193509042f,
+    -0.0594047606f, 0.0788100958f, -0.0917528868f, -0.155662864f, 0.195970893f, -0.148450673f, -0.205190152f, -0.0740243196f,
+    -0.0798594952f, -0.0592637956f, -0.0568759143f, -0.0722198784f, 0.105172753f, -0.0225720108f, 0.086288929f, -0.0308965743f,
+    0.0854712427f, -0.173002064f, 0.0476659536f, 0.0792863071f, 0.128229767f, -0.207474321f, 0.0613749027f, 0.0926918387f,
+    -0.234621525f, -0.134047806f, -0.137593299f, -0.047470212f, -0.183719963f, 0.218485206f, -0.0713950694f, 0.0485089123f,
+    -0.0869120657f, -0.0361957252f, -0.107444733f, -0.131275833f, -0.186946422f, 0.235728055f, -0.201483548f, -0.0776750445f,
+    0.0389540195f, 0.204745531f, 0.0754110813f, 0.157356679f, 0.143544883f, -0.0317444205f, 0.201122284f, 0.11514163f,
+    0.235595047f, 0.20276615f, 0.0879151523f, 0.213777065f, -0.2074368f, -0.157836199f, -0.241479337f, 0.239921749f,
+    0.0943183005f, -0.188320637f, 0.202466905f, 0.178046256f, 0.249901742f, -0.0655306876f, -0.142993361f, 0.0159308314f,
+    -0.0379321575f, 0.144077152f, -0.18501395f, 0.236785412f, -0.24456659f, 0.028426975f, -0.161477476f, 0.144115835f,
+    -0.0498758852f, -0.0656893551f, -0.170457482f, 0.0270797312f, 0.205152571f, -0.00249457359f, 0.058876574f, 0.0163454115f,
+    -0.0650767982f, -0.155023813f, 0.248231709f, -0.0292972326f, -0.0547810793f, 0.222622722f, -0.241488606f, 0.126206756f,
+    0.200575441f, 0.113123596f, 0.228524923f, 0.0716449022f, 0.0440918803f, 0.146137208f, 0.0494603515f, -0.0991370082f,
+    0.0950509012f, 0.11599791f, 0.0923622549f, 0.144986778f, -0.0350110531f, -0.0160787404f, -0.23880744f, -0.126057625f,
+    -0.118503153f, -0.122849971f, 0.152702004f, -0.0825459063f, 0.00281608105f, 0.0719674528f, -0.126032561f, -0.237808198f,
+    0.122417063f, -0.000892788172f, 0.237623066f, 0.168087602f, -0.217377901f, -0.123783261f, 0.15708679f, 0.138784349f,
+    0.0960743427f, -0.107026786f, 0.0875813961f, 0.0140008926f, -0.027703613f, 0.0131364763f, -0.190349072f, 0.10639447f,
+    -0.0189775825f, -0.0155087709f, -0.164628655f, -0.0314725041f, 0.20215255f, -0.155231804f, -0.0445608795f, -0.0569248497f,
+    0.0651788116f, 0.117721051f, -0.0551509559f, -0.117609084f, -0.0548356175f, 0.101917028f, -0.187238514f, 0.0273928642f,
+    0.222205937f, -0.0445705652f, -0.195656836f, -0.226491988f, 0.236020982f, -0.202122748f, -0.202746719f, -0.211167306f,
+    0.221974254f, -0.168654293f, -0.00706359744f, -0.23164767f, -0.019139111f, 0.0109603703f, -0.0650763512f, 0.158695042f,
+    0.133812815f, 0.181218773f, -0.00370821357f, 0.0307302177f, 0.236771345f, 0.00280818343f, -0.0807593465f, -0.231257081f,
+    -0.100133866f, -0.155233473f, 0.0931845307f, -0.0897062421f, 0.0323091447f, -0.158078045f, -0.0507607758f, -0.157531828f,
+    -0.239239216f, 0.123592645f, -0.00792425871f, 0.0977960527f, 0.00087839365f, 0.0611851811f, -0.195111662f, 0.229118019f,
+    -0.216680139f, -0.129480481f, 0.190210342f, 0.13081789f, 0.153680563f, 0.215553343f, -0.215585113f, 0.0327266753f,
+    -0.0880548954f, -0.239581376f, 0.120422751f, 0.0711531937f, -0.243813872f, -0.188457102f, -0.0239324868f, 0.129904866f,
+    -0.100206167f, -0.0414390564f, 0.117905885f, -0.211620778f, 0.148932964f, -0.1340698f, 0.0195143223f, -0.169383496f,
+    0.132009f, 0.24288553f, 0.00224554539f, 0.178982586f, 0.0714467764f, -0.14181295f, -0.136238039f, 0.166629732f,
+    0.160069197f, -0.238196492f, 0.094669044f, 0.165699214f, 0.0317824185f, -0.190736771f, -0.133920938f, 0.224422157f,
+    -0.130522877f, 0.0651386082f, -0.174225807f, 0.210601419f, 0.0334000587f, -0.145270973f, 0.0300609469f, 0.243804455f,
+    -0.149667412f, -0.130447954f, -0.156751126f, 0.0754959881f, -0.161871791f, 0.173260838f, 0.152787656f, 0.102868438f,
+    0.141554266f, -0.186900109f, -0.00134432316f, -0.0873293281f, -0.231686205f, 0.0959262848f, -0.149630994f, -0.171968162f,
+    0.198316544f, -0.107895195f, -0.232569575f, 0.216692418f, -0.036776185f, -0.0697768033f, -0.132599384f, -0.0303083658f,
+    0.0565741956f, -0.171143025f, -0.0886119008f, 0.0436899066f, 0.230563343f, 0.151265353f, -0.190162569f, 0.0593333244f,
+    -0.206969231f, 0.143057287f, -0.129215956f, 0.137956828f, 0.11951369f, -0.12068361f, 0.0102926195f, -0.190577716f,
+    -0.161420554f, -0.136948824f, -0.116204888f, 0.151987791f, 0.0121857226f, 0.192378551f, 0.151978672f, 0.20921278f,
+    0.211670041f, 0.171150088f, 0.198456615f, -0.230565548f, -0.0859725475f, -0.0394506156f, -0.159011066f, 0.139718175f,
+    -0.037045151f, -0.101576388f, -0.216240942f, -0.205445379f, 0.0855025351f, 0.131969541f, 0.232147247f, -0.14873898f,
+    0.174313992f, -0.035120368f, 0.0240413845f, -0.175014049f, 0.0622441769f, -0.0610986352f, 0.0929679573f, -0.139478475f,
+    0.122394115f, -0.00668931007f, -0.223928988f, 0.102775455f, 0.051674962f, -0.225022018f, 0.00856199861f, 0.171473563f,
+    -0.235767961f, -0.0898017287f, 0.0392396152f, 0.140165478f, 0.0555441082f, -0.0575711429f, 0.181694716f, -0.215353101f,
+    -0.220460922f, 0.207156181f, 0.236384809f, -0.0559764206f, 0.21652323f, -0.0177859962f, 0.096372366f, -0.0916922092f,
+    -0.203097343f, 0.220491111f, -0.223071158f, 0.1865924f, -0.128653049f, -0.153365225f, -0.185634375f, -0.0255063474f,
+    -0.172314495f, -0.0790856481f, -0.195162207f, -0.19888708f, 0.0746107101f, 0.0653860569f, 0.0446679294f, 0.134948403f,
+    0.149717242f, -0.181839764f, 0.196135342f, -0.078926146f, -0.232582837f, 0.134253085f, -0.0315277874f, -0.168812841f,
+    0.0237742662f, -0.0166793168f, -0.197367519f, -0.178120285f, -0.165738702f, 0.185468793f, 0.214490324f, -0.234076291f,
+    0.00511267781f, 0.0346191823f, -0.085924983f, -0.0114062726f, 0.00935149193f, 0.213767827f, 0.242502451f, 0.0253564417f,
+    0.18669948f, -0.0662412941f, 0.158124149f, 0.0406180918f, 0.0257481933f, 0.189964205f, 0.0195205212f, 0.213498831f,
+    -0.180907935f, 0.117967725f, -0.0778619051f, 0.189215869f, 0.036265105f, 0.153488487f, 0.171967447f, -0.222784013f,
+    -0.0915084183f, -0.188824713f, -0.00913533568f, -0.128248185f, -0.240070969f, -0.0712486804f, -0.248457253f, -0.0862008929f,
+    0.165649325f, -0.0386675894f, 0.212735742f, 0.164501965f, 0.136662573f, 0.184005409f, 0.0529559255f, 0.0849892795f,
+    -0.224582314f, -0.0954972506f, 0.184987128f, 0.0805960894f, 0.217226863f, 0.0551123619f, -0.159628034f, 0.14464283f,
+    -0.174751699f, -0.0255902708f, -0.0650250018f, 0.0822069645f, 0.0786836445f, -0.17310217f, 0.079305619f, -0.0804416537f,
+    0.157730877f, 0.0555572212f, -0.177256763f, 0.142644346f, -0.146664739f, 0.206398427f, 0.0434769094f, -0.0381683707f,
+    -0.100743979f, 0.225559354f, -0.169995874f, -0.220883697f, -0.164005697f, 0.180488795f, -0.219529659f, 0.0428007245f,
+    -0.220111251f, 0.126821548f, 0.210942f, -0.216451257f, -0.0201491714f, -0.00193631649f, 0.119617343f, 0.135926396f,
+    -0.0824498534f, 0.223497301f, 0.0227085948f, -0.0964041054f, 0.120654881f, 0.0942233801f, 0.105884314f, 0.173641294f,
+    -0.0748293698f, 0.0682864189f, 0.194497138f, 0.125259191f, -0.102394134f, -0.125734806f, -0.18176806f, -0.0269773901f,
+    0.216645002f, -0.0305777788f, -0.17784819f, 0.0899370015f, 0.0151717365f, -0.106626272f, -0.232216775f, -0.237515002f,
+    -0.0787030756f, -0.164877981f, -0.00615671277f, 0.0593935549f, -0.223640919f, 0.202841014f, 0.125398606f, 0.165666997f,
+    0.00361809134f, -0.179751784f, 0.0189477503f, 0.0653725863f, -0.0940172076f, 0.227377087f, -0.023678273f, 0.201551586f,
+    0.0523783267f, 0.143059492f, -0.0773913264f, 0.0363762379f, 0.230005294f, -0.157222211f, 0.145783395f, 0.229043275f,
+    -0.202061802f, -0.0199835002f, 0.174809456f, -0.0210055709f, 0.0277895927f, 0.140399575f, 0.0704401731f, -0.0724689364f,
+    0.113810956f, -0.0307749212f, -0.151202589f, 0.193092465f, 0.00436341763f, 0.173341006f, 0.101139009f, 0.137080252f,
+    0.0214170218f, -0.184756547f, 0.0838634372f, 0.00533044338f, 0.208743423f, 0.13155362f, 0.0310774148f, 0.00206309557f,
+    0.0214841366f, -0.0610328913f, 0.237499237f, 0.129420757f, 0.164911985f, 0.197328955f, 0.0488690734f, -0.00568830967f,
+    0.144888788f, 0.238801956f, 0.2117607f, 0.186286658f, -0.163655549f, 0.00338965654f, 0.22171995f, 0.116206616f,
+    -0.11360389f, -0.185664117f, -0.0442869067f, 0.188757956f, -0.16317147f, 0.22651881f, -0.054278791f, -0.0900874138f,
+    0.194568634f, 0.062417388f, -0.114109844f, -0.0996193588f, -0.165109634f, -0.105361164f, 0.201286882f, -0.182907224f,
+    0.204889268f, -0.13483274f, -0.163451016f, 0.0383479893f, -0.0153677464f, 0.0371085405f, -0.24140951f, -0.228491753f,
+    -0.16608724f, -0.0243424475f, -0.228567779f, -0.12758559f, -0.236626178f, 0.193945915f, 0.241033971f, -0.227552652f,
+    -0.00361853838f, 0.171095312f, 0.238935053f, -0.0542716384f, 0.213046759f, 0.10167411f, -0.0478754044f, 0.129532278f,
+    0.24818328f, 0.236533403f, -0.192441106f, 0.0347433388f, 0.121286988f, -0.200425386f, -0.180533528f, 0.22201094f,
+    0.0901744068f, 0.187413752f, -0.0370222032f, -0.0880409777f, 0.00392350554f, -0.208704203f, -0.173810154f, 0.0845634043f,
+    -0.223641545f, 0.0973245502f, -0.0105083883f, -0.0269105136f, 0.0937250555f, -0.1264292f, 0.0453636646f, -0.146533698f,
+    0.135553509f, -0.214160621f, 0.158843905f, -0.152372181f, -0.078494221f, -0.0375024676f, -0.00525274873f, 0.133996814f,
+    -0.0982660949f, -0.158234984f, 0.0228788555f, -0.142427027f, 0.0291467905f, 0.139856726f, 0.228338361f, -0.231137544f,
+    0.129333645f, 0.104293883f, -0.202419251f, -0.0400947034f, -0.154086262f, -0.134855151f, 0.030382067f, 0.109886467f,
+    -0.230789691f, 0.156648815f, 0.16306752f, -0.00809937716f, -0.0320078433f, 0.232745647f, 0.0201858282f, 0.239651293f,
+    0.179835021f, -0.0705066025f, 0.0994275212f, -0.178361952f, -0.126430213f, -0.214160472f, -0.0274349153f, 0.241215765f,
+    0.217945725f, -0.116270512f, 0.201579481f, 0.119313657f, -0.00385445356f, 0.170697361f, -0.0901435912f, -0.203093469f,
+    0.0152857006f, -0.0875297785f, 0.0530895591f, 0.201278687f, 0.193123579f, -0.0382319391f, -0.0741036236f, 0.150338024f,
+    -0.218457937f, -0.158582479f, -0.239159495f, 0.103213102f, -0.0853539705f, -0.233194351f, 0.0850196481f, 0.186679155f,
+    0.079090178f, 0.199159861f, 0.163698882f, 0.0756951869f, -0.0838097036f, 0.187628776f, -0.179989457f, 0.12982294f,
+    -0.233789206f, -0.202987581f, -0.164889336f, -0.189205438f, 0.225070447f, -0.24598214f, -0.141385078f, 0.0952580869f,
+    0.249594569f, 0.18670544f, -0.14331764f, 0.125757486f, -0.107989639f, -0.0572264791f, -0.0857614875f, 0.21884951f,
+    0.202993423f, -0.229532152f, 0.0238398015f, -0.213738829f, -0.0314305425f, 0.0499949455f, -0.165247887f, -0.209874123f,
+    -0.156995326f, 0.170201212f, 0.1395863f, -0.0703062117f, 0.157623768f, -0.0506566465f, -0.2462098f, 0.140890151f,
+    -0.249553949f, 0.00316360593f, 0.139999866f, -0.221541405f, 0.175974756f, -0.160540789f, 0.194166809f, -0.0175099373f,
+    -0.0211256146f, -0.0327813327f, 0.210227847f, 0.0573601723f, -0.127644181f, 0.0193567872f, -0.137686729f, -0.0964819789f,
+    0.105595231f, -0.132648766f, -0.223314077f, 0.214391291f, 0.0865436792f, -0.114153862f, 0.100411385f, 0.218025714f,
+    0.204319358f, -0.161762297f, -0.2380988f, 0.227518439f, -0.0565902591f, 0.062014401f, -0.110102475f, -0.0857865512f,
+    0.222119957f, -0.215153486f, -0.0538487434f, 0.210278511f, -0.121231407f, -0.0866598785f, 0.103904873f, -0.049269706f,
+    -0.162352622f, 0.0740306973f, 0.082917273f, 0.027305007f, 0.0597369969f, -0.133222848f, 0.162711114f, 0.214260608f,
+    -0.0513370037f, 0.138881117f, 0.226502091f, 0.212245494f, -0.00981560349f, 0.100272745f, -0.139193743f, -0.148342133f,
+    -0.033351481f, 0.0813689232f, 0.0251409113f, -0.0667231977f, 0.037653774f, 0.0436125398f, 0.218357503f, -0.0814227462f,
+    0.0756243467f, -0.0585179329f, -0.229493082f, 0.00643724203f, 0.13017872f, 0.0483441353f, -0.158166766f, 0.0693475008f,
+    0.0549052954f, -0.237543195f, 0.187253773f, -0.197761834f, -0.0893498957f, -0.0999466777f, -0.247025162f, 0.182706714f,
+    -0.0275568664f, -0.0363929868f, 0.00796797872f, 0.225732654f, -0.209656119f, -0.123875141f, -0.0668202937f, -0.166235149f,
+    0.245264202f, 0.120024979f, 0.086568892f, 0.0545083582f, 0.0239050388f, 0.0629739463f, 0.1350483f, 0.230716407f,
+    -0.127592832f, -0.0700074732f, -0.19635573f, 0.00614777207f, -0.0963332653f, -0.17567727f, -0.242214441f, -0.205139548f,
+    -0.191855401f, -0.153695911f, -0.142527461f, -0.163561106f, -0.0262470245f, -0.226683527f, -0.178734899f, -0.23998192f,
+    -0.0337664485f, -0.0771373212f, 0.0790624022f, -0.0760959089f, 0.243446499f, -0.131763518f, -0.182345927f, -0.204141825f,
+    0.11932829f, 0.153744161f, -0.100898921f, -0.223233342f, 0.233806729f, 0.245890051f, 0.043531388f, 0.123617917f,
+    -0.174563855f, 0.177766353f, -0.204094946f, -0.216078371f, -0.0750302374f, -0.101276308f, -0.16757077f, -0.178031504f,
+    0.198403329f, 0.139315367f, -0.0146924555f, -0.0463280976f, -0.153969705f, 0.194279343f, -0.110771835f, 0.06603688f,
+    -0.138626903f, -0.24487257f, -0.125661522f, -0.00430297852f, 0.050336659f, 0.035535574f, 0.138705522f, -0.10654074f,
+    -0.0810192823f, 0.0263984501f, -0.0856169164f, -0.241395593f, -0.127467841f, 0.116271466f, 0.235134274f, 0.11794886f,
+    0.190427333f, -0.137001097f, -0.0379652977f, -0.208393186f, -0.0156745911f, -0.18494457f, -0.201138228f, 0.0545117259f,
+    -0.105939209f, -0.176959395f, -0.084104389f, 0.0080216229f, -0.243331879f, -0.072876215f, 0.187635154f, -0.194630235f,
+    -0.01494506f, -0.110005379f, -0.036108017f, 0.128362775f, -0.150735974f, 0.186367929f, 0.131978095f, 0.0876484811f,
+    0.0276069641f, 0.230279088f, -0.0851782858f, -0.16002202f, -0.231467813f, 0.0254631937f, 0.205965489f, 0.119356811f,
+    -0.163185745f, -0.0454798043f, -0.149154484f, 0.226092994f, 0.129216999f, -0.138200581f, 0.166807324f, 0.194572359f,
+    -0.0536806285f, -0.0158275366f, 0.172382593f, -0.179965317f, -0.117497236f, 0.174904346f, -0.218530655f, -0.237859786f,
+    -0.108654767f, -0.0588622093f, 0.166531533f, 0.242922217f, 0.00705349445f, -0.0460611582f, 0.064586401f, 0.123747528f,
+    0.223209262f, -0.0516242087f, 0.0151898265f, 0.240498394f, -0.124730796f, -0.203341246f, 0.100071728f, 0.120172441f,
+    0.249576151f, -0.159303367f, 0.144586653f, -0.05545941f, -0.234394401f, -0.118472636f, -0.0189036727f, 0.0297751129f,
+    -0.024948895f, 0.200238913f, 0.0703404546f, 0.00442641973f, -0.233094096f, 0.0662011206f, 0.215736866f, -0.202870756f,
+    -0.0103262663f, 0.249295592f, 0.125866115f, -0.140344322f, -0.020099014f, -0.0696419179f, -0.104754597f, 0.0428568125f,
+    -0.0406026244f, -0.183761597f, 0.102534384f, 0.232875854f, -0.231467515f, 0.0564002991f, 0.0140227377f, -0.13071698f,
+    -0.209996551f, 0.126233429f, 0.159902513f, 0.0248153508f, 0.130870581f, 0.209419012f, -0.0247682333f, 0.240363479f,
+    -0.057875365f, -0.0928897858f, -0.158632874f, 0.0477016866f, -0.107437432f, -0.174848497f, -0.137671649f, -0.00718581676f,
+    0.161958009f, 0.00300392509f, 0.239082724f, 0.0885951817f, 0.0386672616f, 0.116304427f, -0.137524217f, -0.091535598f
+}; // Gemm /denseIn/Gemm weights [16, 320]
+alignas(16) static const float c3[320] = {
+    -0.0671843588f, 0.0813004375f, 0.164490074f, 0.218691707f, 0.00839045644f, -0.00566250086f, 0.161641389f, -0.192669511f,
+    0.0769391954f, -0.0956663489f, 0.027531147f, 0.191601813f, -0.163549542f, 0.00186038017f, 0.133111924f, -0.137473166f,
+    -0.0238378048f, -0.201145947f, 0.0873052776f, -0.0334933698f, 0.237612605f, -0.0459057987f, 0.238542259f, 0.0474033952f,
+    0.176229388f, 0.224915445f, -0.198038667f, 0.0163806975f, 0.149111748f, -0.0100669265f, -0.219582886f, -0.0445582271f,
+    -0.0709174573f, 0.0198585093f, 0.0805663466f, -0.0952790678f, -0.155816942f, -0.205696911f, 0.00470659137f, 0.218745261f,
+    0.207330227f, 0.130981386f, 0.0262621045f, 0.0436684191f, -0.20787704f, 0.0506717563f, 0.190432489f, -0.0807897747f,
+    -0.172863066f, 0.0335797369f, -0.0989151299f, -0.0107552111f, -0.0412802696f, 0.0536535978f, -0.238372743f, -0.0839262903f,
+    0.110100925f, 0.0293027461f, -0.0222502947f, -0.00838142633f, 0.153391868f, 0.162696958f, 0.0281811357f, 0.129501343f,
+    -0.104209751f, -0.15013361f, -0.212514132f, -0.182249397f, 0.0574860275f, 0.249813974f, -0.0073299706f, 0.16991061f,
+    -0.141319215f, 0.125360519f, -0.11978215f, -0.144176871f, -0.158556819f, -0.167842746f, 0.0949956477f, -0.159728736f,
+    0.122679085f, -0.102105319f, 0.188333452f, 0.00424894691f, -0.0052292943f, -0.228074312f, -0.111942649f, 0.21874404f,
+    -0.171194464f, 0.21429202f, 0.166241378f, -0.239565343f, -0.164159834f, 0.00282028317f, -0.00920081139f, -0.0493803322f,
+    -0.152613133f, 0.188566834f, -0.0608913302f, -0.21740973f, -0.0808708966f, 0.0832609236f, -0.101677418f, 0.199521124f,
+    -0.0879457295f, 0.00267055631f, -0.208118618f, 0.0295857787f, -0.0256119668f, 0.0506327748f, -0.246954948f, -0.0449796319f,
+    -0.188351065f, 0.161122352f, -0.185414374f, 0.208791137f, -0.242271453f, 0.136665255f, -0.231096029f, -0.0724057555f,
+    -0.124403387f, -0.205505878f, 0.103954643f, -0.0784259439f, -0.0973607898f, -0.228478789f, -0.118528426f, -0.212491363f,
+    0.22021538f, 0.0957569778f, -0.00103712082f, 0.0470227003f, -0.218355268f, -0.192759395f, -0.102147639f, -0.175442457f,
+    -0.120729804f, 0.239884555f, -0.184367925f, 0.249506474f, 0.0232494473f, -0.115888327f, -0.0662200749f, 0.204621464f,
+    -0.111850947f, 0.0738045871f, 0.0330065787f, 0.0714399815f, 0.134252071f, -0.185083598f, 0.246198893f, -0.19657281f,
+    -0.245292395f, 0.166572064f, -0.105685622f, 0.0486274362f, 0.214939415f, 0.115886122f, 0.0233381987f, 0.00687617064f,
+    0.120854378f, 0.230048656f, 0.176730901f, -0.127597809f, 0.179003298f, -0.209546357f, 0.158569247f, -0.154949725f,
+    0.00401994586f, -0.213262767f, -0.119618028f, 0.228817642f, -0.227536231f, 0.181206226f, -0.00962686539f, 0.069588244f,
+    0.215804636f, -0.177701652f, -0.0406883359f, -0.229514837f, 0.112072259f, 0.0796594918f, -0.186902553f, 0.155554593f,
+    0.213252783f, 0.167286456f, 0.113905787f, -0.212822855f, 0.234381497f, 0.218503952f, -0.193763435f, -0.129198045f,
+    0.0685238242f, 0.168281972f, 0.0584644079f, -0.0595636964f, 0.116362005f, 0.136765063f, -0.00350815058f, -0.24374631f,
+    -0.244126141f, -0.145750612f, -0.0469915271f, 0.229336143f, 0.202255607f, -0.0801235437f, 0.15441519f, -0.0982642174f,
+    -0.148759246f, 0.0201683342f, -0.196076065f, 0.0960996747f, 0.1043562f, -0.0438670814f, 0.00544157624f, -0.19264406f,
+    -0.153773457f, -0.0119784772f, -0.110298634f, 0.026065737f, 0.0633416474f, 0.0653236806f, -0.244399786f, 0.113782495f,
+    -0.24528107f, 0.148971081f, -0.0805499554f, -0.136384726f, 0.0183134377f, -0.17655769f, 0.158060104f, 0.0637242496f,
+    -0.0496330261f, 0.206185639f, 0.129877537f, 0.247220218f, -0.0503484607f, 0.142961681f, 0.167468935f, 0.0945384204f,
+    0.196592927f, -0.146824956f, 0.248424649f, -0.170372397f, -0.244875401f, 0.124279767f, 0.0633205771f, 0.0321712196f,
+    -0.144415975f, 0.231359214f, 0.0597079098f, -0.228001088f, 0.144277751f, 0.118116945f, 0.00744479895f, -0.208309084f,
+    -0.0956727564f, 0.00846505165f, -0.158132404f, -0.0583315492f, 0.0454487801f, 0.0896869302f, 0.151149035f, 0.164450347f,
+    0.123305291f, 0.0894215703f, -0.0166125298f, 0.137335598f, 0.020829618f, 0.0366421938f, 0.0623956621f, -0.0347790122f,
+    -0.127244234f, 0.101330906f, 0.145813644f, -0.244639903f, 0.0133913159f, 0.0651705265f, 0.212257981f, -0.0915908515f,
+    -0.239157379f, 0.175944328f, 0.136922717f, -0.0236047804f, -0.174610645f, -0.15626213f, 0.243843168f, 0.170338809f,
+    0.210528165f, -0.215888411f, -0.182086915f, -0.0115033686f, 0.200221121f, 0.103081107f, -0.0860044956f, 0.000686973333f,
+    0.215167373f, -0.228069723f, 0.247852623f, -0.0612232983f, 0.0753002763f, 0.117601067f, 0.0908043385f, 0.0821132362f,
+    -0.142871529f, 0.16274631f, 0.1635544f, -0.112083048f, 0.246941805f, -0.173771232f, -0.205292672f, 0.0782463551f,
+    0.146966517f, 0.0185141265f, 0.08327052f, 0.0231993794f, -0.159786999f, -0.092443794f, 0.127615362f, -0.0143440664f
+}; // Gemm /denseIn/Gemm bias
+alignas(16) static const float c4[5120] = {
+    0.0160521939f, 0.0320179425f, 0.0321894549f, 0.0321765728f, 0.0159695074f, -0.0202430785f, -0.0252786912f, 0.0378106013f,
+    0.0289142504f, 0.0277331024f, -0.0124842478f, -0.0443345122f, 0.052598726f, 0.0155917648f, -0.0212097447f, -0.0270414334f,
+    -0.0498162508f, 0.00590489851f, -0.00223349361f, 0.00857572444f, 0.0485240892f, -0.0322386213f, 0.0554682724f, 0.040871311f,
+    -0.00670756446f, -0.0529769212f, 0.0430182032f, -0.00938120857f, -0.0275911856f, 0.0544905365f, -0.0489212684f, -0.00969202444f,
+    -0.0521586873f, -0.00205977634f, -0.0451302342f, 0.0066156676f, -0.0545652248f, 0.0121526737f, -0.0187037531f, -0.00751304207f,
+    0.0242598727f, -0.00411131606f, -0.0179828685f, 0.0489245206f, 0.00997165218f, -0.0283458512f, 0.0201941784f, 0.0530227907f,
+    -0.0290938914f, -0.0318768248f, 0.0228622239f, -0.0260562133f, 0.0114737051f, -0.0135768708f, 0.0431734771f, -0.0338964723f,
+    -0.00512128556f, 0.0289610513f, -0.002519286f, -0.0421655923f, 0.00791947264f, -0.0470943749f, 0.0103736185f, 0.0363998823f,
+    0.00701838685f, 0.0186422523f, -0.00740110036f, 0.00713210786f, -0.0341467783f, 0.0495781749f, -0.040134605f, -0.0464556701f,
+    -0.0303582065f, 0.0163890459f, -0.00169530872f, -0.0449548028f, -0.0343304127f, -0.0277247597f, -0.0544997938f, 0.00961610116f,
+    0.0341314562f, 0.00456891302f, -0.0270037819f, -0.0553781949f, -0.0377998501f, -0.0451195054f, 0.025105847f, 0.0347981527f,
+    0.0382350162f, -0.0429700688f, 0.0418672562f, -0.0364061296f, -0.00952617079f, 0.0392395034f, 0.0513488799f, 0.0349269807f,
+    0.0546639934f, -0.0290898401f, -0.0239843559f, 0.0143161081f, 0.0281202812f, 0.0325370878f, -0.0475909747f, -0.0315285251f,
+    -0.0283746738f, 0.0540208258f, 0.0493167713f, -0.0127689941f, -0.0521581508f, -0.0539659411f, -0.0526790954f, 0.00560970325f,
+    0.0168728456f, 0.0457299985f, -0.000661575468f, -0.0375949778f, -0.00615565851f, -0.0148564056f, -0.0556726716f, 0.0515006669f,
+    -0.0144056464f, 0.0460673831f, -0.0465987511f, -0.0479874387f, -0.0475860499f, -0.00663893856f, -0.00687589031f, -0.0450557619f,
+    -0.0160415843f, -0.0477392375f, -0.0297792908f, 0.0418093614f, -0.0338187478f, -0.0324288309f, 0.00966524798f, -0.0333468989f,
+    0.0228225999f, 0.0113675343f, 0.0426258743f, -0.00114578847f, -0.0109143686f, 0.0078019402f, 0.0200453177f, -0.0453111418f,
+    0.0345289335f, 0.0192724057f, -0.0422878638f, 0.0188271385f, 0.0210311767f, -0.016927585f, 0.0400128514f, 0.0148136225f,
+    -0.0492281392f, 0.016521886f, -0.0464188829f, -0.0373220891f, -0.0539574698f, -0.0113553256f, 0.0439169779f, -0.022607699f,
+    -0.0437903628f, -0.0299034826f, 0.0558835454f, -0.00212665624f, -0.0388466008f, -0.00532701658f, 0.0484584942f, -0.0247644633f,
+    0.0186230857f, -0.0546292551f, -0.0148014678f, -0.00636454811f, 0.0286026224f, -0.0140569918f, -0.0558100939f, 0.00697465101f,
+    0.0429218896f, -0.00813692622f, 0.0323920548f, 0.040419735f, 0.00404480239f, 0.0034080639f, -0.00644161087f, -0.00703436043f,
+    -0.0525685847f, 0.0207300428f, -0.0124431709f, 0.00422194507f, 0.00253412663f, -0.023535762f, -0.0153042069f, 0.0345014893f,
+    -0.0322069861f, -0.0544579215f, -0.0183284115f, 0.0178769175f, -0.0440626331f, 0.0449681915f, 0.0172372945f, 0.0359293073f,
+    0.00107618968f, 0.0095997816f, 0.0511679575f, -0.0125382924f, 0.0451255552f, 0.0435630977f, 0.0324813649f, 0.00934265088f,
+    0.0346390344f, -0.000864874164f, 0.0461649001f, 0.0525185317f, -0.0555654988f, 0.00427127862f, -0.0172761306f, -0.00582412444f,
+    -0.0362345017f, -0.0329055823f, -0.0222370476f, 0.0364280604f, -0.0318550766f, -0.0315463059f, -0.00932922307f, -0.0451418757f,
+    -0.0422202237f, -0.0429549478f, 0.0339579284f, -0.0552407503f, 0.0528553315f, -0.0107613234f, -0.0125794495f, 0.0481574237f,
+    -0.00691388873f, 0.0354820974f, -0.0552411824f, 0.0143321818f, -0.0510275476f, -0.0162142757f, -0.0348619781f, 0.00532525731f,
+    -0.054952167f, -0.0391059406f, 0.0116004013f, 0.0388586223f, -0.0185722671f, 0.0528740361f, -0.0271006487f, 0.04962641f,
+    -0.0525676236f, 0.0429869816f, -0.0105102034f, -0.00188209407f, -0.0539333113f, -0.0122823417f, -0.0347898267f, -0.0298100524f,
+    -0.0336375237f, -0.0462883115f, -0.0298670493f, 0.00556338206f, -0.035451822f, -0.052122511f, -0.0172391869f, 0.0402620658f,
+    0.0234116316f, 0.0447578095f, -0.0516367778f, -0.0392938517f, -0.0554466955f, 0.0543840379f, -0.00847495068f, -0.0556680709f,
+    -0.0504056774f, -0.0242471714f, -0.0198049136f, -0.0490459725f, -0.00716295559f, 0.0351415537f, -0.0303387884f, 0.0328392796f,
+    -0.00370331248f, -0.0374087058f, -0.00215036003f, -0.0461328775f, 0.00287252455f, -0.00781081663f, -0.0259116124f, 0.0281867422f,
+    -0.00180892996f, 0.00358391344f, -0.0466761962f, -0.0188535135f, 0.0234447382f, 0.0231145509f, 0.0293978974f, -0.00990258716f,
+    -0.0300060343f, -0.00592622347f, 0.0459835641f, 0.0368163325f, -0.0113722254f, -0.00944542326f, 0.0373485573f, -0.0428427532f,
+    -0.00875571184f, -0.054009255f, 0.0190823358f, 0.0172666218f, -0.0380904675f, -1.81260857e-05f, 0.04885903f, -0.0023663803f,
+    0.00697876932f, -0.0148300966f, 0.0356827974f, 0.0349730216f, 0.0552917831f, 0.028748123f, -0.00411288207f, -0.0345358104f,
+    0.0168215539f, -0.0341704674f, -0.05576526f, -0.0493962206f, 0.0446824804f, -0.0238872208f, 0.00803714618f, -0.034464553f,
+    -0.0396630801f, -0.00346809323f, 0.0101509737f, -0.0228014477f, -0.0431444533f, -0.0066821347f, 0.0314934812f, -0.0327986591f,
+    -0.0558761358f, 0.0447908826f, 0.0148270242f, -0.0380144194f, -0.0218625031f, -0.0241512414f, -0.0039324942f, -0.0276848562f,
+    -0.0299512632f, 0.0299096201f, -0.0433739014f, -0.0394142866f, -0.0273836758f, 0.043875616f, -0.0481707901f, 0.0175683685f,
+    0.00174672145f, 0.0246648043f, 0.0036891182f, -0.0124252513f, 0.0196932852f, -0.00260599121f, 0.0504972748f, -0.0344802402f,
+    -0.00547729619f, -0.055527363f, -0.0232933126f, -0.0210090317f, 0.0118165417f, -0.0439481437f, -0.00424149074f, -0.0337090418f,
+    -0.041147504f, -0.0167890601f, -0.0008590098f, -0.0399108529f, 0.00624195067f, -0.0342618525f, -0.0228560008f, 0.0431820452f,
+    -0.0468633212f, -0.046211008f, 0.0409883969f, -0.0359938405f, -0.0370983779f, 0.0369437188f, 0.0111797294f, -0.0432623923f,
+    -0.0425254628f, -0.00324696163f, 0.0300982706f, 0.0390573554f, -0.0272654444f, 0.0358439982f, 0.0381293185f, -0.00315007358f,
+    0.0463380218f, -0.0401200615f, 0.0530537255f, 0.0367600583f, -0.0326165035f, -0.00157610304f, 0.0248700343f, -0.0399962738f,
+    -0.0113928178f, 0.0237959642f, 0.0314565934f, -0.0223777108f, 0.0506089143f, -0.0443656705f, 0.0163243786f, 0.0531067848f,
+    -0.0195555408f, 0.0473536775f, 0.0383944809f, -0.0297561083f, 0.0314084813f, 0.0334618539f, 0.00508154789f, 0.0413990431f,
+    -0.0286381543f, -0.000312175165f, 0.0224053599f, 0.0321764983f, 0.0118777836f, -0.0553980544f, 0.0084788762f, -0.000323757209f,
+    -0.0425232947f, 0.0130881332f, 0.0381412283f, 0.00814938825f, -0.00671719387f, 0.0377813913f, -0.0233475827f, -0.0138818957f,
+    0.0492793061f, -0.0497840568f, 0.00729614915f, -0.0370753072f, -0.0394844227f, 0.00647661695f, 0.0434204303f, 0.0140236318f,
+    0.0146198673f, 0.03876701f, 0.0541424341f, 0.0212178621f, -0.0203955509f, -0.0365652181f, -0.0504110269f, 0.0308027416f,
+    -0.00246533402f, 0.0304581858f, 0.0513005666f, 0.00548920501f, 0.0166747514f, -0.0348815434f, 0.0190293435f, -0.0285279918f,
+    -0.031599056f, 0.00635707797f, -0.0315407477f, -0.0261963308f, 0.0320270658f, -0.0470217578f, 0.0119522139f, 0.000882253866f,
+    0.0545335673f, -0.0397777148f, -0.0395516753f, 0.00295069348f, -0.00301818643f, -0.0133118499f, -0.032305941f, 0.0072091436f,
+    0.0338463001f, 0.0147173814f, -0.0534684919f, 0.0190915652f, 0.0295062605f, -0.0363538675f, 0.0232028347f, 0.0134495217f,
+    0.0542287678f, 0.0401096418f, -0.0522894301f, 0.0114707462f, 0.00751256244f, -0.0125209931f, -0.0349083394f, -0.00399882765f,
+    0.00703130802f, 0.0128192939f, 0.0152798034f, 0.0482240953f, 0.0458250605f, 0.0456221625f, 0.0160506479f, 0.0251979306f,
+    -0.0356007218f, -0.00433959113f, -0.0139427315f, -0.0394564867f, -0.0306481309f, -0.0216047801f, -0.0120577449f, -0.049605377f,
+    0.0530860797f, -0.0266313236f, -0.0396041013f, -0.0556909628f, 0.00519299693f, -0.0164879467f, 0.03638383f, 0.0545807481f,
+    -0.0372096747f, -0.0138855074f, -0.0504877232f, -0.0187046807f, 0.0474214181f, -0.0314361304f, 0.0242896937f, 0.0182070062f,
+    -0.0167555064f, -0.0467232428f, 0.0120628299f, 0.0218032878f, -0.0390740819f, -0.0527192466f, 0.0195709076f, -0.0505159609f,
+    0.0440278351f, 0.0255008228f, -0.0151394857f, 0.0269242674f, 0.0458975211f, 0.0197710395f, -0.0369066224f, 0.0152086848f,
+    -0.0202249065f, 0.0436183326f, 0.011773712f, -0.042843733f, -0.0227207802f, -0.0337370075f, 0.0222629644f, 0.0373556949f,
+    -0.00415543141f, 0.0216827821f, -0.0263005551f, 0.026425153f, -0.0159083586f, -0.033630766f, 0.0470874496f, -0.00636430178f,
+    0.0424250811f, 0.0114623765f, -0.0253575388f, 0.0137116499f, -0.020294698f, -0.0295170229f, 0.0208440106f, -0.00821768027f,
+    -0.033934664f, -0.0488913357f, -0.0400636904f, -0.0462924354f, -0.00424724165f, 0.0332750268f, 0.0342668295f, -0.0213605519f,
+    -0.0458284989f, -0.0135331945f, 0.0487277471f, 0.0134319216f, 0.00737109222f, -0.0524781756f, 0.0216369275f, -0.0178265907f,
+    -0.0169335417f, -0.0219596848f, -0.00803474057f, -0.0523406491f, -0.008688692f, -0.0391799808f, 0.0271636043f, 0.0317887329f,
+    0.0435926877f, 0.0199980028f, -0.0372658297f, -0.0343259536f, 0.00462565012f, 0.0510863587f, 0.0174907465f, -0.0233869217f,
+    0.034781266f, -0.0498081408f, 0.0402869172f, -0.0457755066f, -0.0101963161f, 0.0226170626f, -0.0411792248f, 0.0445856825f,
+    -0.0356362835f, 0.0526426546f, 0.0277549736f, -0.0517109819f, 0.0484847128f, 0.0551522113f, 0.0156822428f, -0.0314470902f,
+    -0.0485001393f, 0.0117460098f, 0.031067403f, 0.0269059148f, 0.0557034574f, -0.0540347062f, 0.0206860472f, 0.0110848742f,
+    0.00673531322f, 0.0127566718f, -0.00435150648f, 0.0074597504f, 0.0536771752f, -0.0157652814f, 0.013196216f, -0.0238275975f,
+    -0.010782348f, -0.00982843619f, -0.0526122004f, -0.0306469705f, 0.0231144838f, -0.0108405454f, -0.0128620695f, -0.044261992f,
+    -0.022897616f, 0.0196951646f, 0.0437632985f, -0.0206879005f, -0.0515400022f, -0.0277213883f, 0.00142918853f, 0.0461002775f,
+    -0.0264678765f, -0.0322197005f, -0.00775689818f, 0.043388743f, 0.0287627652f, -0.00324182352f, 0.00222091866f, -0.0212527215f,
+    0.0393257141f, 0.03032328f, 0.0410376638f, 0.0246579126f, -0.029245818f, -0.0295359287f, -0.0467983447f, -0.00963666663f,
+    -0.0472852848f, 0.0531740077f, -0.00783873908f, 0.00278926454f, 0.00403384026f, 0.0108262841f, 0.0124340607f, 0.0197035335f,
+    -0.0119330548f, 0.00448648585f, 0.0378700979f, -0.00777439773f, -0.026283402f, 0.0379491113f, 0.0206613112f, 0.0516381785f,
+    -0.00419616885f, 0.052123297f, -0.00132560986f, 0.0296309106f, 0.055422239f, -0.0230979025f, -0.00472607696f, 0.0319021977f,
+    -0.0385407694f, 0.0543350801f, 0.0410391204f, 0.0289698951f, 0.0307422131f, 0.00474377628f, 0.0223724265f, -0.0150389131f,
+    0.0381021686f, 0.0261272993f, -0.0537944213f, -0.000415733753f, 0.00106851943f, -0.0332966372f, -0.0259061009f, -0.0131967962f,
+    -0.0261354558f, -0.0259519685f, -0.0474669971f, -0.0509703718f, 0.0363192037f, 0.0213903394f, -0.0165743716f, -0.00550671807f,
+    -0.0225821771f, 0.0431420356f, -0.0271224603f, 0.010691545f, 0.021358192f, 0.0501811802f, -0.0208859816f, -0.00968115497f,
+    -0.0212198813f, -0.0186452642f, 0.0224170014f, -0.0491627194f, 0.0116526932f, -0.0388992578f, 0.0555700511f, -0.0399620011f,
+    -0.0545813479f, -0.00461103627f, -0.0465717316f, 0.00320787728f, -0.0123102907f, 0.0169444103f, 0.0186075997f, -0.0230897535f,
+    -0.0406461842f, 0.0367965586f, -0.0497888029f, 0.0189612582f, -0.0136625702f, 0.0481060892f, -0.0286673699f, 0.0435809977f,
+    0.0333235599f, 0.0490201302f, 0.0557526797f, 0.0100287963f, 0.00639578234f, -0.0224475041f, 0.00408822531f, 0.0488078371f,
+    -0.0505717173f, 0.0214652959f, 0.0200313237f, -0.0130721191f, 0.0275611058f, 0.000985539169f, -0.0423316769f, 0.0371477194f,
+    0.0448600091f, 0.0079161413f, -0.0298498906f, -0.0177221056f, 0.0165500026f, -0.00225243927f, 0.0145364134f, -0.0351298042f,
+    -0.0111199534f, -0.0354133584f, 0.0440593287f, 0.0145398919f, 0.0477964468f, -0.000561148918f, -0.0544311479f, -0.0176183749f,
+    -0.0381306037f, 0.012425405f, -0.0282072593f, -0.00884207711f, 0.0170962103f, 0.0170605704f, -0.0333316959f, 0.0238925256f,
+    0.0196902324f, 0.049836684f, 0.0545283817f, 0.0267638098f, 0.0362186022f, -0.0113542527f, -0.0255946983f, -0.0437631719f,
+    0.0504143536f, 0.0160359479f, -0.0497708507f, 0.0210133698f, -0.0472508334f, -0.0457024649f, -0.00222079852f, 0.0401592925f,
+    -0.0513505712f, -0.0116243185f, -0.0476811677f, -0.00165129302f, -0.00990272034f, -0.0135142095f, 0.0438995846f, 0.0377404951f,
+    -0.0438970663f, 0.0478119329f, -0.00300441845f, 0.0432212688f, -0.0552989207f, 0.0446392484f, 0.0528068244f, -0.0301337689f,
+    -0.046889849f, -0.0228632037f, -0.0460591428f, -0.00530857034f, -0.00333138113f, -0.031671375f, -0.0405578017f, -0.0501795262f,
+    -0.041980993f, -0.0348555073f, 0.0421263129f, 0.0138640292f, 0.0481617674f, 0.0041860994f, 0.0442323796f, -0.0547969155f,
+    -0.0366084203f, -0.0167269781f, -0.0190141555f, 0.0252548009f, 0.0339279324f, -0.0339149907f, -0.0355037339f, 0.0231939182f,
+    -0.0506908745f, 0.0267445575f, 0.00320856366f, -0.00387455733f, 0.0267348625f, 0.027630318f, -0.0040621222f, 0.00564646861f,
+    -0.00443699909f, -0.00730905728f, -0.022599563f, 0.0520056896f, 0.0360558331f, -0.0137637695f, 0.00605889037f, -0.0120570315f,
+    0.0448011905f, 0.00651758723f, 0.000833113503f, 0.0555257089f, 0.000467892882f, 0.0038618024f, 0.0330502689f, -0.0388997383f,
+    -0.0174586792f, 0.0189866535f, 0.0206799302f, 0.042437356f, -0.0425920561f, 0.0436635576f, 0.0311265532f, -0.0226821434f,
+    -0.0220495425f, -0.0410596989f, -0.000125689738f, -0.0274965502f, 0.00766024319f, 0.0402937531f, 0.00535231968f, -0.0358549356f,
+    -0.0240444783f, -0.00284612854f, -0.0162174609f, 0.0243855342f, -0.00207413733f, -0.0412079953f, -0.00379889412f, -0.0328108519f,
+    0.040394526f, -0.00552225159f, 0.0289587267f, 0.00421486096f, -0.0432101861f, -0.00506357523f, -0.0484920032f, 0.0133644687f,
+    -0.0508412831f, 0.0218129307f, -0.0319167376f, -0.0343125053f, 0.00551464129f, 0.00496362196f, 0.0251637511f, -0.0306457318f,
+    -0.0434762463f, -0.0472163856f, -0.0226347353f, 0.0266135316f, -0.0360151902f, -0.0235343296f, -0.0207851417f, 0.0199842751f,
+    0.0133239115f, 0.0415180176f, -0.000184699471f, 0.000820358633f, 0.00166464096f, 0.0115881395f, 0.0328099467f, 0.00293112127f,
+    0.0166478362f, 0.0402732678f, -0.0195129234f, -0.0053629023f, 0.0284505766f, 0.0334853157f, 0.0350045227f, 0.0241871681f,
+    -0.0109644085f, 0.0104725584f, 0.00809023157f, -0.0483117215f, 0.00164825423f, 0.0193880145f, -0.0200228132f, -0.019022746f,
+    0.0482031964f, 0.0518836714f, -0.0338568948f, 0.0399245061f, -0.0183556192f, -0.0402046703f, 0.00943911914f, -0.00842787605f,
+    0.0540879518f, -0.0433241203f, 0.0152345682f, 0.0153083187f, 0.0167670213f, -0.0333095677f, 0.00415748404f, -0.025548717f,
+    0.0291864891f, -0.030889675f, -0.0114496481f, 0.0248306636f, 0.0453799739f, 0.00685619842f, -0.00755595183f, -0.0305528883f,
+    0.0272415727f, -0.0477381758f, 0.0410785936f, 0.0285892133f, -0.0416601002f, -0.00100620429f, -0.0516720228f, 0.0461498909f,
+    -0.0141092176f, -0.0543219522f, -0.0384913795f, 0.0228875466f, 0.0392641313f, -0.0285321698f, -0.0533568114f, -0.0467252694f,
+    0.0163334757f, -0.0121169211f, -0.0350689888f, 0.0034978413f, 0.0519548692f, -0.0146275237f, 0.00254450925f, -0.0440316796f,
+    0.0503592603f, 0.020183403f, -0.0276566539f, -0.0140104573f, -0.047892414f, -0.00775347929f, 0.0420426875f, 0.0343618132f,
+    -0.052301731f, -0.0102158077f, 0.00871729385f, 0.0137601709f, -0.0228089727f, -0.0430613868f, -0.0520696379f, -0.0496181063f,
+    0.000941950013f, -0.026829144f, 0.0338780247f, 0.00651132967f, -0.0485151671f, 0.0451201983f, 0.0496900752f, -0.0274473839f,
+    0.0100426972f, -0.00258906465f, -0.0406405143f, 0.0456054844f, -0.00868483353f, 0.0179236792f, -0.0360306501f, -0.0229535475f,
+    -0.0311777182f, -0.00261609396f, 0.000284752809f, 0.0115496544f, 0.045147758f, 0.027245678f, -0.00205882336f, 0.0344298109f,
+    -0.0308532696f, -0.0414284207f, -0.0331333354f, 0.0196496751f, 0.0169124976f, -0.0535635017f, -0.0124676079f, 0.00341673358f,
+    0.0395676754f, -0.0541568846f, 0.0462457351f, -0.0338170379f, -0.0321244262f, -0.00380611792f, 0.0103911916f, 0.0203941651f,
+    0.0136958966f, 0.0138272308f, 0.0519249141f, 0.00819038507f, -0.028130224f, -0.00134766113f, 0.0148347411f, 0.0383690968f,
+    0.0177452248f, -0.0505362712f, -0.0546918884f, 0.00723475358f, -0.00116945233f, -0.0547284596f, -0.0447018556f, -0.021394331f,
+    0.0137406318f, -0.052137658f, -0.0208176225f, -0.0235730205f, -0.012130403f, -0.00483272737f, -0.046905864f, 0.000599247054f,
+    -0.00853925198f, -0.0108779697f, -0.000315933663f, 0.0515616685f, -0.0471037365f, 0.00136045599f, -0.0189516749f, -0.0061405045f,
+    -0.0248351227f, -0.00113160082f, 0.00184666156f, -0.041425202f, -8.96574784e-05f, 0.042698618f, 0.0439561941f, 0.0317778587f,
+    0.0209653229f, 0.020833876f, -0.00783838518f, 0.0466640927f, -0.0503072031f, 0.0244690292f, 0.023002075f, -0.0353756659f,
+    -0.0175708942f, -0.0320679285f, -0.0527824983f, -0.0420210361f, -0.00261508091f, -0.00525694434f, 0.0213636309f, 0.0343162827f,
+    0.026106853f, -0.0380236693f, 0.029696079f, 0.02065414f, 0.0425944738f, 0.0310709216f, 0.0437505655f, 0.036613524f,
+    0.0152859809f, -0.0390929468f, -0.00850255322f, -0.0303407479f, 0.0551480986f, -0.0237836763f, -0.0226025954f, 0.00942805689f,
+    -0.0523052625f, 0.03417027f, -0.0456961989f, -0.0399816781f, -0.0384816043f, -0.00358273392f, 0.0234489758f, -0.02250758f,
+    0.0401104726f, -0.0168322958f, 0.0535573512f, -0.0343649313f, 0.0134345545f, 0.0268385541f, -0.0405996442f, -0.00781552121f,
+    -0.00674972078f, -0.0219495501f, -0.0200135242f, 0.0379348099f, 0.0537833981f, -0.00799659546f, -0.0200463776f, -0.0519968532f,
+    0.0541588962f, -0.0144221922f, -0.02416295f, 0.0359395966f, -0.0517447814f, 0.0359802581f, 0.0268929992f, -0.0376575813f,
+    -0.0354346894f, 0.00950050075f, 0.04485083f, 0.0299600065f, 0.0353934318f, -0.0452376306f, -0.0437361784f, -0.0398496389f,
+    0.0152304824f, 0.0480881371f, -0.00905994326f, 0.043723803f, 0.0132995816f, -0.0371201411f, 0.0238117576f, -0.0473598689f,
+    0.03038189f, -0.00338400668f, 0.0105803087f, -0.034127418f, -0.0493777618f, 0.0244996827f, 0.0155963833f, 0.0495444685f,
+    -0.0245373603f, 0.0269035753f, -0.0368823297f, -0.0130252382f, -0.00805774424f, -0.0522849038f, 0.0467925295f, -0.00317525701f,
+    0.041688323f, 0.00606132951f, -0.0473215505f, -0.0123143094f, -0.0109513011f, -0.0253966376f, 0.030456068f, 0.0278629716f,
+    0.0369735956f, 0.0355647057f, -0.0422062948f, 0.037248753f, 0.0125495419f, 0.0197444651f, 0.045822829f, 0.0216562469f,
+    0.0524204299f, -0.0119781168f, -0.0431772992f, -0.0381146446f, -0.0202683751f, 0.00202199817f, -0.0108201727f, -0.0120558394f,
+    0.00787964277f, -0.00156488083f, -0.0191427041f, -0.00986130349f, -0.000430008047f, -0.0318047628f, -0.0355048627f, 0.00303451996f,
+    0.0178829227f, 0.0149846012f, 0.0442297198f, 0.0442743599f, 0.0175817218f, 0.0550459623f, -0.0290984306f, 0.00970989745f,
+    0.0472513251f, -0.036981985f, 0.0495331176f, 0.00837940909f, 0.0176415257f, -0.00282740267f, -0.0476891026f, -0.0436512977f,
+    -0.0376310721f, -0.0232122242f, -0.00707636354f, 0.0436956584f, 0.0358394831f, 0.0122851944f, 0.0279817842f, -0.0392983966f,
+    -0.0407717042f, -0.0370377824f, -0.0266905334f, 0.0426873229f, -0.0202218927f, -0.0343528874f, 0.0189894736f, -0.0149202468f,
+    -0.0116742114f, 0.0200003888f, -0.0317216143f, -0.0447476916f, -0.0214409865f, -0.0371699221f, 0.0297282115f, 0.0333131365f,
+    -0.049844075f, 0.0353188105f, -0.032742139f, -0.00843887869f, 0.0457765162f, 0.0147489756f, -0.0532766357f, -0.0316226929f,
+    -0.00329340971f, -0.0351556204f, 0.0232065059f, 0.0488934889f, -0.0350345038f, 0.0180654693f, 0.000949906826f, 0.0418618582f,
+    0.0248306245f, -0.044333078f, 0.0522501208f, 0.0105548128f, 0.0482986979f, 0.00665509189f, -0.0252046734f, -0.0441724025f,
+    0.0253224075f, -0.0462884419f, 0.0548214987f, 0.021667989f, 0.0292474311f, -0.031258367f, 0.0287057012f, 0.0467318669f,
+    0.0204154495f, 0.0195076466f, 0.0448994301f, 0.0380939543f, -0.0372615121f, -0.0499672368f, -0.00144666818f, 0.0451801866f,
+    0.0361780263f, 0.0429928824f, -0.00552347116f, 0.0180012677f, 0.0485916771f, -0.047947038f, 0.050207708f, 0.0247260593f,
+    0.0352476649f, -0.0195119437f, 0.0400158837f, 0.0344057865f, -0.0472062044f, -0.051420819f, -0.0457061678f, 0.0245692749f,
+    0.0223187283f, 0.0357894897f, -0.0469716899f, 0.0526072085f, 0.0333897807f, 0.0273979176f, 0.0546305142f, 0.0520153716f,
+    -0.0265527088f, -0.0489700772f, 0.0209273975f, -0.0358068086f, 0.0470674448f, -0.0272263922f, 0.0128849745f, -0.0524343774f,
+    0.00827714987f, -0.0338875018f, -0.0160435252f, 0.00647205207f, -0.00141899928f, -0.0389299914f, -0.0118117295f, 0.0218509417f,
+    0.0424205773f, -0.0254528616f, 0.00578980474f, -0.0164235458f, 0.0551246628f, -0.0352842249f, -0.0273141898f, 0.00251929252f,
+    -0.0473733507f, -0.0394405425f, 0.042436555f, 0.0233512018f, -0.0371407494f, 0.0497527383f, 0.0302809048f, 0.00802183244f,
+    -0.0185890272f, -0.0180283636f, 0.0490409955f, -0.0459484458f, -0.0517893359f, 0.0198235735f, -0.00492936885f, -0.0362824574f,
+    0.0161479898f, -0.0503285266f, -0.0029124287f, -0.0217220876f, 0.0378951319f, -0.0304176491f, -0.0363981649f, 0.0284378137f,
+    -0.0381127708f, 0.0168827549f, 0.0354702696f, -0.0236094985f, -0.0411041565f, 0.0345488563f, 0.028245531f, 0.0190572254f,
+    0.0217756517f, -0.0205256324f, -0.0400128141f, 0.0066242246f, 0.0267900061f, -0.0271737073f, 0.0346059948f, 0.0438150577f,
+    0.0537580624f, 0.0265730936f, -0.0388628319f, 0.0510173328f, 0.0441696979f, 0.0171154626f, -0.0558349714f, 0.0315757804f,
+    -0.011967428f, -0.0292937253f, -0.0396280251f, -0.0197487026f, 0.0381109267f, -0.0374720432f, -0.0053632753f, 0.00605944358f,
+    -0.0447854102f, 0.0431951992f, -0.0332958065f, 0.0489402488f, -0.0271534212f, -0.0444027632f, 0.0524964482f, 0.0272493437f,
+    -0.00996316224f, -0.0212490764f, -0.035164237f, -0.0427276008f, 0.0237897001f, -0.00333322049f, 0.0418905877f, 0.00900359266f,
+    0.0271949377f, -0.045332171f, -0.0457402281f, -0.0287491772f, -0.0176477153f, 0.0171878804f, 0.0378490388f, 0.0326719023f,
+    0.0193572268f, -0.00273668556f, -0.053080108f, -0.0191810559f, 0.0501527227f, 0.0432318784f, 0.0399675444f, -0.037965633f,
+    -0.0093467487f, 0.016738534f, -0.0413771607f, 0.00854816847f, -0.0125517072f, -0.0369773544f, 0.0391802862f, 0.00641853316f,
+    0.00156462099f, -0.0444494449f, -0.0246573873f, 0.0244303178f, 0.0171374064f, 0.0025669469f, 0.0149676343f, 0.00958328135f,
+    -0.0516508594f, 0.0437059291f, -0.0049821143f, -0.033020243f, 0.00263691228f, -0.0356736556f, -0.0333207473f, -0.0384285934f,
+    0.00281395484f, -0.0365182646f, -0.020703828f, 0.00919286348f, -0.0438473672f, 0.0169266313f, 0.0228230394f, -0.0382707417f,
+    -0.0520277806f, -0.037982177f, 0.0370581597f, 0.0156215131f, -0.019867342f, -0.0309047941f, -0.0249504689f, 0.0250818841f,
+    0.0472791791f, 0.0459530689f, 0.052616246f, -0.0500729904f, 0.0164589714f, -0.0252393801f, -0.00333157438f, -0.0506623536f,
+    -0.000806857366f, 0.0230390001f, 0.0348156393f, -0.0539524332f, -0.00967269856f, 0.0193388592f, -0.00639934745f, 0.00358537282f,
+    -0.0351861157f, -0.0226817168f, 0.0407440215f, 0.0383689515f, 0.0276692752f, 0.0157563668f, -0.000842556416f, 0.0338063017f,
+    -0.00501531456f, -0.0464574099f, 0.00858647935f, 0.0385087729f, -0.00863024872f, -0.0313104577f, 0.00672291173f, 0.0390336029f,
+    0.0305067804f, 0.0150712533f, 0.0468426496f, -0.00821258221f, 0.0532071441f, 0.0439979658f, 0.0188926049f, -0.00434949389f,
+    0.0355459191f, -0.00772716338f, -0.0474115349f, -0.0367394611f, -0.029265238f, -0.0181476157f, 2.28975096e-05f, -0.0255253725f,
+    0.0536069497f, -0.054935798f, 0.0383931547f, 0.017704241f, 0.0457196906f, 0.00260446523f, -0.033638835f, -0.0510770865f,
+    -0.0340984426f, -0.0101802228f, 0.0062797619f, -0.00305135315f, -0.00805337913f, 0.0278299637f, -0.0419033021f, 0.0342351831f,
+    -0.0485822111f, -0.0290120784f, -0.0496470481f, 0.0382968187f, 0.0491350368f, -0.0556016453f, -0.0472792797f, 0.0237168949f,
+    0.0242895726f, -0.0467617139f, 0.00994964782f, -0.00896623451f, -0.0496002659f, -0.0530183725f, 0.052795127f, -0.00506653404f,
+    0.0148109309f, -0.044944752f, 0.0360760801f, 0.0364672691f, 0.0172085576f, 0.00223537954f, -0.0253881272f, 0.0442799516f,
+    -0.0420553237f, -0.0359871425f, -0.0479215756f, 0.0218871683f, 0.022324333f, -0.0132453302f, -0.0378676765f, 0.0273203477f,
+    -0.0137237189f, -0.0218443852f, 0.0237404928f, -0.0419420674f, -0.0293877143f, -0.0268334169f, -0.027269315f, 0.0531802662f,
+    0.0497655123f, -0.0268579591f, -0.0120893391f, 0.0349193029f, 0.0451952592f, 0.0441287048f, 0.00286148232f, 0.0538297258f,
+    -0.0047297352f, -0.0531053953f, 0.0208991617f, -0.0534621291f, -0.0152761312f, -0.0216040816f, -0.0481028855f, 0.0111516202f,
+    -0.0402115732f, -0.0236999355f, -0.0288380478f, -0.0262734275f, -0.0402245224f, 0.020041978f, -0.0262238327f, -0.00992910285f,
+    -0.0209936574f, 0.0216054395f, -0.0302065201f, -0.0410878696f, 0.00237576989f, 0.0408538841f, -0.0192118045f, 0.0297834296f,
+    -0.0484792404f, -0.0497760735f, -0.0163510814f, 0.0461586602f, 0.0367865562f, 0.0249052271f, -0.0309929326f, -0.0136625562f,
+    0.040983364f, 0.0328627601f, -0.00833906513f, 0.0340131447f, 0.0278380085f, 0.0267253462f, 0.0414141715f, 0.000478095491f,
+    0.00557746319f, -0.0131916581f, -0.0489313379f, -0.0468366034f, -0.0178444907f, 0.0543265417f, 0.00540396571f, 0.0156495683f,
+    0.00645205984f, -0.00131381466f, 0.0343304388f, 0.0224838816f, -0.00517855585f, 0.0496566892f, -0.0260138772f, -0.0235674884f,
+    0.044412408f, -0.0265131835f, 0.0427022688f, 0.0402150787f, 0.0122340675f, 0.0553010255f, -0.0370693095f, 0.0411610194f,
+    -0.00491198897f, -0.0552264899f, 0.00971766096f, -0.0120150754f, -0.00914279092f, -0.00860519893f, 0.0187370609f, 0.0457983986f,
+    0.0503782257f, 0.0226360671f, 0.0167352408f, -0.00214099046f, -0.0438403822f, -0.0409988984f, -0.00258835824f, 0.045653902f,
+    -0.044004418f, -0.0542015843f, 0.0159655288f, -0.00459533557f, 0.0167600438f, 0.0479705781f, 0.0417107791f, -0.0165487025f,
+    -0.0441667922f, 0.001980528f, 0.0383204818f, -0.0221002158f, -0.0372479111f, 0.000419472257f, -0.00159184344f, -0.0485845171f,
+    -0.0212275907f, 0.0119670946f, -0.0111867664f, -0.0387856215f, 0.0518516116f, -0.0537308455f, 0.0428094529f, -0.00658128131f,
+    0.00320582464f, 0.0246286113f, -0.00435001403f, -0.0548187047f, 0.0183754321f, -0.00644324347f, -0.00143971096f, -0.0363216735f,
+    -0.0553760231f, -0.0406202823f, 0.0216741469f, 0.019660484f, -0.0318667963f, -0.0311825909f, 0.0451308265f, -0.0218389742f,
+    0.0549603216f, 0.00390018709f, 0.0366181359f, -0.0483399034f, 0.0313634239f, -0.029216297f, 0.0258146971f, 0.0504054576f,
+    0.00413651904f, -0.00816468801f, -0.0123299165f, 0.050917197f, -0.0500386246f, 0.032665316f, -0.0236157496f, 0.0355127938f,
+    -0.0500414036f, 0.0386516117f, 0.00711325556f, -0.0467432663f, 0.0395551212f, 0.0525676124f, 0.00278521958f, 0.0433661304f,
+    -0.0521401018f, 0.0172790568f, -0.0479376502f, 0.00658857869f, -0.0264195893f, -0.0210600384f, -0.00732060568f, -0.0320179611f,
+    -0.00956859346f, 0.0194289312f, -0.0459810868f, -0.0452501327f, 0.0018498936f, 0.00327260466f, 0.0103312088f, 0.027673047f,
+    0.0539962538f, 0.0422439128f, 0.0437664166f, 0.0102705332f, 0.0441774055f, 0.0498696119f, -0.025535902f, -0.0296571013f,
+    -0.040870104f, 0.00723717269f, 0.0014829936f, 0.00651682075f, -0.0333218798f, -0.0405985974f, -0.0115802493f, 0.0435101464f,
+    0.0174048729f, 0.0444886349f, 0.001035386f, -0.0266858023f, 0.0279761925f, 0.0512257814f, 0.00758064212f, -0.0218551606f,
+    -0.0112296231f, -0.00356063619f, -0.0425036177f, 0.0317637995f, -0.00530589139f, 0.0257780179f, 0.024011204f, 0.048193235f,
+    0.00543811871f, 0.0427094474f, -0.0517632067f, 0.0260691345f, -0.0331534371f, 0.0542196259f, -0.0275218543f, 0.0196359884f,
+    0.0195133369f, -0.0270747263f, 0.00652900897f, 0.0254406799f, 0.0275311377f, -0.0415824465f, -0.0502113812f, 0.0361892954f,
+    -0.0144846877f, 0.0198823959f, -0.0440954268f, 0.0349888094f, -0.00681228936f, 0.020738773f, 0.0119966296f, -0.0453538224f,
+    0.0128407981f, -0.0182112716f, 0.030837629f, -0.00642133877f, 0.0147800166f, 0.054695569f, 0.0423152111f, 0.0260566603f,
+    -0.0136894928f, 0.0395039096f, -0.0344522223f, -0.0549969487f, -0.00168129429f, -0.0145439506f, 0.0478209518f, -0.0120391119f,
+    0.04388991f, 0.0492760427f, -0.00345947663f, -0.00449152384f, 0.0332912058f, -0.00571822654f, -0.0428616814f, 0.0522319116f,
+    0.00675150007f, -0.0491599739f, 0.00313213421f, 0.0166036002f, -0.0106264902f, 0.0493306741f, 0.0503694788f, 0.0447709486f,
+    0.0488016382f, -0.0180780441f, -0.00417323783f, -0.00385955651f, 0.0524285361f, -0.0440195687f, -0.0489877909f, -0.0435347632f,
+    0.0475353785f, 0.0316116065f, -0.00595453894f, -0.0221466497f, 0.0498179309f, 0.0545978546f, -0.0101790698f, 0.0236735139f,
+    -0.025712138f, 0.0244878009f, 0.0364848152f, 0.0340752862f, -0.00171322154f, 0.0117548658f, -0.053336978f, 0.0187727995f,
+    0.0052370592f, 0.0148485359f, 0.0162211061f, 0.0298281647f, -0.0527062975f, 0.0392663181f, -0.043774683f, -0.0378090404f,
+    -0.0376051553f, 0.0186021477f, 0.0474929884f, -0.0119085982f, -0.0040410175f, 0.00345038692f, 0.00412054546f, -0.00753131509f,
+    -0.00208259397f, -0.0380214415f, -0.0441311039f, 0.0527201593f, 0.00172658288f, -0.0332642719f, -0.0329611339f, 0.0146185607f,
+    -0.027931897f, 0.0349939987f, -0.0452901907f, -3.87178488e-06f, 0.00726746069f, 0.0361646563f, 0.0214826353f, -0.0511531383f,
+    0.0454827845f, 0.000108170076f, -0.0447680652f, -0.0227357075f, 0.0191556923f, 0.00673304079f, 0.048191417f, 0.0103874262f,
+    -0.0526746176f, -0.0321884006f, 0.0187749714f, 0.00760166673f, 0.0394882672f, 0.00661204942f, 0.00631380174f, -0.0485423878f,
+    -0.000605464564f, 0.00786358211f, 0.0212744996f, -0.0207766518f, -0.0483067892f, 0.0208953917f, -0.046458248f, 0.047158543f,
+    0.0224875808f, -0.00851244945f, -0.0509706773f, -0.0384911485f, -0.000631680712f, -0.00128209393f, 0.00979349017f, 0.0499767549f,
+    -0.0445262864f, 0.00101259502f, -0.0444888957f, -0.0206662286f, -0.0456438474f, 0.00675745774f, 0.00875141378f, 0.0529882647f,
+    -0.0467444658f, 0.00293293386f, -0.0336643457f, 0.0224413127f, 0.0535818599f, 0.0471626855f, -0.00751980627f, -0.0526143536f,
+    -0.0320262127f, -0.0394266658f, 0.0388394743f, -0.0367572494f, 0.00562708313f, 0.0401664227f, 0.0148266042f, 0.0323928855f,
+    -0.00480644451f, 0.0199349616f, -0.0342635997f, -0.0160099044f, 0.0106165279f, 0.0355762392f, 0.00426864624f, -0.0319264717f,
+    0.0250325762f, 0.0331889093f, -0.0385597199f, 0.0326860696f, -0.037777558f, -0.0177238788f, 0.00113300025f, 0.00472533703f,
+    -0.0049350867f, 0.0345070139f, -0.0137340017f, -0.0521769598f, -0.0257017016f, -0.0143854944f, 0.0409185886f, -0.0350234956f,
+    0.00738431374f, -0.0534246229f, -0.0165853612f, -0.0431314521f, 0.00438899826f, -0.00365741737f, -0.00320355222f, -0.0361055881f,
+    0.0344336294f, 0.0472865887f, 0.0236531273f, -0.0124363136f, 0.0475779884f, -0.00415523164f, -0.0542872697f, -0.0146324215f,
+    0.0365141444f, -0.0132513409f, 0.0329954922f, -0.0380952395f, 0.047555618f, -0.0251572672f, -0.0106202066f, 0.0209000017f,
+    0.00966430828f, -0.0545646586f, -0.0423528105f, -0.0272089522f, 0.0115914512f, -0.0117614167f, -0.0488264225f, -0.0542822666f,
+    -0.0372765251f, -0.0236611981f, 0.0120882997f, 0.0258978028f, -0.00878210831f, -0.0299125444f, 0.0404709354f, -0.0351330899f,
+    0.0110991886f, -0.034476839f, -0.0189041533f, 0.00735900365f, -0.00419273647f, -0.0159782767f, -0.0170065053f, -0.0230124239f,
+    -0.0404072031f, -0.00488449354f, -0.0118753575f, 0.0409046635f, -0.0458105691f, 0.0122766178f, -0.0334308259f, -0.0208996162f,
+    -0.00380358566f, -0.0342202373f, 0.0481444858f, -0.0488940217f, 0.0187655967f, 0.0143028274f, 0.0432870835f, -0.0157842338f,
+    0.0233816374f, 0.045644708f, -0.0161645021f, 0.000742436445f, 0.0268300772f, -0.0424269401f, -0.0119019607f, 0.00241502095f,
+    -0.00618518656f, 0.0483984277f, 0.039938055f, -0.0520641059f, 0.00812770985f, 0.0364356413f, -0.0282814503f, -0.0148469899f,
+    0.0166392121f, 0.0228441115f, 0.0433187895f, 0.0420216098f, -0.0458883084f, 0.0124788433f, -0.0334332027f, -0.0180769246f,
+    -0.0451093689f, 0.0142810754f, 0.00783455372f, -0.00224010414f, -0.0178168546f, -0.0285068676f, 0.0533876792f, 0.015984375f,
+    0.0292115659f, -0.0070090373f, -0.0496123619f, 0.0134195602f, 0.036988128f, 0.040893402f, -0.0168562401f, -0.0219542999f,
+    0.0295108594f, -0.0141781569f, 0.00582861574f, -0.0470532365f, -0.027853962f, 0.0104830144f, 0.0486282595f, 0.00781192258f,
+    -0.00528779859f, 0.0319237001f, 0.0271019693f, 0.0101517001f, -0.00461254222f, 0.0523671806f, 0.00677018613f, 0.0174404792f,
+    0.0337321647f, 0.00983849913f, 0.0242292248f, 0.0359543748f, 0.0206746254f, 0.0405164659f, 0.00855717156f, -0.0214363337f,
+    0.0291550886f, -0.0104624564f, 0.0450400822f, -0.00169155025f, -0.0333251618f, -0.0122765778f, 0.0370495655f, -0.0420269258f,
+    0.0068567316f, -0.0544445291f, 0.01892264f, 0.00811348855f, 0.0236640237f, 0.00116589374f, -0.0556070022f, 0.031345237f,
+    -0.0304584205f, -0.0400151201f, 0.0319647044f, 0.0501001924f, -0.00122048531f, 0.0407343656f, 0.00876338221f, 0.0359625071f,
+    0.0119800093f, -0.0197743997f, -0.00676350854f, 0.0191054866f, 0.00508308737f, -0.00636539469f, -0.0250424054f, -0.0235379674f,
+    -0.0397203416f, -0.0518962219f, -0.00068599236f, 0.0510541573f, 0.021771254f, -0.0515853725f, 0.00412283791f, -0.0543174595f,
+    0.0220266525f, -0.055158969f, -0.0218179282f, 0.0542061105f, -0.0152259581f, 0.0286490377f, 0.0434218161f, 0.0313843153f,
+    -0.0421458669f, 0.0340532213f, 0.00546456128f, -0.044006981f, -0.0495942868f, -0.00655500544f, -0.0470111929f, -0.00466093607f,
+    -0.0256856028f, 0.0539145395f, 0.0504234843f, 0.036759533f, -0.0514968671f, -0.0257500168f, -0.0126685407f, 0.0482499003f,
+    0.0402309187f, -0.0308316033f, -0.0292596463f, -0.0249225199f, -0.0100647686f, 0.00997028593f, 0.0110986819f, 0.0299641509f,
+    -0.0263245925f, -0.0179877002f, -0.01901301f, -0.0196035132f, 0.0543448403f, 0.0234835297f, -0.0288048405f, -0.0159681682f,
+    -0.0180465095f, 0.00721835345f, -0.0515284687f, -0.0489808917f, -0.0218076333f, 0.0498452f, 0.0449090078f, 0.0249535087f,
+    0.0513545834f, 0.00756971957f, 0.0224935915f, -0.0124754114f, -0.0219430979f, 0.0489566438f, 0.0208424311f, 0.00758889178f,
+    -0.0352154449f, -0.055783391f, 0.0354474597f, -0.0499741957f, 0.0327003039f, -0.0540837906f, -0.0198105518f, -0.0376205407f,
+    -0.0348970592f, 0.0315868892f, 0.0540427156f, 0.0185105652f, -0.0227884464f, 0.0312472321f, -0.00136821286f, -0.0424526893f,
+    -0.03881789f, 0.0481590219f, 0.00497611659f, -0.00472838245f, -0.0185771976f, 0.0530946292f, 0.0241399799f, -0.0481689163f,
+    -0.0056941295f, -0.0439983718f, 0.0371257141f, -0.00459128385f, -0.0225021876f, -0.0176761784f, -0.0271231476f, 0.0514097288f,
+    -0.0421373434f, 0.0511907078f, -0.0165636167f, -0.0161998421f, 0.0471956134f, -0.0109108705f, -0.0546072423f, -0.00276403478f,
+    0.0279048271f, 0.0127304094f, 0.042751465f, 0.042226214f, 0.00724035129f, 0.0104835015f, 0.0145765441f, 0.00774926785f,
+    0.0177699532f, -0.0360843688f, -0.00351190218f, -0.0389166512f, -0.0244786181f, -0.00234757457f, 0.000330907671f, -0.010308411f,
+    -0.0289694481f, -0.030043073f, -0.025397677f, 0.0185636096f, -0.015321753f, 0.0375596657f, 0.00221396796f, 0.00373877818f,
+    -0.0234423261f, -0.0389270484f, 0.0144713866f, 0.0334708951f, -0.00663969805f, -0.0353049561f, -0.0054505337f, -0.0162399393f,
+    0.0265045948f, 0.00649258355f, 0.0453985073f, 0.025419509f, -0.0407367013f, -0.050844796f, -0.0169775635f, 0.0290143099f,
+    0.0206137765f, -0.0364570282f, 0.0052881185f, -0.0366498306f, 0.025629364f, -0.0185605176f, 0.0263326634f, 0.0371446945f,
+    0.0329614133f, -0.0337637365f, 0.0553156473f, -0.0118165947f, -0.0458145067f, -0.000476456131f, -0.0382100455f, -0.0151011348f,
+    -0.0386052206f, -0.00505411206f, -0.0509937219f, -0.0338601321f, 0.00879861508f, -0.0519135147f, 0.0527828708f, -0.0503588207f,
+    -0.00716147618f, 0.0343578756f, -0.0462805144f, 0.0506918505f, 0.0169409849f, 0.0488496795f, 0.0449683033f, 0.0156146288f,
+    0.0379519351f, 0.011538526f, -0.0405108482f, -0.0241351146f, -0.00073927769f, -0.022634035f, 0.0502024591f, -0.0303961709f,
+    -0.0369626321f, -0.0356897153f, -0.0301513094f, 0.0260657091f, 0.0473908409f, 0.0307867359f, 0.0353042223f, -0.0437461212f,
+    -0.0188229661f, -0.0430892371f, 0.0490979068f, -0.0367162302f, -0.0356571414f, 0.0283483695f, 0.0147217f, 0.0402433276f,
+    -0.0319539569f, 0.0371967927f, -0.0319123045f, 0.0408669971f, -0.014477157f, -0.00142239116f, -0.0319825113f, -0.0066557317f,
+    0.0353484452f, 0.0390009582f, -0.0407204777f, -0.0467417948f, -0.00355347898f, 0.0222365409f, -0.00751720043f, 0.0183211006f,
+    0.00652498426f, 0.0388900563f, 0.0518167131f, -0.0295050014f, 0.00763255451f, 0.027343573f, 0.0552256629f, 0.0186865348f,
+    -0.0353115611f, -0.0370497964f, -0.0174661428f, 0.0421937816f, -0.025616169f, 0.0456719026f, 0.00409368984f, 0.0530668609f,
+    -0.0127705801f, 0.0472984463f, 0.0506453216f, 0.0389826708f, -0.021517083f, 0.0331427269f, 0.0137391323f, -0.000777928915f,
+    -0.0354298055f, -0.00893528014f, 0.00432974845f, 0.0189914852f, 0.0422200561f, -0.0505491532f, 0.0180319287f, 0.0440412946f,
+    -0.0025056114f, 0.0451992936f, 0.0181196481f, 0.026528744f, -0.0025960952f, -0.0507515706f, -0.0177561734f, -0.0466131344f,
+    0.00868215505f, 0.0319069736f, -0.000775936351f, 0.00457810238f, 0.0390897617f, 0.0229832362f, -0.0178837348f, -0.0211753324f,
+    0.0235359687f, -0.0359250866f, 0.0552207455f, -0.0411708504f, -0.0499086753f, 0.00680945022f, -0.0157641023f, 0.0545038395f,
+    0.0409628004f, 0.0548829921f, -0.0251779314f, -0.0440007634f, -0.0436967276f, -0.0161948763f, 0.0028266029f, 0.0441749878f,
+    -0.00992565788f, 0.0206081532f, -0.0546752103f, 0.0445278548f, -0.0338010415f, -0.0149778835f, -0.0179753248f, -0.0278873742f,
+    -0.0293870624f, 0.0316220894f, 0.0397948995f, -0.0137829147f, 0.019109318f, -0.0235708468f, 0.0305387005f, 0.0312561281f,
+    0.00762237841f, 0.0109450901f, -0.0387385301f, -0.0147485156f, -0.00877790991f, 0.0223459899f, -0.0486927889f, -0.0149093177f,
+    0.00319843437f, -0.00566436816f, -0.0468525775f, 0.0427862443f, -0.0432120934f, -0.0426338837f, -0.0137946568f, -0.0255059805f,
+    -0.0510501713f, 0.0229242723f, 0.0516538844f, -0.0497613065f, -0.0349443182f, -0.00474802125f, 0.01322925f, -0.0337226279f,
+    -0.00917167868f, 0.0301504638f, -0.0450789668f, -0.0297739003f, 0.0228709001f, -0.053724397f, 0.0242921859f, 0.0185298827f,
+    0.0446283072f, 0.012166881f, -0.0263529085f, 0.0383715481f, -0.0135637624f, -0.000566280214f, -0.0328097381f, -0.0385662839f,
+    0.0417449139f, 0.0189019553f, -0.00577843608f, -0.0479183048f, 0.0146095045f, -0.0479598604f, -0.0514378846f, 0.0155579522f,
+    -0.0254515614f, 0.0149796698f, 0.0530715436f, -0.0495307595f, -0.00893223472f, -0.0273412596f, 0.00811407529f, 0.0354968309f,
+    0.0391808189f, -0.00989961438f, 0.0125684738f, 0.0365973599f, -0.00669105118f, 0.0454304852f, 0.042743694f, 0.00328070135f,
+    -0.0430975333f, -0.0144764511f, 6.53005554e-05f, 0.0077626626f, 0.0529509597f, -0.0214084517f, 0.0372434072f, 0.00676202914f,
+    -0.0523031838f, -0.00439410936f, -0.0454191826f, 0.0187130962f, 0.0529603474f, -0.0288259853f, -0.0278143436f, 0.0400908552f,
+    -0.0493223108f, 0.0291560944f, 0.0459116213f, 0.000538564636f, 0.0120815691f, 0.000853758596f, 0.0116729587f, 0.00834263675f,
+    0.0166636296f, 0.0133886859f, -0.0534086414f, -0.00588678615f, -0.00596986618f, 0.00555769773f, 0.036026787f, 0.0537631214f,
+    0.00260801706f, 0.0301664043f, 0.0309399199f, -0.0128559461f, 0.00150801032f, 0.023237735f, 0.0300154239f, 0.0499504507f,
+    0.0236172881f, -0.0296796579f, 0.0163059197f, -0.0426438861f, -0.00651682075f, -0.00482097873f, 0.0520278662f, 0.0438290946f,
+    0.0116378861f, -0.0175978485f, -0.0323881768f, 0.0238057543f, -0.0170391537f, 0.00378284068f, -0.0203391798f, -0.0255911071f,
+    -0.0337836854f, -0.0234572124f, -0.0153701268f, -0.0373292863f, -0.0486272536f, 0.0483156517f, -0.0554071553f, 0.0208259113f,
+    0.0556135327f, -0.0120631559f, -0.0074307886f, 0.0159733985f, -0.0257403068f, -0.000141190205f, 0.0189342145f, 0.0492657647f,
+    0.0542138852f, -0.01369543f, 0.0317611396f, -0.0209885538f, -0.0223738067f, 0.0100467429f, 0.0417012572f, 0.0103024272f,
+    -0.040133696f, 0.0376217552f, -0.0535590611f, -0.0100163082f, -0.00328040146f, 0.015377664f, -0.00115482486f, -0.0304865614f,
+    0.011116528f, -0.0189789701f, 0.0296458323f, -0.0145558063f, -0.013393038f, -0.0295212287f, 0.0431263819f, 0.0127163548f,
+    -0.039103657f, -0.0403321832f, 0.0092501808f, -0.0433562621f, 0.0487937331f, -0.00296985894f, 0.0388777405f, -0.0327799655f,
+    -0.0196370948f, -0.0258190352f, -0.0487643518f, 0.0180913117f, 0.0262005031f, 0.0492454618f, 0.024234822f, 0.0331879146f,
+    -0.0343033299f, -0.0327891298f, -0.0215830151f, -0.00237433054f, 0.000898180821f, -0.0371537954f, -0.0374958329f, -0.0472639911f,
+    0.0480575562f, -0.0370276868f, 0.0450399406f, 0.0492923297f, -0.0425319523f, 0.0409157835f, -0.0187049806f, -0.0494766831f,
+    0.0455385223f, -0.0272515286f, -0.0360745154f, -0.0303744003f, -0.000452379085f, 0.0460430682f, -0.0089467885f, -0.0436046422f,
+    0.0514602549f, 0.00659043109f, -0.0471778139f, 0.0410644189f, -0.0505757667f, 0.0541747175f, -0.0228211544f, 0.0341218151f,
+    -0.0100077642f, 0.0538668446f, -0.0202604178f, -0.004363955f, -0.00425777724f, 0.0153268976f, -0.0223796237f, 0.00227188482f,
+    -0.0325161107f, 0.0395950787f, 0.000115593772f, 0.0480668917f, 0.0294037815f, -0.00822101906f, -0.0511295013f, -0.0539957955f,
+    0.0339992791f, -0.0192082524f, -0.0476916693f, 0.0194673017f, -0.0325355493f, -0.00286998576f, 0.0272255931f, 0.0411902368f,
+    -0.0375841558f, 0.00195024675f, -0.00377984182f, 0.0214830693f, -0.017656479f, 0.0143943438f, 0.0275169834f, 0.0430860519f,
+    -0.051421836f, -0.0168207996f, -0.0267689023f, 0.0430553816f, -0.0192689747f, 0.0308816433f, -0.0381274857f, -0.0480746292f,
+    -0.034552075f, 0.00456620753f, -0.00409148401f, -0.0217709132f, 0.0165482219f, 0.00397020578f, -0.0440922603f, -0.0295786243f,
+    0.0147325955f, -0.0090188738f, -0.0252827555f, 0.00608710572f, -0.0255057868f, 0.0163509287f, 0.00956813339f, -0.0518763624f,
+    -0.0184993148f, 0.0134500284f, 0.0259722136f, -0.0161850415f, -0.0278651435f, 0.0219513886f, -0.05526416f, -0.00840116013f,
+    0.00425023353f, 0.0295012686f, -0.0552426018f, 0.0231861006f, 0.0509159975f, -0.0540424213f, 0.00420293259f, -0.00719437655f,
+    0.0198480431f, 0.0159379002f, 0.0421073548f, -0.0153285898f, -0.0427902937f, -0.00958997849f, 0.0514400564f, -0.00294452929f,
+    0.0232417267f, -0.0403690487f, 0.0538494661f, -0.0412096269f, 0.0116161145f, -0.00199328293f, -0.0102244178f, -0.00924697518f,
+    -0.0523290336f, -0.026165111f, -0.028405834f, 0.0168829747f, -0.00953853875f, 0.0186611507f, 0.00111091579f, 0.0273498371f,
+    0.0545170009f, 0.026393313f, -0.0132730855f, -0.0318168439f, -0.00275671761f, -0.036895413f, -0.00513999118f, 0.0512904562f,
+    -0.0198108051f, 0.049219951f, -0.00853561983f, 0.0107611232f, -0.0162411984f, 0.0313140862f, -0.0083201658f, 0.00935716461f,
+    0.0227226075f, -0.0286367889f, -0.0489072241f, -0.00913087558f, -0.0525614806f, 0.016649941f, 0.0114429239f, 0.0142789036f,
+    0.0558721833f, -0.0104875257f, 0.0228650235f, 0.0495747551f, -0.0223802179f, -0.0510258228f, 0.00607519038f, -0.0332059897f,
+    -0.0258219074f, 0.00946163666f, -0.0102519738f, -0.0426597744f, 0.0260597132f, 0.0256455317f, 0.00191408792f, -0.0490485653f,
+    0.0147500886f, 0.0222650096f, -0.055668626f, 0.0153874066f, 0.0166561995f, -0.0319028758f, 0.0138513278f, 0.0496532694f,
+    -0.00710731791f, -0.0261726938f, -0.0207898058f, -0.0309733674f, 0.0318985023f, 0.0185853746f, -0.0494608134f, 0.00145212596f,
+    -0.0449311584f, 0.0150706135f, -0.010558418f, 0.0301565733f, -0.0469754003f, -0.0419985391f, -0.000188084785f, 0.0169983432f,
+    0.0077601634f, -0.0519743226f, -0.0364585221f, -0.00975723844f, 0.0554482117f, -0.0119347675f, 0.0336233526f, -0.0324404612f,
+    -0.0497160852f, -0.0315614939f, 0.0286239944f, -0.0181888063f, 0.0341124237f, 0.00109354942f, -0.0361589082f, 0.0111141223f,
+    -0.0406154059f, 0.0214150101f, -0.0268934183f, -0.0244213138f, -0.0365742147f, -0.0465910025f, -0.016044857f, -0.0242263917f,
+    -0.0417705365f, -0.0463775545f, -0.0213005356f, -0.0205947515f, -0.000123977094f, -0.0293332506f, 0.00379420933f, -0.0154931573f,
+    0.0215593111f, -0.00649870792f, 0.0373125188f, 0.0154796764f, -0.0417115279f, -0.0189942718f, -0.00229623518f, 5.94762168e-05f,
+    -0.00836506858f, -0.0310080461f, -0.0465446599f, -0.00308177434f, 0.0374691226f, 0.00610587839f, -0.0405989364f, 0.0179481152f,
+    -0.0273051206f, 0.00249070395f, 0.00217517023f, -0.0131691601f, 0.0223737322f, -0.00960933696f, -0.0530636124f, 0.0328211412f,
+    -0.0408336036f, -0.0277128313f, -0.0415442586f, 0.0324974842f, 0.00307832239f, 0.0312899202f, -0.0248908922f, -0.0104438504f,
+    0.00996190961f, 0.0153843742f, 0.048758015f, 0.0278433319f, -0.045578707f, 0.0504342839f, 0.053717766f, -0.0231748261f,
+    -0.0494719371f, -0.0178299826f, -0.018434681f, -0.00831220299f, 0.00083995075f, -0.0432985909f, -0.0306558739f, -0.0481469259f,
+    0.0311906263f, -0.015197156f, -0.0516086146f, -0.00697297137f, -0.0289719738f, -0.0222785771f, -0.030210793f, -0.0396250412f,
+    -0.0375688709f, -0.0419272669f, 0.0200799629f, 0.0416317657f, 0.0113411443f, 0.0272626914f, 0.0197031945f, -0.0127010811f,
+    -0.0173787829f, 0.0399208218f, -0.00551842013f, -0.0206632577f, 0.00648430688f, 0.0459804945f, 0.0228302237f, -0.0217658095f,
+    -0.0313795581f, -0.0272492971f, 0.0331302993f, 0.0502961949f, 0.0180301964f, 0.000615320634f, -0.0228332225f, -0.0450086892f,
+    -0.0465017967f, 0.0159752052f, -0.0396106802f, -0.0128151886f, -0.0279097129f, -0.0200970694f, -0.04360741f, -0.00547204493f,
+    0.0203493889f, -0.00201973226f, 0.0407717042f, -0.0175400265f, -0.0276748203f, 0.0550964475f, -0.0212521814f, 0.0422995724f,
+    -0.0216978025f, 0.0134344678f, -0.0239041802f, -0.0517847314f, -0.0102577116f, 0.0375147983f, -0.0303402748f, -0.00846564118f,
+    0.0418765023f, -0.0401467532f, 0.00342091196f, 0.00430946331f, -0.0494519249f, -0.0199236795f, -0.0366944782f, 0.0550314523f,
+    -0.0498243235f, 0.0160896592f, 0.00942675676f, -0.0464166701f, 0.0511616021f, 0.0173658747f, -0.0255023353f, 0.0251476243f,
+    0.0399237424f, 0.0241708737f, 0.0271472316f, 0.0039027126f, 0.0284371022f, -0.0544405282f, -0.038340535f, 0.0167416856f,
+    0.0135744913f, 0.00789861474f, -0.0296397265f, -0.0365877151f, 0.0102314288f, 0.0535599068f, 0.00782635063f, 0.0546622202f,
+    -0.011459318f, 0.0358179882f, 0.0352151059f, 0.0414979644f, 0.00243299385f, 0.0184545331f, 0.0374541767f, 0.0273117051f,
+    -0.000904325047f, 0.0301642641f, -0.0327763259f, -0.0176738929f, -0.000278948457f, -0.0477201231f, -0.0250898264f, -0.0222476758f,
+    -0.0427639857f, -0.0190097913f, -0.0286998563f, -0.0299018696f, -0.0529896021f, -0.0216968767f, 0.0106199728f, -0.00882238522f,
+    0.0254412871f, 0.0518492609f, 0.010795583f, -0.052177269f, 0.0548236556f, -0.0126404986f, 0.0461054109f, 0.0548192039f,
+    0.0318304971f, -0.0155980494f, -0.0165660363f, -0.0200548936f, -0.0431221165f, -0.0285065211f, 0.0367735997f, -0.037496414f,
+    -0.00631386833f, -0.0267309714f, -0.00343959127f, 0.0363255739f, -0.00657832948f, 0.0317167304f, 0.0183807835f, 0.049603384f,
+    0.0124681545f, 0.0108009744f, -0.0321148895f, -0.0539822541f, 0.053469792f, -0.0450180322f, -0.0296574607f, -0.0104801161f,
+    -0.0101010809f, 0.0331454799f, -0.00746509479f, 0.0481425896f, 0.0451945327f, 0.051124189f, 0.0444492511f, 0.0274286922f,
+    -0.0511120558f, -0.0131151956f, 0.039710559f, -0.0181660298f, -0.00646122964f, 0.0285504367f, 0.0124954432f, -0.0143865738f,
+    0.0476965532f, -0.0435384288f, 0.0314414948f, -0.0470145643f, -0.0205540545f, -0.038286455f, 0.0235632844f, -0.0263380539f,
+    -0.0137071982f, 0.0248149242f, -0.00932369195f, 0.037137717f, -0.00602223165f, -0.00897036586f, 0.0106867664f, -0.0537609085f,
+    -0.00196546735f, 0.0212303232f, -0.0541435294f, 0.0019574305f, 0.0207364149f, -0.0463002063f, 0.0298686549f, -0.0104396185f,
+    0.0244351085f, 0.0326957926f, -0.0432076566f, -0.0114962626f, -0.0138668679f, -0.00223505287f, 0.0470560081f, 0.0175507292f,
+    -0.0278312247f, 0.0445949733f, -0.0357977971f, -0.000589184405f, -0.0105627291f, 0.0211232323f, 0.0244055875f, 0.000457010581f,
+    0.0272351354f, 0.0271210819f, -0.0451828055f, -0.00273021497f, 0.0341133587f, 0.0433337726f, -0.00897281151f, -0.0263262466f,
+    0.0276500098f, -0.0545769222f, 0.0278586131f, 0.020708438f, -0.0500213578f, -0.0180124436f, 0.0263192412f, -0.00776702724f,
+    -0.0235679094f, -0.0500242151f, -0.0543912351f, 0.0225101449f, -0.0395617522f, -0.0272421669f, -0.00347251142f, -0.0388912f,
+    -0.0202059597f, 0.0376282111f, 0.0297078993f, -0.010004486f, -0.0489591882f, 0.0182771906f, -0.0470183119f, 0.00945177395f,
+    -0.041631531f, 0.014393731f, -0.0533137619f, -0.00514510274f, -0.0128368465f, 0.0174752045f, -0.0467056036f, 0.0542412102f,
+    0.0011264229f, -0.0330036953f, -0.0416919738f, 0.0519847795f, 0.0490299463f, 0.00156098907f, 0.00221228856f, -0.0272962321f,
+    0.0184503347f, 0.0207027271f, 0.0459152572f, -0.0266862288f, 0.0527131744f, -0.0153353876f, 0.0243949909f, -0.0124900453f,
+    0.0222304165f, -0.0121868998f, -0.0160083119f, 0.0511196107f, -0.0448160842f, 0.0247970913f, -0.0287510902f, -0.0535269007f,
+    -0.0531152412f, -0.0364685357f, 0.0427622385f, 0.0244695209f, -0.0404156521f, -0.0325708166f, -0.011660317f, -0.0476199649f,
+    -0.0272610523f, -0.00801498163f, 0.0267152376f, 0.026226012f, -0.0383804105f, 0.0484695919f, -0.00571908616f, -0.0129945306f,
+    0.047074534f, 0.0475055762f, 0.0252563935f, 0.0335061811f, -0.0539653599f, -0.00949229766f, -0.0132983821f, -0.0042323675f,
+    0.0169066861f, -0.00640639151f, -0.0235072989f, 0.0207536146f, -0.0506183505f, 0.049741596f, 0.000316793303f, 0.0389626585f,
+    -0.0210997295f, -0.0172235649f, -0.00702834921f, 0.0520370044f, 0.0553695001f, 0.0112399254f, 0.0155629162f, -0.0356721282f,
+    -0.0429803208f, 0.0449918695f, 0.0376098268f, -0.0325836651f, -0.00370472507f, 0.0185388867f, -0.00876662135f, -0.0265864078f,
+    -0.034373682f, -0.0483279265f, -0.0171578452f, 0.0423059762f, -0.0447624736f, -0.0163631234f, -0.026482204f, 0.0425775684f,
+    -0.00583205465f, -0.0403706096f, 0.00668245461f, 0.014617268f, 0.0437201113f, -0.047506135f, 0.00395550486f, 0.0062815682f,
+    -0.0406217761f, -0.032759998f, 0.0445825569f, -0.0184090044f, -0.0288798176f, 0.0123822289f, 0.0528246351f, 0.0174824353f,
+    -0.0383677371f, 0.0155355008f, -0.040946871f, 0.047935836f, -0.0230052397f, -0.0325614139f, 0.0277738459f, 0.00269744801f,
+    -0.0536951534f, -0.00966338255f, 0.0531053916f, 0.00561901322f, 0.0397018827f, 0.0070420038f, 0.0362084545f, 0.0525093488f,
+    0.0323584192f, 0.0100018736f, 0.0536266267f, -0.0274502169f, -0.000306963921f, 0.0440519564f, 0.0485275872f, 0.00985813141f,
+    0.011497722f, 0.0543063283f, -0.0543799475f, 0.0285300836f, -0.0271274317f, -0.0477643944f, 0.00176120899f, -0.0117390789f,
+    -0.0556109734f, -0.00865073409f, 0.0126146423f, 0.0229768585f, -0.0466404818f, 0.0476846434f, 0.0542373173f, 0.0241406802f,
+    0.021386588f, -0.0260818377f, -0.000785392593f, -0.000697601063f, 0.0517160408f, 0.00984244421f, 0.0362231135f, 0.045469977f,
+    0.0417201109f, -0.0180632565f, -0.0332836695f, 0.055477161f, 0.0305611119f, 0.0426215157f, -0.048160959f, -0.0117200268f,
+    0.0436308868f, -0.0261898395f, -0.0379427187f, 0.0357265212f, -0.0270229671f, -0.000536838663f, -0.00135791034f, -0.0233411863f,
+    -0.0113564385f, 0.0531496592f, 0.0199897736f, -0.00716504129f, 0.0150852809f, 0.0366349295f, -0.0435436405f, -0.0341900475f,
+    -0.033438623f, -0.0530042425f, 0.0216429792f, 0.036214672f, 0.0538750887f, 0.0107546728f, -0.0206538215f, -0.0267624576f,
+    -0.020375099f, 0.0348268338f, 0.0550686046f, 0.0309359562f, 0.0289532281f, 0.0203144494f, -0.0527593344f, -0.000341076928f,
+    0.0303216018f, -0.0438501462f, -0.00508324057f, -0.0128959827f, 0.00672165211f, -0.0415612534f, -0.00238038809f, 0.0170152299f,
+    0.0551357269f, -0.0249813907f, 0.0159958564f, -0.0427056216f, -0.0527032651f, -0.00716513488f, 0.0472094566f, -0.020125173f,
+    -0.00619576918f, -0.0205180421f, 0.0554111749f, -0.0202858075f, -0.0265586525f, 0.0255482569f, -0.0127461292f, 0.0205996688f,
+    0.0209085252f, 0.0409536697f, -0.0443532355f, -0.0339783467f, 0.0209334753f, -0.035572201f, -0.0290974118f, 0.0295683835f,
+    0.0316445716f, 0.0298165902f, 0.0287378281f, -0.0366447717f, -0.0275929663f, -0.0217583664f, 0.0302517563f, 0.0210892074f,
+    0.0518492721f, -0.0145952702f, 0.0126021672f, 0.0384690091f, -0.0459028445f, -0.0307844821f, 0.0102584241f, 0.052637659f,
+    -0.0316343755f, -0.00302957511f, 0.0541374125f, -0.00168798503f, -0.0134794693f, -0.0541022308f, 0.0303086601f, -0.0320093073f,
+    -0.0169875342f, 0.0303946845f, 0.0126214866f, 0.0321349502f, 0.0066507603f, -0.0145090045f, -0.0165660754f, -0.0367116332f,
+    0.0436789915f, -0.0263912659f, 0.0130793434f, -0.0405508988f, 0.0344392732f, -0.0524199121f, 0.0257408395f, -0.0227115918f,
+    -0.0154485423f, -0.0142301358f, 0.00615913048f, 0.0139816087f, -0.0224783048f, -0.0169468168f, 0.0183835886f, 0.0339267813f,
+    -0.0422192253f, -0.015895471f, 0.0305832699f, -0.0410478339f, 0.0477010794f, -0.0305136442f, -0.00839795545f, 0.00453967135f,
+    0.039805308f, -0.0542776734f, -0.00451409491f, 0.0444955602f, -0.0534103736f, -0.0137060853f, -0.0440140329f, 0.026703069f,
+    -0.0328088999f, 0.0176472627f, -0.0248440523f, 0.00144572859f, 0.0489239544f, -0.0360836051f, 0.0550444201f, 0.0431987569f,
+    -0.0484560169f, -0.023776859f, 0.05157746f, -0.0425392352f, 0.0427676439f, 0.0136440368f, -0.0546292737f, 0.0224992428f,
+    -0.0289827976f, 0.0054566781f, 0.0413776189f, 0.0298446789f, -0.00515211327f, 0.030379625f, -0.0318048559f, 0.0070490879f,
+    -0.0370470993f, 0.0205016807f, -0.0406891219f, -0.00422704965f, 0.0217939243f, -0.0216284972f, -0.032685224f, 0.0359790735f,
+    -0.0154881999f, -0.0208505746f, -0.00242711604f, 0.0203074459f, -0.0314848237f, 0.0489513502f, 0.0140332747f, -0.0484806076f,
+    -0.0413452871f, -0.0114706196f, 0.00401651394f, -0.00758845219f, 0.0302129053f, -0.038473323f, 0.0156959109f, -0.00991370901f,
+    0.0141050396f, 0.00363999768f, -0.0321964063f, -0.00651930645f, -0.0557832196f, 0.00607864931f, -0.0153928781f, -0.0284001622f,
+    -0.0418148451f, -0.0352040343f, -0.0358145908f, -0.0439877771f, -0.0346064866f, -0.000699593569f, -0.0207167696f, -0.0542137548f,
+    0.009954446f, -0.0308029149f, 0.0517702177f, 0.0208375603f, 0.0344427451f, -0.0493705645f, -0.0361831449f, -0.0430371426f,
+    0.00868416764f, 0.0485224761f, -0.0528894365f, 0.0542773865f, -0.0298898742f, 0.0111180609f, -0.00707380474f, -0.0548852868f,
+    0.024437055f, 0.00191063597f, 0.0208919663f, 0.0103100901f, 0.0185271911f, 0.00594849465f, 0.0262755863f, 0.0229121912f,
+    0.0266587064f, -0.0143722659f, 0.0557984672f, 0.00636233576f, 0.000415113987f, 0.0502605215f, -0.0423825197f, 0.0399327837f,
+    0.0558937564f, -0.00199661497f, -0.0536801927f, -0.032621216f, 0.00483912509f, 0.0044312682f, -0.0552355312f, 0.0343510099f,
+    0.0549151674f, 0.0306549408f, 0.0426821113f, -0.0219045077f, -0.0554178469f, 0.0552526042f, -0.0158855077f, -0.00715560513f,
+    -0.0278017558f, 0.0456116088f, -0.0167240854f, 0.00382001908f, 0.0116252778f, -0.000133260037f, -0.00481158914f, 0.0389686041f,
+    0.0372090861f, -0.0539230518f, 0.0462474599f, -0.0137217129f, -0.028834749f, 0.0101133427f, -0.0355146229f, -0.00999488309f,
+    -0.0146555863f, -0.0232747458f, 0.0423902422f, -0.000215953638f, 0.0360105783f, -0.0509097688f, 0.0400215946f, 0.0238614306f,
+    -0.00104977353f, -0.0455099083f, -0.0321136191f, 0.0104500679f, 0.0520476997f, -0.039170716f, -0.0430260152f, 0.0138142556f,
+    0.0231703017f, 0.00972298533f, 0.0493701957f, -0.0282160565f, -0.0555041432f, -0.043539837f, -0.0470984876f, 0.00153737853f,
+    0.0167179611f, 0.0293936916f, 0.0487515368f, 0.0450488441f, 0.00954054482f, -0.0179173145f, 0.0303212553f, -0.00783844572f,
+    -0.0183983501f, -0.0424006172f, -0.000284412934f, -0.0528932959f, -0.0523181595f, 0.0371050686f, 0.0554002374f, -0.0395299941f,
+    -0.0205558538f, 0.0280196294f, 0.00449556904f, -0.00399255008f, -0.0171981957f, 0.0227341019f, 0.006797635f, 0.0182105638f,
+    -0.0554667711f, 0.0517675653f, 0.0514996387f, 0.0539101809f, -0.0011665069f, 0.0313974582f, 0.0241318159f, -0.0288710687f,
+    -0.0402457714f, 0.0408008844f, -0.00996103045f, 0.0439868905f, -0.0476895683f, -0.0526610129f, 0.0382428132f, 0.0277101528f,
+    0.0209076665f, 0.00643653283f, -0.0517909378f, -0.00849766191f, 0.00937498454f, 0.0130968224f, 0.0166741256f, 0.0464122817f,
+    0.0446375087f, 0.0482756831f, 0.0434841104f, 0.0334722213f, -0.00144698808f, 0.0105107902f, -0.0407516174f, 0.0353775918f,
+    0.0550462678f, -0.0327758268f, -0.00780413253f, -0.0170461163f, 0.0223155227f, -0.0356016755f, -0.0469234549f, -0.00899053831f,
+    -0.0261946656f, -0.0229010154f, -0.0460135527f, 0.0269439854f, 0.00816261582f, 0.0192989092f, -0.0409705639f, -0.0316242017f,
+    0.00688321423f, -0.0222225543f, -0.0102803428f, -0.0510911904f, 0.0219556876f, -0.0395589359f, 0.044253625f, 0.0503955744f,
+    0.00380770396f, 0.00866473466f, -0.0481125787f, -0.0501606762f, 0.0259659104f, -0.013380629f, 0.0400148109f, 0.0204141159f,
+    -0.00703488663f, 0.00274205673f, -0.00310139987f, -0.0175037999f, -0.0247851815f, -0.0479071625f, 0.0351617932f, -0.0485354178f,
+    0.0365087464f, 0.0470591821f, -0.0189514756f, -0.0373423994f, -0.00256432127f, 0.0320959203f, 0.0365213491f, 0.0373852775f,
+    0.00757972244f, -0.0202686749f, 0.0501018763f, -0.0494520031f, 0.00660789106f, 0.00197572331f, -0.0404336788f, 0.0116295163f,
+    -0.0266902074f, 0.0168176685f, 0.0146813961f, 0.0110578379f, 0.0110612297f, 0.0375609547f, 0.0327221602f, 0.0229220875f,
+    -0.0410654321f, -0.0408023484f, -0.047771275f, 0.0493428484f, 0.0153836086f, -0.0181096923f, -0.00945075415f, 0.00859928131f,
+    0.0428796522f, -0.0456625074f, 0.0102983555f, -0.0453015976f, -0.00723638618f, 0.0346701145f, 0.0528222956f, -0.0297117513f,
+    -0.0530173779f, -0.00242710277f, 0.0455310196f, 0.0407206826f, -0.0338133648f, -0.016081702f, 0.00270357216f, 0.0494747013f,
+    -0.0263109785f, 0.0022041786f, 0.0530393422f, -0.0348625779f, -0.0268623438f, 0.00870472565f, -0.0227026343f, 0.0151955234f,
+    0.0430547111f, 0.0100206863f, -0.0514338315f, -0.000203825155f, -0.0233744532f, -0.0553487726f, 0.0487403348f, 0.0547361858f,
+    -0.0446872897f, 0.00845282618f, -0.046815984f, -0.00309883407f, -0.0438012518f, 0.0521183647f, -0.0466824844f, -0.0221191347f,
+    -0.0286817234f, 0.009489052f, 0.0436336659f, 0.0393151864f, -0.0466173515f, 0.0157169551f, -0.0310537089f, 0.0220917463f,
+    -0.0340493433f, 0.0450013578f, 0.0541897044f, -0.0437181108f, -0.00135421182f, -0.040993169f, 0.00584220374f, -0.0371991582f,
+    -0.00171547395f, 0.00212035212f, 0.0378546081f, 0.0314894728f, -0.0237948373f, 0.0538377762f, -0.0108817285f, 0.0156662744f,
+    0.0117164347f, 0.0374237224f, -0.0280014295f, 0.021569334f, -0.00871916022f, -0.0261626113f, 0.0219341479f, 0.0518711247f,
+    0.0214145035f, -0.0413340107f, 0.0414276868f, -0.0122235455f, -0.0416172855f, -0.0372663848f, 0.0283369943f, 0.0484578349f,
+    -0.00927341171f, 0.0432203114f, -0.000450639782f, 0.0434937477f, -0.034244772f, 0.00591355516f, 0.0421648771f, -0.0516444407f,
+    0.000693949172f, -0.0404435061f, 0.0151903052f, -0.0432785936f, -0.0416474454f, -0.0118941041f, -0.0547615811f, -0.0482155308f,
+    -0.03786413f, -0.0300306845f, 0.00023128085f, -0.0166710466f, -0.0424006507f, 0.0471984111f, 0.0172387734f, 0.0520556308f,
+    0.0369959176f, -0.023923507f, -0.0306649506f, 0.0118269771f, -0.0529774018f, 0.0494517572f, 0.0238484759f, -0.0433100015f,
+    0.0319787972f, 0.0497435071f, 0.00279426924f, -0.0408625044f, -0.0362877436f, 0.0458272472f, 0.0520380698f, -0.00165306567f,
+    -0.0464385301f, 0.0536296666f, -0.0158090722f, -0.0556465946f, 0.0211950038f, 0.0399880297f, -0.00799023174f, 0.0490075611f,
+    0.0106337806f, -0.0261119045f, -0.0498987138f, -0.014621973f, -0.0301018227f, 0.0168246254f, -0.0468784012f, -0.0436543822f,
+    -0.0195662417f, 0.0135085918f, -0.0442187898f, 0.0487283133f, 0.000544728828f, -0.0138442107f, 0.0034962818f, -0.0212319102f,
+    0.0196551867f, 0.0364399999f, -0.0100782765f, 0.0215046741f, 0.023735296f, -0.00469792122f, 0.0466497503f, 0.0305188429f,
+    0.0511689708f, 0.00753730582f, -0.0300012566f, -0.0309803579f, -0.0529138856f, 0.0134898722f, -0.0055166604f, 0.0355297588f,
+    -0.00614182372f, -0.0557739288f, -0.035675846f, 0.0245278589f, -0.0467043296f, -0.0475527979f, -0.00548923807f, 0.0483278222f,
+    -0.00112889521f, 0.0224439055f, -0.00127154484f, 0.0193873271f, -0.0376018621f, 0.0512779541f, 0.05543603f, 0.036458455f,
+    -0.0465071276f, 0.0326796994f, 0.00598584628f, -0.055306904f, -0.0112891058f, 0.0411771014f, -0.000815860403f, -0.0188948978f,
+    -0.0512694791f, -0.0322630517f, -0.0340608805f, 0.0476915278f, -0.054880619f, 0.0153048728f, -0.0113765104f, 0.0210238136f,
+    -0.0126595506f, -0.00629721535f, 0.0472924821f, -0.0107704867f, -0.00137585646f, -0.027203016f, 0.00923713949f, 0.0189939048f,
+    -0.0301607121f, 0.0440501496f, -0.0510438494f, -0.0114241848f, 0.0515386686f, -0.0135629363f, -0.009966488f, 0.0445321798f,
+    -0.00949495006f, -0.0337213501f, 0.0186858606f, -0.0021384249f, -0.0469340533f, -0.033450529f, -0.0211148635f, 0.0260016154f,
+    -0.0317340083f, -0.0018619888f, 0.0152997682f, 0.019162124f, -0.0471276753f, -0.0351695493f, 0.0351382345f, -0.0380408876f,
+    -0.012302747f, 0.0527471602f, -0.0327093601f, -0.0241004098f, -0.0357307456f, -0.0321649387f, -0.0522319116f, -0.0368045419f,
+    0.0165181477f, 0.0346013904f, -0.0547909364f, 0.0446292683f, 0.00102392386f, 0.0342906676f, 0.0255003218f, -0.0424357317f,
+    0.0142413648f, -0.00990651175f, -0.0428520516f, -0.021192126f, -0.0388241f, 0.00993771292f, 0.0194269773f, 0.0320785977f,
+    0.0460648872f, 0.00469573541f, 0.0220486894f, -0.00446291547f, 0.029917663f, 0.012444823f, -0.0449524894f, 0.00765191996f,
+    -0.0268962644f, -0.0545322411f, -0.0344758742f, 0.0387948193f, 0.0281932782f, 0.0533068031f, 0.0287691429f, 0.0139619168f,
+    0.0353921466f, 0.00742167886f, -0.0373424813f, -0.0134716062f, 0.0167859942f, -0.0514225513f, 0.00507735647f, 0.00152841548f,
+    0.00930511206f, -0.0105641559f, 0.0473617539f, 0.0456267148f, -0.00137213792f, -0.045599699f, 0.00181364804f, -0.00632788287f,
+    -0.0556616485f, 0.0271766726f, 0.0510646328f, -0.0187969431f, 0.0374865308f, 0.00933314115f, 0.0255714413f, 0.0117544662f,
+    0.0391464867f, -0.0250067525f, 0.040039368f, 0.014009431f, 0.0104384189f, -0.0526835509f, -0.0272330958f, 0.000544815441f,
+    0.0497558042f, -0.0173814353f, -0.0446972139f, 0.0274911523f, 0.0399736203f, -0.0289917924f, -0.0438629128f, -0.0149661954f,
+    -0.0517848916f, 0.0171480235f, -0.00764073804f, 0.0228628032f, -0.00382870226f, 0.0478299148f, 0.0023198924f, -0.0494366325f,
+    0.0310754534f, -0.0324770808f, -0.0557276011f, 0.00283074146f, 0.00977900904f, 0.00800121389f, 0.0197668429f, -0.00182471029f,
+    -0.0364373028f, -0.0368806794f, -0.0201781504f, 0.0396743156f, -0.00515710423f, 0.0149786165f, -0.034757562f, 0.0123258913f,
+    0.00191698014f, 0.0163264312f, 0.023418555f, 0.031136455f, 0.026448397f, 0.0491514131f, -0.042418845f, 0.0311642848f,
+    -0.0218902063f, 0.0388619341f, 0.0542129129f, -0.0442645736f, 0.0292394273f, 0.0199186485f, 0.0501580685f, -0.0447741747f,
+    0.0477988385f, 0.0536202043f, -0.011972772f, 0.000306704023f, 0.0479401238f, -0.0335103199f, 0.0554736443f, 0.0272029079f,
+    -0.0174358618f, -0.0486917756f, -0.0152527876f, -0.0500060432f, -0.0451499633f, 0.0449603871f, -0.0510279536f, -0.0246685557f,
+    0.0557779819f, -0.0354272611f, 0.0189467035f, 0.0221569389f, 0.0549223572f, -0.0133871334f, -0.0156887397f, -0.0304184426f,
+    -0.0493899621f, -0.021908652f, -0.032478366f, 0.0190051273f, -0.0540362634f, -0.0509368032f, -0.00435136678f, -0.0104515469f,
+    -0.0513380356f, -0.00459161727f, -0.0478582419f, 0.0358857289f, 0.0547165535f, 0.00393538643f, -0.0318389274f, 0.0084651215f,
+    -0.0307387952f, 0.0321150124f, -0.0164321419f, -0.000640357262f, -0.0416755602f, -0.0252670217f, -0.0539646931f, 0.0170368534f,
+    0.0261288788f, 0.00249974034f, -0.00275079999f, 0.0394630246f, -0.0393619314f, -0.0444986857f, -0.0226574f, -0.0462567881f,
+    0.0370159633f, -0.00981407519f, 0.00459315674f, 0.0207661893f, -0.0436593592f, -0.010090678f, -0.0246726945f, 0.00313473982f,
+    -0.0167575926f, 0.0179710537f, 0.0168040935f, -0.0308165103f, -0.0164731201f, -0.0480495803f, -0.00874262396f, -0.0106539065f,
+    0.0137530603f, -0.040697705f, 0.0527242161f, 0.048225943f, 0.0203846153f, 0.0218007229f, -0.0116349943f, 0.022782756f,
+    0.0469729342f, 0.00688600633f, -0.0253059529f, -0.0119167482f, -0.0339859761f, 0.0288592465f, 0.0351043344f, 0.0322499387f,
+    -0.0181664824f, -0.016164029f, -0.00366540765f, 0.00715106027f, 0.0505541228f, 0.0125722261f, -0.0520486012f, 0.0176408198f,
+    -0.0535775609f, -0.0268053282f, -0.0292823501f, -0.0460013375f, -0.0103784101f, -0.0336899608f, 0.0558743216f, -0.00852247886f,
+    0.0222692005f, -0.012712203f, 0.0449707843f, -0.0446554087f, 0.0277657229f, -0.0165329613f, -0.0197041407f, -0.00623995159f,
+    -0.003024064f, -0.0463920832f, 0.0427486785f, -0.0259246938f, 0.0516709834f, 0.000897461141f, 0.00200383877f, 0.0428969786f,
+    0.0113326684f, 0.0459345728f, -0.0386737958f, 0.0126755843f, 0.000998667325f, 0.035892915f, -0.0189017151f, -0.0450654514f,
+    0.0416364372f, -0.0369002856f, -0.0187055524f, 0.0284800176f, -0.0203702468f, 0.0449759737f, -0.0138855344f, -0.0366733335f,
+    0.0231402069f, -0.0157303754f, -0.00172086514f, 0.0426875427f, 0.00285137305f, -0.00939774886f, 0.0219330899f, 0.0355709605f,
+    0.0452816933f, 0.0430828333f, 0.0238028355f, 0.0149665819f, 0.0221728608f, 0.00397650339f, 0.0318624191f, 0.0493194386f,
+    -0.0325004049f, 0.0478783548f, 0.0260146707f, -0.00967727043f, -0.0178991556f, -0.0187730789f, -0.0279154498f, -0.00849884842f,
+    -0.0548757575f, -0.00238178764f, 0.0357310846f, -0.011979783f, -0.0503248014f, -0.0485954881f, 0.000397647644f, -0.0223488901f,
+    0.00181848614f, -0.00601957273f, 0.0534805879f, 0.0461485796f, 0.00988445431f, -0.0181424916f, -0.055430986f, 0.0197450444f,
+    -0.0532851331f, 0.0111270836f, 0.0133437105f, -0.0212586988f, 0.0508507453f, 0.0506984517f, -0.0110220192f, 0.022000635f,
+    0.0298921596f, 0.0234994832f, -0.0364858285f, 0.0183071122f, 0.0198305231f, -0.00963923894f, -0.031282369f, 0.0315552354f,
+    -0.00930106081f, -0.0421347357f, 0.0547024533f, -0.0346768461f, 0.03292346f, -0.00463957153f, -0.0213260725f, 0.0416195951f,
+    0.031924352f, -0.0159862544f, 0.0405947603f, 0.0298003033f, 0.0017250235f, -0.000357157172f, -0.0184527338f, 0.0474874638f,
+    -0.042071335f, 0.0178428851f, -0.0227377601f, -0.00820871722f, -0.024622906f, -0.00272882869f, -0.0445520505f, -0.0424552411f,
+    0.000123277365f, -0.0245883409f, -0.0329473987f, -0.0149327219f, -0.0523572639f, 0.0150028467f, 0.00885352585f, 0.0440653041f,
+    -0.0451297984f, 0.00952164549f, -0.046439562f, -0.0376939401f, -0.0211038608f, 0.00234802766f, -0.0558411814f, -0.0479522459f,
+    0.0200761724f, -0.00679452298f, -0.0249202289f, -0.0425797813f, 0.0365176164f, 0.0504089482f, 0.0241323765f, 0.0405179188f,
+    0.00643649278f, 0.0347081721f, -0.00729814172f, -0.0497969389f, -0.0121659413f, 0.00443465309f, -0.00892665703f, 0.0485185832f,
+    0.00413350714f, -0.0111539261f, 0.0276101921f, 0.0228215214f, -0.0260526687f, -0.0116146291f, 0.0241486635f, -0.0159285702f,
+    0.0114545729f, -0.0507724024f, 0.0176298562f, -0.0240680426f, 0.0508258156f, -0.0435424f, -0.0230190754f, -0.035949111f,
+    0.0333518647f, -0.0174074918f, -0.0486514829f, 0.0293732546f, 0.0309011023f, -0.0071567446f, -0.00819456298f, -0.014471733f,
+    -0.00948658679f, 0.0552367456f, 0.0352834687f, -0.049573116f, -0.0124698598f, 0.0295080207f, -0.0194861144f, 0.0286466908f,
+    0.00254044402f, -0.00845359266f, 0.0406201296f, -0.026390506f, -0.0533550903f, 0.0214966107f, 0.0435294881f, -0.0353117064f,
+    -0.0536545031f, 0.0251798183f, 0.0379266068f, -0.0185951497f, -0.0105620967f, -0.0482937619f, -0.0185460895f, 0.00610421225f,
+    0.0194121711f, 0.010395823f, 0.0474520363f, -0.045165237f, -0.0161920581f, 0.0152009409f, -0.0240960512f, -0.0545637794f,
+    -0.0479438491f, 0.00531961257f, 0.0363509245f, -0.0424289145f, 0.0533536561f, -0.0151580181f, 0.00565602491f, 0.0129981618f,
+    -0.00151118904f, 0.00216801977f, -0.0346223488f, -0.0237455852f, 0.0485002398f, 0.0554720499f, -0.0127122561f, -0.0525669456f,
+    0.0411011577f, -0.0367169306f, 0.0122975353f, -0.00875987019f, 0.0292402003f, -0.0534063615f, -0.0516793057f, -0.00536709372f,
+    -0.0301646776f, 0.0252393745f, 0.0392642841f, 0.0353414863f, 0.0168420319f, -0.0144799892f, 0.0252437983f, -0.0459295996f,
+    0.018937733f, -0.0221227873f, -0.0341634378f, -0.00530273281f, 0.0026061777f, 0.00311801303f, 0.0129172411f, -0.000403918471f,
+    -0.0260239597f, 0.0384785533f, 0.0155013744f, 0.0147326086f, 0.0209639166f, 0.0298701078f, 0.0436406769f, 0.0116585316f,
+    -0.045536451f, -0.052122198f, 0.00530881062f, -0.00292602996f, 0.00184155686f, 0.029796591f, 0.0539524369f, 0.0298189018f,
+    -0.0467692502f, -0.0446795672f, 0.0290542673f, 0.00206567394f, -0.0314175747f, 0.0156788174f, 0.0379464775f, -0.0307671223f,
+    0.0485713519f, -0.023019582f, -0.0420255736f, -0.0357559882f, 0.0315069333f, -0.054022029f, -0.0155164888f, 0.0111919912f,
+    -0.0201062057f, 0.0113371797f, -0.00444247667f, -0.0243511423f, 0.028067017f, -0.0356010683f, -0.0165686142f, 0.0396368839f,
+    0.0350121669f, -0.0541196987f, -0.0251759999f, 0.0441199653f, 0.0542676374f, 0.0057050786f, -0.00886080973f, -0.00429330301f,
+    -0.0223417133f, -0.0547844172f, -0.0205860939f, 0.0404994637f, -0.011947955f, 0.00519949431f, 0.00846176315f, -0.0415555611f,
+    -0.0222776644f, -0.0327595808f, -0.0222709272f, 0.00628397381f, 0.039462354f, -0.0389733426f, 0.0411359109f, 0.0212985426f,
+    0.0358371101f, -0.0551676601f, 0.0281351358f, -0.0070619625f, -0.00735878386f, -0.00592215825f, -0.00241104257f, 0.0321909823f,
+    0.0350467451f, -0.0274293385f, -0.0157185346f, -0.032702677f, 0.0210961513f, 0.0172724333f, -0.050902836f, 0.0319618508f,
+    -0.043975275f, 0.00642702309f, 0.0454697832f, -0.019669028f, -0.00301108253f, 0.0422798656f, 0.0185495894f, 0.0231982432f,
+    0.04670709f, -0.0209395606f, -0.0334741957f, 0.0322017111f, -0.0020409571f, 0.00987669732f, 0.00867810939f, -0.0240968503f,
+    0.00180357881f, 0.0405710675f, -0.00208529946f, 0.0435404293f, -0.0497174636f, -0.0512676053f, 0.0363708101f, -0.00824826863f,
+    -0.0478482395f, -0.0340642855f, -0.0505231954f, -0.0180764645f, -0.00294528878f, -0.00909504946f, 0.00217783567f, 0.0514133275f,
+    -0.0187514145f, 0.0336198695f, -0.0377020426f, -0.0158578381f, 0.0205706079f, 0.0110325813f, 0.0110875666f, -0.0472713895f,
+    -0.0535184778f, 0.0297992695f, 0.0469801202f, -0.0276700277f, -0.0189584922f, -0.0557466149f, 0.0146821551f, 0.0277048405f,
+    -0.00230148621f, -0.0044247508f, 0.0490053818f, 0.0395052619f, 0.0443781726f, 0.0351684913f, 0.0210281704f, 0.0189487301f,
+    0.0496389419f, -0.0493124053f, -0.0290567931f, 0.00770241302f, -0.00602175202f, 0.0340357088f, 1.25283232e-05f, 0.0333520621f,
+    -0.0466234274f, 0.0422987379f, 0.00677609025f, 0.00229487568f, 0.0234481841f, 0.0188428909f, -0.00165949634f, 0.00854153093f,
+    -0.0152871339f, -0.0190874599f, -0.0388488658f, 0.0430010036f, -0.0179398656f, 0.0294177365f, 0.00791930687f, 0.0412670448f,
+    -0.00559816789f, -0.0358777456f, -0.0322762877f, 0.0343784727f, 0.0201975238f, 0.00205366546f, -0.0428019576f, -0.0400965326f,
+    -0.0266019963f, -0.0386293009f, -0.0330361947f, 0.0496183038f, -0.0230167434f, -0.0496778153f, -0.0198360682f, -0.026553981f,
+    -0.026566349f, -0.046757888f, 0.0280271247f, 0.0169713665f, 0.0541388839f, -0.0273921862f, -0.0522528104f, 0.00552340457f,
+    -0.047042653f, -0.035323441f, 0.0240953248f, 0.035079252f, -0.0236201677f, 0.0349194556f, 0.0295025092f, -0.00927021261f,
+    0.0541366041f, -0.00380185968f, -0.00647384441f, 0.0466974378f, -0.0127347009f, 0.00499061774f, 0.0537736081f, -0.0468906425f,
+    0.0264043212f, 0.0508106761f, 0.0495426282f, 0.0143205067f, 0.0230073053f, -0.0360324495f, -0.0101380255f, -0.0249352828f,
+    -0.0452987254f, -0.0438545346f, 0.00172329752f, 0.0011604093f, 0.00705056731f, 0.0272967517f, -0.0105388453f, -0.0429225676f,
+    -0.0313277729f, -0.00421789335f, -0.0151240584f, -0.017440293f, -0.00458935136f, 0.04716805f, 0.0227052197f, 0.0264883749f,
+    -0.00507554365f, 0.0101628695f, 0.0420725495f, 0.0322951786f, 0.0497763678f, 0.019936895f, -0.0148286037f, -0.000280721084f,
+    -0.0461372286f, 0.0537975952f, 0.043003723f, -0.0294712149f, -0.022384489f, 0.0328621529f, -0.0184002295f, -0.0294382013f,
+    0.0281005837f, -0.0393090546f, -0.00175443175f, 0.0178520214f, -0.0492882915f, 0.00981288217f, -0.000382920203f, 0.0504274406f,
+    0.0222080201f, 0.0306153446f, -0.00872555096f, 0.0103343138f, -0.0274376012f, 0.0554108545f, -0.0180051792f, 0.00694307685f,
+    0.0210863482f, 0.00749503635f, -0.0508992672f, -0.0178341623f, -0.0442363285f, -0.0249326024f, -0.0481375754f, 0.0355054215f,
+    -0.0110692931f, -0.0149454297f, -0.0303432401f, 0.018480869f, -0.00866997335f, 0.0120924972f, 0.0276092328f, 0.0409464873f,
+    -0.0011031722f, 0.0450331233f, -0.027432071f, 0.0314071551f, 0.046045959f, 0.00156779308f, 0.0190210138f, -0.0412368514f,
+    -0.0341009423f, -0.00671273563f, 0.000912568416f, 0.00869050436f, -0.0543629602f, -0.00191340817f, 0.0313429013f, 0.0474234559f,
+    -0.0200145096f, 0.0271415189f, -0.0261887405f, -0.0220283307f, 0.00456294185f, 0.0404747874f, 0.00863082241f, 0.0506352186f,
+    0.0153893726f, -0.00881776679f, 0.00754128443f, -0.0273452643f, -0.0455068499f, -0.0139951706f, -0.0142876999f, 0.0390500166f,
+    0.0265357289f, 0.0488889888f, 0.0222084317f, 0.0402511358f, 0.0143871335f, 0.0112642422f, 0.0552801862f, -0.0347146839f,
+    -0.0518380105f, -0.0401174501f, 0.0319718942f, -0.0476274416f, -0.00875892397f, -0.0536179841f, 0.0405605063f, -0.0154541535f,
+    0.001315334f, 0.00245333882f, 0.0325708501f, 0.0488682315f, -0.0324338488f, 0.00844654255f, 0.013855679f, -0.0148999486f,
+    0.0519147143f, 0.0267155766f, -0.000239897403f, -0.0385701172f, -0.0133176744f, -0.0545920096f, -0.00862468407f, -0.0267505888f,
+    0.0214147903f, 0.0247107726f, 0.04159908f, -0.0194962844f, -0.0355151631f, -0.00667494396f, 0.047124248f, -0.0229054336f,
+    -0.0326423384f, 0.0450498648f, 0.0450922735f, -0.0483533256f, -0.0459366553f, 0.0272369813f, -0.0114021534f, 0.054812286f,
+    0.000700100034f, 0.031848684f, -0.0463776588f, -0.0431183726f, 0.0350884274f, 0.0247668102f, 0.0175090786f, 0.0474658124f,
+    0.0314743668f, -0.0552106611f, -0.00162193808f, 0.0181968436f, 0.0255528688f, 0.0208219327f, -0.0104724653f, 0.00373511971f,
+    0.0509369895f, -0.0363113247f, 0.0201266054f, -0.05565897f, -0.0222072471f, -0.00176428119f, 0.0487948209f, -0.0538162477f,
+    -0.0234025549f, -0.0047568311f, -0.0325537212f, -0.0175595712f, -0.0436309464f, -0.0124484217f, -0.0463322587f, 0.0451882631f,
+    0.0428708903f, 0.0274164155f, -0.0233970433f, -0.0293248408f, 0.0180572849f, 0.0437951125f, -0.0375454724f, 0.0236183554f,
+    0.00689989422f, 0.0227032341f, 0.0424651317f, -0.0278290585f, -0.00347519037f, 0.0328869559f, -0.035386797f, 0.0102086309f,
+    0.0444773473f, 0.0466046706f, -0.0456365719f, 0.031588573f, 0.0153765911f, 0.0118036736f, -0.0453770868f, 0.0425080471f,
+    -0.0534948222f, -0.0287851021f, 0.0165969357f, -0.0531649664f, 0.00358877145f, 0.0520503856f, 0.0286221076f, 0.0150499083f,
+    -0.0457387157f, 0.0435807593f, -0.0503155924f, -0.0124117369f, -0.0147971893f, -0.0362060741f, 0.0459157862f, 0.00190357876f,
+    -0.0536143854f, -0.0102795828f, -0.0443483107f, 0.0100852139f, -0.0279551819f, -0.00381630054f, 0.0234661028f, 0.0254443176f,
+    -0.0485567302f, -0.0334441513f, 0.0212498549f, -0.00448873825f, -0.0437713973f, 0.0557533391f, 0.03653102f, -0.0201772917f,
+    0.0100438837f, 0.0307200681f, 0.00500313938f, -0.0431424268f, 0.0304153841f, -0.0108489282f, 0.0207872f, -0.0288358424f,
+    0.0128212059f, -0.0248444043f, -0.0527502783f, -0.0254933387f, 0.00727387797f, 0.0393793806f, -0.0273408741f, -0.0221270174f,
+    -0.0193562396f, 0.0219445918f, 0.0184528269f, -0.0340307131f, 0.012251134f, 0.0496281274f, 0.0356445462f, 0.0129192602f,
+    -0.0325951986f, 0.0131823421f, 0.0418641269f, -0.0209850278f, 0.0536170118f, -0.0552762635f, -0.0457806513f, 0.0468346849f,
+    -0.0178475026f, -0.0518395305f, 0.0033522062f, 0.0228449777f, -0.0131291496f, 0.0391189307f, 0.0426839516f, -0.00424235687f,
+    0.0366444066f, 0.01810362f, -0.00687487097f, -0.011932482f, -0.00158326689f, 0.050767567f, -0.00858854596f, -0.0191528536f,
+    0.0464167595f, -0.0255206749f, -0.0192424916f, -0.0320814513f, -0.0305466522f, 0.0108711123f, -0.00470760418f, -0.00346384826f,
+    -0.0237756129f, 0.0225083921f, -0.0535105541f, -0.0478024296f, -0.0280810632f, 0.0127922976f, -0.00983649306f, -0.0415085815f,
+    0.0033289222f, -0.0285202023f, -0.0113165416f, 0.0347777642f, -0.0170338079f, 0.0365048833f, -0.0142905256f, 0.00379243679f,
+    -0.0413426869f, 0.028054921f, 0.0327708423f, 0.0214815959f, -0.0353014842f, 0.00837667007f, 0.038306661f, -0.00241020275f,
+    -0.0390227549f, 0.0271778256f, 0.019053055f, -0.0530944094f, -0.054978475f, 0.0156270713f, -0.00276663364f, 0.0521657579f,
+    -0.0412872694f, 0.0241558943f, 0.0241570398f, 0.0512461327f, -0.0471325405f, -0.00974823534f, -0.0342838429f, -0.0321713015f,
+    -0.00232050545f, 0.0492275953f, 0.0116393659f, -0.00862523727f, 0.031393446f, -0.0111881597f, -0.0220197272f, 0.0174525548f,
+    0.0393802449f, 0.0384738296f, 0.0419924222f, 0.0373687781f, -0.0346907079f, 0.00566952629f, -0.00102886185f, 0.0289544556f,
+    0.0256928857f, 0.0130528938f, 0.0444025248f, -0.00397117855f, 0.0321203098f, 0.00800369959f, -0.0500659533f, 0.0315830633f,
+    -0.0451285057f, 0.0117223524f, -0.0143950703f, -0.0401118845f, 0.0558302142f, 0.0389625877f, -0.0357276648f, -0.0539440475f,
+    0.00923877209f, 0.0546292402f, 0.0525011569f, -0.0481844507f, -0.0451972447f, -0.0119472761f, -0.0383591019f, -0.00487579685f,
+    -0.0481271818f, 0.0248233676f, 0.0037092967f, -0.0269158501f, -0.0368816033f, -0.0184080191f, 0.0289647039f, -0.00632663025f,
+    -0.0446720682f, -0.0481397882f, 0.0459809601f, 0.0332789198f, -0.0216265451f, 0.00791880675f, 0.00419110386f, 0.0102808354f,
+    -0.0389378965f, -0.0484204851f, -0.0103403246f, -0.0509652197f, 0.00358731207f, 0.0426650569f, -0.0259367209f, -0.00554219028f,
+    -0.0145628694f, 0.0369100608f, -0.0128040994f, -0.00321573415f, -0.0142013272f, 0.0458728299f, -0.0340897739f, 0.0547837541f,
+    0.0224111639f, 0.0247458983f, 0.00810441282f, 0.0389393605f, -0.0253567193f, -0.0156889725f, -0.0128157288f, 0.0192021281f,
+    -0.00814438332f, 0.00490506506f, -0.0413876027f, -0.0235635173f, 0.00616559433f, -0.0523986071f, -0.0345469713f, -0.0350406393f,
+    0.0129581317f, 0.0130506745f, -0.0298904534f, -0.0346137658f, -0.0166753791f, 0.0377854891f, -0.00680929702f, -0.0396114923f,
+    0.0188502818f, -0.0259930249f, -0.0380664654f, -0.0300113652f, 0.045276273f, 0.0300294515f, -0.009208031f, 0.0461948328f,
+    -0.0492738485f, 0.0143914586f, -0.0254087653f, 0.0420194231f, -0.0451550633f, 0.0228485502f, 0.0304823499f, 0.016190812f,
+    -0.0375608131f, 0.00467339763f, -0.0504933484f, -0.0246891063f, -0.0344358645f, -0.00388489314f, 0.0522219501f, -0.0239788238f,
+    0.0194744319f, -0.0441691503f, 0.0210925322f, -0.0427541882f, 0.0261019822f, -0.0194277707f, -0.0294813514f, 0.00390458526f,
+    0.0313491225f, 0.0182117969f, -0.00381325511f, 0.0465412289f, 0.0290106591f, 0.0219520014f, 0.0418755561f, 0.0240054596f,
+    -0.0514377169f, 0.0360476375f, 0.0452046022f, -0.0308182221f, -0.00528918486f, 0.0464683585f, 0.00756977312f, -0.00718875183f,
+    -0.00274684816f, -0.0263152439f, -0.00323411333f, -0.0112641286f, -0.0282844286f, 0.000222837552f, 0.0448735282f, 0.0271966774f,
+    -0.00806500856f, 0.031784784f, 0.0348235294f, 0.040062774f, 0.0460655391f, 0.00896861311f, -0.0525431037f, 0.047825288f,
+    0.0396863557f, -0.0213132836f, -0.0405685902f, -0.0398190171f, -0.0441224426f, -0.0128879594f, -0.0156753976f, -0.0146913249f,
+    0.0496502258f, 0.0348950662f, -0.0514015369f, -0.0285499357f, -0.000492896244f, -0.0007732308f, -0.0144696403f, -0.0304585136f,
+    0.0522099622f, -0.0450739078f, -0.0533521995f, 0.00844846852f, -0.0087535996f, 0.0436750427f, 0.0183326285f, 0.046653524f,
+    -0.02956645f, 0.055403132f, 0.0544344597f, 0.0452342294f, -0.0475433096f, 0.0019335401f, -0.00477057882f, -0.011724405f,
+    -0.0352034494f, -0.0309882481f, 0.00175644422f, 0.0329381414f, -0.0278693344f, 0.0403321125f, -0.034656927f, -0.045464471f,
+    0.0486201718f, -0.0178184137f, 0.0415541977f, 0.0278977249f, 0.044524949f, -0.0541373454f, 0.0409146436f, -0.0440285318f,
+    0.0284977444f, -0.0451523252f, 0.0275738593f, -0.0306337439f, -0.0357551761f, 0.0159710664f, -0.0171577986f, 0.0244574323f,
+    0.0443873554f, 0.0393161178f, -0.0100889392f, 0.0300551541f, 0.00680793077f, -0.031627018f, -0.027666416f, -0.0245507285f,
+    -0.0438471921f, -0.0399828181f, 0.0308305379f, 0.0384215489f, 0.0206733998f, -0.00946637429f, -0.0351308994f, -0.0296070799f,
+    -0.0206973907f, 0.0518295355f, -0.0113786766f, 0.0360768549f, 0.0435605608f, -0.0138980886f, -0.0451377295f, -0.0372467451f
+}; // Gemm /denseOut/Gemm weights [320, 16]
+alignas(16) static const float c5[16] = {
+    0.0418961868f, 0.0275487304f, -0.0161043666f, -0.0147306956f, 0.0306566339f, 0.0198253058f, -0.0429240689f, -0.0286466703f,
+    0.0399619006f, 0.0387348719f, 0.0178779848f, -0.0370143838f, 0.0159653295f, -0.0511426553f, -0.0100801289f, -0.0394157246f
+}; // Gemm /denseOut/Gemm bias
+
+void ToplineGenerated::run(const float *input, float *output)
+{
+    // Gemm /denseIn/Gemm [1, 16] x [16, 320]
+    {
+        const float *a = input;
+        float *y = t1;
+        float acc[320];
+        for(int n=0; n<320; n++)
+            acc[n] = c3[n];
+        for(int k=0; k<16; k++)
+        {
+            const float ak = a[k];
+            for(int n=0; n<320; n++)
+                acc[n] += ak*c2[k*320 + n];
+        }
+        for(int n=0; n<320; n++)
+            y[n] = acc[n];
+    }
+    // Gemm /denseOut/Gemm [1, 320] x [320, 16]
+    {
+        const float *a = t1;
+        float *y = output;
+        float acc[16];
+        for(int n=0; n<16; n++)
+            acc[n] = c5[n];
+        for(int k=0; k<320; k++)
+        {
+            const float ak = a[k];
+            for(int n=0; n<16; n++)
+                acc[n] += ak*c4[k*16 + n];
+        }
+        for(int n=0; n<16; n++)
+            y[n] = acc[n];
+    }
+}
@@ -1,33 +1,36 @@
 #include "LDSP.h"
-#include "libraries/OrtModel/OrtModel.h"
+#include "../common/OrtModelRT.h"
+#include "../common/RingBuffer.h"
+#include "ToplineGenerated.h"
 
-OrtModel model;
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+OrtModelRT::Options modelOptions; // session options, the default is a single thread that does not spin
 std::string modelType = "onnx";
 std::string modelName = "topline";
+// if true, runs ToplineGenerated.cpp instead of ONNX Runtime, the model compiled ahead of time for these shapes by tools/onnx_to_cpp.py,
+// regenerate it if topline.onnx changes
+bool generatedInference = false;
 
 const int w = 16;
 
 float input[w] = {0};
 float output[w] = {0};
+static_assert(ToplineGenerated::inputSize == w && ToplineGenerated::outputSize == w, "ToplineGenerated.cpp was generated for other shapes");
 
 int inputSize = w;
 int outputSize = w;
 int inputCounter = 0;
 
-const int circBuffLength = 48000; // a reasonably large buffer, to limit end-of-buffer overhead
-int writePointer; 
-int readPointer;
-float circBuff[circBuffLength];
+RingBuffer<float> circBuff; // input samples, only a few windows long
 
 
 bool setup(LDSPcontext *context, void *userData)
 {
     std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath))
+    if (!generatedInference && (!model.setup("session1", modelPath, modelOptions) || !model.bindInput(0, input) || !model.bindOutput(0, output) || !model.prepare()))
         printf("unable to setup model\n");
 
-    writePointer = w; // the first w samples must be zeros
-    readPointer = 0;
+    circBuff.setup(2*inputSize, w); // the first w samples must be zeros
 
     if(context->audioFrames % w)
         printf("Warning! Period size (%d) is supposed to be an integer multiple of the output size w (%d)!\n", context->audioFrames, outputSize);
@@ -39,23 +42,19 @@ void render(LDSPcontext *context, void *userData)
 {
     for(int n=0; n<context->audioFrames; n++)
 	{
-        circBuff[writePointer] = audioRead(context,n,0);
+        circBuff.push(audioRead(context,n,0));
 
         // run inference every w inputs
         if( ++inputCounter == outputSize )
         {
             inputCounter = 0;
 
-            if(readPointer<=circBuffLength-inputSize)
-                std::copy(circBuff + readPointer, circBuff + readPointer + inputSize, input);
-            else 
-            {
-                int firstPartSize = circBuffLength - readPointer;
-                std::copy(circBuff + readPointer, circBuff + circBuffLength, input);
-                std::copy(circBuff, circBuff + (inputSize - firstPartSize), input + firstPartSize);
-            }
+            std::copy(circBuff.window(), circBuff.window() + inputSize, input);
 
-            model.run(input, output); // outputs a block of w samples
+            if(generatedInference)
+                ToplineGenerated::run(input, output); // outputs a block of w samples
+            else
+                model.run(); // outputs a block of w samples
             
             for(int out=0; out<outputSize; out++)
             {
@@ -64,17 +63,13 @@ void render(LDSPcontext *context, void *userData)
                 audioWrite(context, n-outputSize+1+out, 1, input[out]);
             }
 
-            readPointer += outputSize;
-            if( readPointer >= circBuffLength)
-                readPointer -= circBuffLength;
+            circBuff.advance(outputSize);
         }
-        
-        if(++writePointer >= circBuffLength)
-            writePointer = 0;
 	}
 }
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-    model.cleanup();
+    if(!generatedInference)
+        model.cleanup();
 }
\ No newline at end of file
@@ -0,0 +1,17 @@
+#ifndef TOPLINE_GENERATED_H_
+#define TOPLINE_GENERATED_H_
+
+// topline.onnx compiled ahead of time by tools/onnx_to_cpp.py, do not edit, regenerate it instead
+// inputs:  input [1, 16]
+// outputs: output [1, 16]
+class ToplineGenerated
+{
+public:
+    static const int inputSize = 16;
+    static const int outputSize = 16;
+
+    // not reentrant, the intermediate tensors are static buffers of the translation unit
+    static void run(const float *input, float *output);
+};
+
+#endif /* TOPLINE_GENERATED_H_ */
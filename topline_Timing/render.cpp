@@ -1,81 +1,100 @@
 #include "LDSP.h"
-#include "libraries/OrtModel/OrtModel.h"
-#include <fstream>
+#include "../common/OrtModelRT.h"
+#include "../common/RingBuffer.h"
+#include <chrono>
+#include "../common/LatencyHistogram.h"
+#include "../common/DeadlineMonitor.h"
+#include "../common/TimingLogWriter.h"
+#include "ToplineGenerated.h"
 
-OrtModel model;
+OrtModelRT model; // buffers are bound in setup(), so that run() does not allocate
+OrtModelRT::Options modelOptions; // session options, the default is a single thread that does not spin
 
 const int w = 16;
 
 float input[w] = {0};
 float output[w] = {0};
+static_assert(ToplineGenerated::inputSize == w && ToplineGenerated::outputSize == w, "ToplineGenerated.cpp was generated for other shapes");
 
 int inputSize = w;
 int outputSize = w;
 int inputCounter = 0;
 
-const int circBuffLength = 2*w;//48000; // a reasonably large buffer, to limit end-of-buffer overhead
-int writePointer; 
-int readPointer;
-float circBuff[circBuffLength];
+RingBuffer<float> circBuff; // input samples, only a few windows long
 
 //--------------------------------
 std::string modelType = "onnx";
 std::string modelName = "topline";
-
-unsigned long long * inferenceTimes;
-int logPtr = 0;
+// if true, loads the int8 variant <modelName>_int8.onnx, produced and qualified by tools/quantize_models.py
+bool quantizedModel = false;
+// if true, times ToplineGenerated.cpp instead of ONNX Runtime, the model compiled ahead of time for these shapes by tools/onnx_to_cpp.py,
+// regenerate it if topline.onnx changes; it is always the float model, so quantizedModel only changes the name of the log
+bool generatedInference = false;
+
+std::string timingLogDir = ".";
+TimingLogWriter timingLog; // streams inference times to a binary file
+long long logCnt = 0;
 constexpr int testDuration_sec = 10;
-int numLogs;
+long long numLogs;
+LatencyHistogram inferenceHistogram; // nanoseconds
+
+float deadlineBudgetFraction = 0.75; // callbacks longer than this fraction of the period duration count as deadline misses
+DeadlineMonitor deadlineMonitor; // times the whole render() callback
+int maxStoredMisses = 4096; // further misses are counted, but their indices are not stored
 
 bool setup(LDSPcontext *context, void *userData)
 {
+    if(quantizedModel)
+        modelName += "_int8";
+
     std::string modelPath = "./"+modelName+"."+modelType;
-    if (!model.setup("session1", modelPath.c_str()))
+    if (!generatedInference && (!model.setup("session1", modelPath, modelOptions) || !model.bindInput(0, input) || !model.bindOutput(0, output) || !model.prepare()))
         printf("unable to setup model\n");
 
-    writePointer = w; // the first w samples must be zeros
-    readPointer = 0;
+    circBuff.setup(2*inputSize, w); // the first w samples must be zeros
 
     if(context->audioFrames % w)
         printf("Warning! Period size (%d) is supposed to be an integer multiple of the output size w (%d)!\n", context->audioFrames, outputSize);
 
     //--------------------------------
-    inferenceTimes = new unsigned long long[context->audioSampleRate*testDuration_sec*1.01];
     numLogs = context->audioSampleRate*testDuration_sec / outputSize; // division to handle case of models outputting a block of samples
+    std::string timingLogFileName = "inferenceTiming_"+modelName+"_out"+std::to_string(outputSize)+(generatedInference ? "_generated.tlog" : "_onnx.tlog");
+    if(!timingLog.setup(timingLogDir+"/"+timingLogFileName, modelName, context->audioSampleRate, context->audioFrames, outputSize))
+        return false;
+    deadlineMonitor.setup(context->audioFrames, context->audioSampleRate, deadlineBudgetFraction, maxStoredMisses);
 
     return true;
 }
 
 void render(LDSPcontext *context, void *userData)
 {
+    deadlineMonitor.beginPeriod();
+
     for(int n=0; n<context->audioFrames; n++)
 	{
-        circBuff[writePointer] = audioRead(context,n,0);
+        circBuff.push(audioRead(context,n,0));
 
         // run inference every w inputs
         if( ++inputCounter == outputSize )
         {
             inputCounter = 0;
 
-            if(readPointer<=circBuffLength-inputSize)
-                std::copy(circBuff + readPointer, circBuff + readPointer + inputSize, input);
-            else 
-            {
-                int firstPartSize = circBuffLength - readPointer;
-                std::copy(circBuff + readPointer, circBuff + circBuffLength, input);
-                std::copy(circBuff, circBuff + (inputSize - firstPartSize), input + firstPartSize);
-            }
+            std::copy(circBuff.window(), circBuff.window() + inputSize, input);
 
             // Start the Clock
-            auto start_time = std::chrono::high_resolution_clock::now();
+            auto start_time = std::chrono::steady_clock::now();
 
-            model.run(input, output); // outputs a block of w samples
+            if(generatedInference)
+                ToplineGenerated::run(input, output); // outputs a block of w samples
+            else
+                model.run(); // outputs a block of w samples
 
             // Stop the clock
-            auto end_time = std::chrono::high_resolution_clock::now();
-            inferenceTimes[logPtr] = std::chrono::duration_cast
-                <std::chrono::microseconds>(end_time - start_time).count();
-            logPtr++;
+            auto end_time = std::chrono::steady_clock::now();
+            unsigned long long inferenceTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+            inferenceHistogram.record(inferenceTime);
+            timingLog.push(inferenceTime);
+            logCnt++;
             
             for(int out=0; out<outputSize; out++)
             {
@@ -84,33 +103,23 @@ void render(LDSPcontext *context, void *userData)
                 audioWrite(context, n-outputSize+1+out, 1, input[out]);
             }
 
-            readPointer += outputSize;
-            if( readPointer >= circBuffLength)
-                readPointer -= circBuffLength;
+            circBuff.advance(outputSize);
         }
-        if(++writePointer >= circBuffLength)
-            writePointer = 0;
 
-        if(logPtr>=numLogs)
+        if(logCnt>=numLogs)
           LDSP_requestStop();
     }
+
+    deadlineMonitor.endPeriod();
 }
 
 void cleanup(LDSPcontext *context, void *userData)
 {
-  std::string timingLogDir = ".";
-  std::string timingLogFileName = "inferenceTiming_"+modelName+"_out"+std::to_string(outputSize)+"_onnx.txt";
-  std::string timingLogFilePath = timingLogDir+"/"+timingLogFileName;
-
-  std::ofstream logFile(timingLogFilePath);
-  if(logFile.is_open())
-  {
-    for (int i=0;i<numLogs; i++)
-      logFile << std::to_string(inferenceTimes[i]) << "\n";
-  }
-  logFile.close();
+  inferenceHistogram.printReport(("inference "+modelName).c_str());
+  deadlineMonitor.printReport(("render "+modelName).c_str());
 
-  delete[] inferenceTimes;
+  timingLog.cleanup();
 
-  model.cleanup();
+  if(!generatedInference)
+    model.cleanup();
 }
\ No newline at end of file